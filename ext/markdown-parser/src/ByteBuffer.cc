@@ -6,47 +6,60 @@
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
 
+#include <algorithm>
+#include <cstring>
 #include "ByteBuffer.h"
+#include "UTF8.h"
 
 using namespace mdp;
 
 /* Byte lenght of an UTF8 character (based on first byte) */
 #define UTF8_CHAR_LEN(byte) ((0xE5000000 >> ((byte >> 3) & 0x1e)) & 3) + 1
 
+/* UTF8 continuation byte has the form 10xxxxxx */
+#define UTF8_IS_CONTINUATION(byte) (((byte)&0xC0) == 0x80)
+
 /* Number of UTF8 characters in byte buffer */
 static size_t strnlen_utf8(const char* s, size_t len)
 {
     if (!s || !len)
         return 0;
 
+    // Nothing is counted past a NUL byte
+    const void* terminator = ::memchr(s, '\0', len);
+    if (terminator)
+        len = static_cast<const char*>(terminator) - s;
+
+    // Walk through the bytes of a character the range starts in the middle of
     size_t i = 0, j = 0;
-    while (s[i] && i < len) {
+    while (i < len && UTF8_IS_CONTINUATION(s[i])) {
         i += UTF8_CHAR_LEN(s[i]);
         j++;
     }
-    return j;
+
+    if (i >= len)
+        return j;
+
+    // From now on every character is counted by its leading byte
+    return j + CountUTF8Characters(s + i, len - i);
 }
 
-/* Convert range of bytes to a range of characters */
-static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange, const ByteBuffer& byteBuffer)
+/* Convert range of bytes to a range of characters, no byte past the data is read */
+static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange, const char* data, size_t length)
 {
-    if (byteBuffer.empty()) {
+    if (!length) {
         return CharactersRange();
     }
 
-    BytesRange workRange = bytesRange;
-    if (bytesRange.location + bytesRange.length > byteBuffer.length()) {
-        // Accomodate maximum possible length
-        workRange.length -= bytesRange.location + bytesRange.length - byteBuffer.length();
-    }
+    size_t location = std::min(bytesRange.location, length);
 
     size_t charLocation = 0;
-    if (bytesRange.location > 0)
-        charLocation = strnlen_utf8(byteBuffer.c_str(), bytesRange.location);
+    if (location > 0)
+        charLocation = strnlen_utf8(data, location);
 
     size_t charLength = 0;
     if (bytesRange.length > 0)
-        charLength = strnlen_utf8(byteBuffer.c_str() + bytesRange.location, bytesRange.length);
+        charLength = strnlen_utf8(data + location, std::min(bytesRange.length, length - location));
 
     CharactersRange characterRange = CharactersRange(charLocation, charLength);
     return characterRange;
@@ -85,35 +98,98 @@ static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange,
     return characterRange;
 }
 
-void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer)
+const size_t ByteBufferCharacterIndex::BlockSize = 256;
+
+ByteBufferCharacterIndex::ByteBufferCharacterIndex() : m_data(NULL), m_length(0), m_terminator(0), m_built(false) {}
+
+void ByteBufferCharacterIndex::bind(const ByteBuffer& byteBuffer)
+{
+    bind(byteBuffer.data(), byteBuffer.length());
+}
+
+void ByteBufferCharacterIndex::bind(const char* data, size_t length)
 {
+    m_data = data;
+    m_length = length;
+
+    const void* terminator = ::memchr(m_data, '\0', m_length);
+    m_terminator = terminator ? static_cast<const char*>(terminator) - m_data : m_length;
 
-    const char* source = byteBuffer.c_str();
-    size_t len = byteBuffer.length();
-    size_t pos = 0;
-    size_t charPos = 0;
+    m_built = false;
+    m_checkpoints.clear();
+}
 
-    index.resize(byteBuffer.length());
+void ByteBufferCharacterIndex::build() const
+{
+    if (m_built)
+        return;
 
-    while (source[pos] && pos < len) {
-        int charLen = UTF8_CHAR_LEN(source[pos]);
-        pos += charLen;
+    m_checkpoints.clear();
+    m_checkpoints.reserve(m_terminator / BlockSize + 1);
 
-        while (charLen) {
-            index[pos - charLen] = charPos;
-            charLen--;
-        }
+    size_t count = 0;
 
-        charPos++;
+    for (size_t pos = 0; pos < m_terminator; pos += BlockSize) {
+        m_checkpoints.push_back(count);
+        count += CountUTF8Characters(m_data + pos, std::min(BlockSize, m_terminator - pos));
     }
+
+    m_built = true;
+}
+
+bool ByteBufferCharacterIndex::isBuilt() const
+{
+    return m_built;
+}
+
+size_t ByteBufferCharacterIndex::operator[](size_t position) const
+{
+    // Compatibility with strnlen_utf8(), nothing is counted past a NUL byte
+    if (position >= m_terminator)
+        return 0;
+
+    build();
+
+    size_t block = position / BlockSize;
+    size_t begin = block * BlockSize;
+    size_t count = m_checkpoints[block] + CountUTF8Characters(m_data + begin, position - begin + 1);
+
+    // Index of the character the position belongs to
+    return count ? count - 1 : 0;
+}
+
+size_t ByteBufferCharacterIndex::size() const
+{
+    return m_length;
+}
+
+bool ByteBufferCharacterIndex::empty() const
+{
+    return m_length == 0;
+}
+
+void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer)
+{
+    index.bind(byteBuffer);
+}
+
+void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const char* data, size_t length)
+{
+    index.bind(data, length);
 }
 
 CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer)
+{
+    return BytesRangeSetToCharactersRangeSet(rangeSet, byteBuffer.data(), byteBuffer.length());
+}
+
+CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(
+    const BytesRangeSet& rangeSet, const char* data, size_t length)
 {
     CharactersRangeSet characterMap;
 
     for (BytesRangeSet::const_iterator it = rangeSet.begin(); it != rangeSet.end(); ++it) {
-        CharactersRange characterRange = BytesRangeToCharactersRange(*it, byteBuffer);
+        CharactersRange characterRange = BytesRangeToCharactersRange(*it, data, length);
         characterMap.push_back(characterRange);
     }
 
@@ -135,26 +211,30 @@ CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(
 
 ByteBuffer mdp::MapBytesRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer)
 {
-    if (byteBuffer.empty())
+    return MapBytesRangeSet(rangeSet, byteBuffer.data(), byteBuffer.length());
+}
+
+ByteBuffer mdp::MapBytesRangeSet(const BytesRangeSet& rangeSet, const char* data, size_t length)
+{
+    if (!length)
         return ByteBuffer();
 
-    size_t length = byteBuffer.length();
-    ByteBufferStream s;
+    ByteBuffer buffer;
     for (BytesRangeSet::const_iterator it = rangeSet.begin(); it != rangeSet.end(); ++it) {
 
         if (it->location + it->length > length) {
             // Sundown adds an extra newline on the source input if needed.
-            if (it->location + it->length - length == 1) {
-                s << byteBuffer.substr(it->location, length - it->location);
-                return s.str();
+            if (it->location + it->length - length == 1 && it->location <= length) {
+                buffer.append(data + it->location, length - it->location);
+                return buffer;
             } else {
                 // Wrong map
                 return ByteBuffer();
             }
         }
 
-        s << byteBuffer.substr(it->location, it->length);
+        buffer.append(data + it->location, it->length);
     }
 
-    return s.str();
+    return buffer;
 }
@@ -70,19 +70,70 @@ namespace mdp
     /** Set of non-continuous character ranges */
     typedef RangeSet<CharactersRange> CharactersRangeSet;
 
-    /** Map byte index into utf-8 chracter index */
-    typedef std::vector<size_t> ByteBufferCharacterIndex;
+    /**
+     *  \brief Map byte index into utf-8 chracter index
+     *
+     *  Compact index of character positions in a byte buffer. Instead of
+     *  one entry per byte, the index keeps the number of characters
+     *  preceding every block of `BlockSize` bytes. A lookup adds the number
+     *  of characters (UTF-8 non-continuation bytes) within the block.
+     *
+     *  The index is bound to a buffer which has to outlive it. Its
+     *  checkpoints are built lazily on the first lookup, call `build()`
+     *  before sharing the index between threads.
+     */
+    class ByteBufferCharacterIndex
+    {
+    public:
+        /** Number of bytes per checkpoint */
+        static const size_t BlockSize;
+
+        ByteBufferCharacterIndex();
+
+        /** Binds the index to a byte buffer, drops any built checkpoints */
+        void bind(const ByteBuffer& byteBuffer);
+
+        /** Binds the index to \a length bytes at \a data, not necessarily NUL terminated */
+        void bind(const char* data, size_t length);
 
-    /** Fill character map - cache of characters positions */
+        /** Builds the checkpoints if not built already */
+        void build() const;
+
+        /** True if the checkpoints are built */
+        bool isBuilt() const;
+
+        /** \return Index of the character the byte at \a position belongs to */
+        size_t operator[](size_t position) const;
+
+        /** \return Number of indexed bytes */
+        size_t size() const;
+
+        /** True if there are no bytes indexed */
+        bool empty() const;
+
+    private:
+        const char* m_data;
+        size_t m_length;
+        size_t m_terminator; // Position of the first NUL byte, bytes past it are not indexed
+
+        mutable bool m_built;
+        mutable std::vector<size_t> m_checkpoints;
+    };
+
+    /** Bind character index to a byte buffer, the index is built on its first use */
     void BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer);
+    void BuildCharacterIndex(ByteBufferCharacterIndex& index, const char* data, size_t length);
 
     /** Convert ranges of bytes to ranges of characters */
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer);
+    CharactersRangeSet BytesRangeSetToCharactersRangeSet(
+        const BytesRangeSet& rangeSet, const char* data, size_t length);
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(
         const BytesRangeSet& rangeSet, const ByteBufferCharacterIndex& index);
 
     /** Maps bytes range set to byte buffer */
     ByteBuffer MapBytesRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer);
+    ByteBuffer MapBytesRangeSet(const BytesRangeSet& rangeSet, const char* data, size_t length);
 }
 
 #endif
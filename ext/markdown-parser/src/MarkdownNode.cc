@@ -10,33 +10,71 @@
 
 using namespace mdp;
 
-MarkdownNode::MarkdownNode(MarkdownNodeType type_, MarkdownNode* parent_, const ByteBuffer& text_, const Data& data_)
-    : type(type_), text(text_), data(data_), m_parent(parent_)
+MarkdownNode::MarkdownNode(MarkdownNodeType type_, MarkdownNode* parent_, ByteBuffer text_, const Data& data_)
+    : type(type_), text(std::move(text_)), data(data_), m_parent(parent_)
 {
-    m_children.reset(::new MarkdownNodes);
 }
 
 MarkdownNode::MarkdownNode(const MarkdownNode& rhs)
+    : type(rhs.type)
+    , text(rhs.text)
+    , data(rhs.data)
+    , sourceMap(rhs.sourceMap)
+    , m_parent(rhs.m_parent)
+    , m_children(rhs.m_children)
 {
+    adoptChildren();
+}
+
+MarkdownNode::MarkdownNode(MarkdownNode&& rhs) noexcept
+    : type(rhs.type)
+    , text(std::move(rhs.text))
+    , data(rhs.data)
+    , sourceMap(std::move(rhs.sourceMap))
+    , m_parent(rhs.m_parent)
+    , m_children(std::move(rhs.m_children))
+{
+    adoptChildren();
+}
+
+MarkdownNode& MarkdownNode::operator=(const MarkdownNode& rhs)
+{
+    if (this == &rhs)
+        return *this;
+
     this->type = rhs.type;
     this->text = rhs.text;
     this->data = rhs.data;
     this->sourceMap = rhs.sourceMap;
-    this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    this->m_children = rhs.m_children;
     this->m_parent = rhs.m_parent;
+
+    adoptChildren();
+    return *this;
 }
 
-MarkdownNode& MarkdownNode::operator=(const MarkdownNode& rhs)
+MarkdownNode& MarkdownNode::operator=(MarkdownNode&& rhs) noexcept
 {
+    if (this == &rhs)
+        return *this;
+
     this->type = rhs.type;
-    this->text = rhs.text;
+    this->text = std::move(rhs.text);
     this->data = rhs.data;
-    this->sourceMap = rhs.sourceMap;
-    this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    this->sourceMap = std::move(rhs.sourceMap);
+    this->m_children = std::move(rhs.m_children);
     this->m_parent = rhs.m_parent;
+
+    adoptChildren();
     return *this;
 }
 
+void MarkdownNode::adoptChildren()
+{
+    for (MarkdownNodes::iterator it = m_children.begin(); it != m_children.end(); ++it)
+        it->m_parent = this;
+}
+
 MarkdownNode::~MarkdownNode() {}
 
 MarkdownNode& MarkdownNode::parent()
@@ -65,18 +103,12 @@ bool MarkdownNode::hasParent() const
 
 MarkdownNodes& MarkdownNode::children()
 {
-    if (!m_children.get())
-        throw "no children set";
-
-    return *m_children;
+    return m_children;
 }
 
 const MarkdownNodes& MarkdownNode::children() const
 {
-    if (!m_children.get())
-        throw "no children set";
-
-    return *m_children;
+    return m_children;
 }
 
 void MarkdownNode::printNode(size_t level) const
@@ -136,7 +168,7 @@ void MarkdownNode::printNode(size_t level) const
 
     cout << std::endl;
 
-    for (MarkdownNodeIterator it = m_children->begin(); it != m_children->end(); ++it) {
+    for (MarkdownNodes::const_iterator it = m_children.begin(); it != m_children.end(); ++it) {
         it->printNode(level + 1);
     }
 
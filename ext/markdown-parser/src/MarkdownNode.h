@@ -9,8 +9,7 @@
 #ifndef MARKDOWNPARSER_NODE_H
 #define MARKDOWNPARSER_NODE_H
 
-#include <deque>
-#include <memory>
+#include <vector>
 #include <iostream>
 #include "ByteBuffer.h"
 
@@ -39,8 +38,17 @@ namespace mdp
     /* Forward declaration of AST Node */
     class MarkdownNode;
 
-    /** Markdown AST nodes collection */
-    typedef std::deque<MarkdownNode> MarkdownNodes;
+    /**
+     *  \brief Markdown AST nodes collection
+     *
+     *  Siblings are stored contiguously. The collection is held by value in
+     *  its parent node and allocates nothing until the first child is added,
+     *  so leaf nodes (the majority of the AST) cost no extra allocation.
+     *
+     *  Note adding a node invalidates iterators to its siblings, the AST
+     *  is not expected to change once it is built.
+     */
+    typedef std::vector<MarkdownNode> MarkdownNodes;
 
     /**
      *  AST node
@@ -76,18 +84,24 @@ namespace mdp
         MarkdownNodes& children();
         const MarkdownNodes& children() const;
 
-        /** Constructor */
+        /** Constructor, takes over the text */
         MarkdownNode(MarkdownNodeType type_ = UndefinedMarkdownNodeType,
             MarkdownNode* parent_ = NULL,
-            const ByteBuffer& text_ = ByteBuffer(),
+            ByteBuffer text_ = ByteBuffer(),
             const Data& data_ = Data());
 
-        /** Copy constructor */
+        /** Copy constructor, children are re-parented to the new node */
         MarkdownNode(const MarkdownNode& rhs);
 
-        /** Assignment operator */
+        /** Move constructor, children are re-parented to the new node */
+        MarkdownNode(MarkdownNode&& rhs) noexcept;
+
+        /** Assignment operator, children are re-parented to this node */
         MarkdownNode& operator=(const MarkdownNode& rhs);
 
+        /** Move assignment operator, children are re-parented to this node */
+        MarkdownNode& operator=(MarkdownNode&& rhs) noexcept;
+
         /** Destructor */
         ~MarkdownNode();
 
@@ -96,7 +110,10 @@ namespace mdp
 
     private:
         MarkdownNode* m_parent;
-        std::unique_ptr<MarkdownNodes> m_children;
+        MarkdownNodes m_children;
+
+        /** Points parent of all children to this node */
+        void adoptChildren();
     };
 
     /** Markdown AST nodes collection iterator */
@@ -6,6 +6,7 @@
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 #include "MarkdownParser.h"
@@ -22,6 +23,9 @@ const int MarkdownParser::ParserExtensions
 
 /**
  *  \brief  Create a byte buffer from a sundown buffer
+ *
+ *  This is the only copy of a node text made while building the AST,
+ *  the buffer is moved into the node afterwards.
  */
 static ByteBuffer ByteBufferFromSundown(const struct buf* text)
 {
@@ -31,24 +35,60 @@ static ByteBuffer ByteBufferFromSundown(const struct buf* text)
     return ByteBuffer(reinterpret_cast<char*>(text->data), text->size);
 }
 
-MarkdownParser::MarkdownParser() : m_workingNode(NULL), m_listBlockContext(false), m_source(NULL), m_sourceLength(0) {}
+/**
+ *  \brief  Find text in the source mapped by a source map
+ *
+ *  Equivalent to `MapBytesRangeSet(sourceMap, source).find(text)`, without
+ *  copying the mapped source when the source map is a single range.
+ */
+static size_t FindInBytesRangeSet(
+    const ByteBuffer& text, const BytesRangeSet& sourceMap, const char* source, size_t length)
+{
+    if (sourceMap.size() != 1 || sourceMap.front().location + sourceMap.front().length > length)
+        return MapBytesRangeSet(sourceMap, source, length).find(text);
+
+    const char* first = source + sourceMap.front().location;
+    const char* last = first + sourceMap.front().length;
+    const char* found = std::search(first, last, text.begin(), text.end());
+
+    if (found == last && !text.empty())
+        return ByteBuffer::npos;
 
-void MarkdownParser::parse(const ByteBuffer& source, MarkdownNode& ast)
+    return found - first;
+}
+
+MarkdownParser::MarkdownParser()
+    : m_workingNode(NULL), m_listBlockContext(false), m_source(NULL), m_sourceLength(0), m_cancelled(false)
 {
+}
+
+bool MarkdownParser::parse(const ByteBuffer& source, MarkdownNode& ast, const CancellationCheck& cancellationCheck)
+{
+    return parse(source.data(), source.length(), ast, cancellationCheck);
+}
+
+bool MarkdownParser::parse(
+    const char* source, size_t length, MarkdownNode& ast, const CancellationCheck& cancellationCheck)
+{
+    if (!source)
+        source = "";
+
     ast = MarkdownNode();
     m_workingNode = &ast;
     m_workingNode->type = RootMarkdownNodeType;
-    m_workingNode->sourceMap.push_back(BytesRange(0, source.length()));
-    m_source = &source;
-    m_sourceLength = source.length();
+    m_workingNode->sourceMap.push_back(BytesRange(0, length));
+    m_source = source;
+    m_sourceLength = length;
     m_listBlockContext = false;
+    m_cancellationCheck = cancellationCheck;
+    m_cancelled = false;
 
     RenderCallbacks callbacks = renderCallbacks();
 
     ::sd_markdown* sundown = ::sd_markdown_new(ParserExtensions, MaxNesting, &callbacks, renderCallbackData());
     ::buf* output = ::bufnew(OutputUnitSize);
 
-    ::sd_markdown_render(output, reinterpret_cast<const uint8_t*>(source.c_str()), source.length(), sundown);
+    ::sd_markdown_render(output, reinterpret_cast<const uint8_t*>(source), length, sundown);
 
     ::bufrelease(output);
     ::sd_markdown_free(sundown);
@@ -57,10 +97,21 @@ void MarkdownParser::parse(const ByteBuffer& source, MarkdownNode& ast)
     m_source = NULL;
     m_sourceLength = 0;
     m_listBlockContext = false;
+    m_cancellationCheck = CancellationCheck();
 
 #ifdef DEBUG
     ast.printNode();
 #endif
+
+    return !m_cancelled;
+}
+
+bool MarkdownParser::isCancelled()
+{
+    if (!m_cancelled && m_cancellationCheck)
+        m_cancelled = m_cancellationCheck();
+
+    return m_cancelled;
 }
 
 MarkdownParser::RenderCallbacks MarkdownParser::renderCallbacks()
@@ -97,28 +148,27 @@ MarkdownParser::RenderCallbackData MarkdownParser::renderCallbackData()
 
 void MarkdownParser::renderHeader(struct buf* ob, const struct buf* text, int level, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->renderHeader(ByteBufferFromSundown(text), level);
 }
 
-void MarkdownParser::renderHeader(const ByteBuffer& text, int level)
+void MarkdownParser::renderHeader(ByteBuffer text, int level)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(HeaderMarkdownNodeType, m_workingNode, text, level);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(HeaderMarkdownNodeType, m_workingNode, std::move(text), level);
 }
 
 void MarkdownParser::beginList(int flags, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->beginList(flags);
 }
 
@@ -130,24 +180,24 @@ void MarkdownParser::beginList(int flags)
 
 void MarkdownParser::renderList(struct buf* ob, const struct buf* text, int flags, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
-    p->renderList(ByteBufferFromSundown(text), flags);
+
+    if (!p || p->m_cancelled)
+        return;
+    p->renderList(flags);
 }
 
-void MarkdownParser::renderList(const ByteBuffer& text, int flags)
+void MarkdownParser::renderList(int flags)
 {
     m_listBlockContext = true;
 }
 
 void MarkdownParser::beginListItem(int flags, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->beginListItem(flags);
 }
 
@@ -156,8 +206,7 @@ void MarkdownParser::beginListItem(int flags)
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(ListItemMarkdownNodeType, m_workingNode, ByteBuffer(), flags);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(ListItemMarkdownNodeType, m_workingNode, ByteBuffer(), flags);
 
     // Push context
     m_workingNode = &m_workingNode->children().back();
@@ -165,14 +214,14 @@ void MarkdownParser::beginListItem(int flags)
 
 void MarkdownParser::renderListItem(struct buf* ob, const struct buf* text, int flags, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
-    p->renderListItem(ByteBufferFromSundown(text), flags);
+
+    if (!p || p->m_cancelled)
+        return;
+    p->renderListItem(text, flags);
 }
 
-void MarkdownParser::renderListItem(const ByteBuffer& text, int flags)
+void MarkdownParser::renderListItem(const struct buf* text, int flags)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
@@ -183,9 +232,10 @@ void MarkdownParser::renderListItem(const ByteBuffer& text, int flags)
     // No "inline" list items:
     // Instead of storing the text on the list item
     // create the artificial paragraph node to store the text.
+    // The text is not needed (and not copied) otherwise.
     if (m_workingNode->children().empty() || m_workingNode->children().front().type != ParagraphMarkdownNodeType) {
-        MarkdownNode textNode(ParagraphMarkdownNodeType, m_workingNode, text);
-        m_workingNode->children().push_front(textNode);
+        m_workingNode->children().emplace(
+            m_workingNode->children().begin(), ParagraphMarkdownNodeType, m_workingNode, ByteBufferFromSundown(text));
     }
 
     m_workingNode->data = flags;
@@ -196,46 +246,44 @@ void MarkdownParser::renderListItem(const ByteBuffer& text, int flags)
 
 void MarkdownParser::renderBlockCode(struct buf* ob, const struct buf* text, const struct buf* lang, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
-    p->renderBlockCode(ByteBufferFromSundown(text), ByteBufferFromSundown(lang));
+
+    if (!p || p->m_cancelled)
+        return;
+    p->renderBlockCode(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderBlockCode(const ByteBuffer& text, const ByteBuffer& language)
+void MarkdownParser::renderBlockCode(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(CodeMarkdownNodeType, m_workingNode, text);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(CodeMarkdownNodeType, m_workingNode, std::move(text));
 }
 
 void MarkdownParser::renderParagraph(struct buf* ob, const struct buf* text, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->renderParagraph(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderParagraph(const ByteBuffer& text)
+void MarkdownParser::renderParagraph(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(ParagraphMarkdownNodeType, m_workingNode, text);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(ParagraphMarkdownNodeType, m_workingNode, std::move(text));
 }
 
 void MarkdownParser::renderHorizontalRule(struct buf* ob, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->renderHorizontalRule();
 }
 
@@ -244,34 +292,32 @@ void MarkdownParser::renderHorizontalRule()
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(HRuleMarkdownNodeType, m_workingNode, ByteBuffer(), MarkdownNode::Data());
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(HRuleMarkdownNodeType, m_workingNode, ByteBuffer(), MarkdownNode::Data());
 }
 
 void MarkdownParser::renderHTML(struct buf* ob, const struct buf* text, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->renderHTML(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderHTML(const ByteBuffer& text)
+void MarkdownParser::renderHTML(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(HTMLMarkdownNodeType, m_workingNode, text);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(HTMLMarkdownNodeType, m_workingNode, std::move(text));
 }
 
 void MarkdownParser::beginQuote(void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->beginQuote();
 }
 
@@ -280,8 +326,7 @@ void MarkdownParser::beginQuote()
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
 
-    MarkdownNode node(QuoteMarkdownNodeType, m_workingNode);
-    m_workingNode->children().push_back(node);
+    m_workingNode->children().emplace_back(QuoteMarkdownNodeType, m_workingNode);
 
     // Push context
     m_workingNode = &m_workingNode->children().back();
@@ -289,14 +334,14 @@ void MarkdownParser::beginQuote()
 
 void MarkdownParser::renderQuote(struct buf* ob, const struct buf* text, void* opaque)
 {
-    if (!opaque)
-        return;
-
     MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    if (!p || p->m_cancelled)
+        return;
     p->renderQuote(ByteBufferFromSundown(text));
 }
 
-void MarkdownParser::renderQuote(const ByteBuffer& text)
+void MarkdownParser::renderQuote(ByteBuffer text)
 {
     if (!m_workingNode)
         throw NO_WORKING_NODE_ERR;
@@ -304,7 +349,7 @@ void MarkdownParser::renderQuote(const ByteBuffer& text)
     if (m_workingNode->type != QuoteMarkdownNodeType)
         throw WORKING_NODE_MISMATCH_ERR;
 
-    m_workingNode->text = text;
+    m_workingNode->text = std::move(text);
 
     // Pop context
     m_workingNode = &m_workingNode->parent();
@@ -312,7 +357,10 @@ void MarkdownParser::renderQuote(const ByteBuffer& text)
 
 void MarkdownParser::blockDidParse(const src_map* map, const uint8_t* txt_data, size_t size, void* opaque)
 {
-    if (!opaque || !map)
+    MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
+
+    // Checked once a block, the following callbacks do nothing once cancelled
+    if (!p || !map || p->isCancelled())
         return;
 
     BytesRangeSet sourceMap;
@@ -321,7 +369,6 @@ void MarkdownParser::blockDidParse(const src_map* map, const uint8_t* txt_data,
         sourceMap.push_back(byteRange);
     }
 
-    MarkdownParser* p = static_cast<MarkdownParser*>(opaque);
     p->blockDidParse(sourceMap);
 }
 
@@ -364,11 +411,10 @@ void MarkdownParser::blockDidParse(const BytesRangeSet& sourceMap)
     if (lMarkdownNode.type == ListItemMarkdownNodeType && !lMarkdownNode.children().empty()
         && lMarkdownNode.children().front().sourceMap.empty()) {
 
-        ByteBuffer& buffer = lMarkdownNode.children().front().text;
-        ByteBuffer mapped = MapBytesRangeSet(sourceMap, *m_source);
-        size_t pos = mapped.find(buffer);
+        const ByteBuffer& buffer = lMarkdownNode.children().front().text;
+        size_t pos = FindInBytesRangeSet(buffer, sourceMap, m_source, m_sourceLength);
 
-        if (pos != mapped.npos) {
+        if (pos != ByteBuffer::npos) {
             BytesRange range = sourceMap.front();
             range.location += pos;
             range.length = buffer.length();
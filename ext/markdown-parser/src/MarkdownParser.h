@@ -9,6 +9,7 @@
 #ifndef MARKDOWNPARSER_MARKDOWNPARSER_H
 #define MARKDOWNPARSER_MARKDOWNPARSER_H
 
+#include <functional>
 #include "ByteBuffer.h"
 #include "MarkdownNode.h"
 #include "markdown.h"
@@ -31,6 +32,9 @@ namespace mdp
     class MarkdownParser
     {
     public:
+        /** Check if the parsing should stop, e.g. after a deadline */
+        typedef std::function<bool()> CancellationCheck;
+
         MarkdownParser();
         MarkdownParser(const MarkdownParser&);
         MarkdownParser& operator=(const MarkdownParser&);
@@ -38,16 +42,45 @@ namespace mdp
         /**
          *  \brief Parse source buffer
          *
-         *  \param source   Markdown source data to be parsed
-         *  \param ast      Parsed AST (root node)
+         *  The cancellation check is called after every block, once it
+         *  returns true no more nodes are added to the AST.
+         *
+         *  \param source               Markdown source data to be parsed
+         *  \param ast                  Parsed AST (root node)
+         *  \param cancellationCheck    Check if the parsing should stop, none if empty
+         *  \return False if cancelled, the AST is incomplete then
+         */
+        bool parse(const ByteBuffer& source,
+            MarkdownNode& ast,
+            const CancellationCheck& cancellationCheck = CancellationCheck());
+
+        /**
+         *  \brief Parse source bytes in place
+         *
+         *  Parses as `parse()`, the source data need not be NUL terminated
+         *  nor owned by a byte buffer, they are not copied.
+         *
+         *  \param source               Markdown source data to be parsed
+         *  \param length               Number of bytes of the source data
+         *  \param ast                  Parsed AST (root node)
+         *  \param cancellationCheck    Check if the parsing should stop, none if empty
+         *  \return False if cancelled, the AST is incomplete then
          */
-        void parse(const ByteBuffer& source, MarkdownNode& ast);
+        bool parse(const char* source,
+            size_t length,
+            MarkdownNode& ast,
+            const CancellationCheck& cancellationCheck = CancellationCheck());
 
     private:
         MarkdownNode* m_workingNode;
         bool m_listBlockContext;
-        const ByteBuffer* m_source;
+        const char* m_source;
         size_t m_sourceLength;
+        CancellationCheck m_cancellationCheck;
+        bool m_cancelled;
+
+        /** \return True if cancelled, checks the cancellation unless already cancelled */
+        bool isCancelled();
 
         static const size_t OutputUnitSize;
         static const size_t MaxNesting;
@@ -61,29 +94,29 @@ namespace mdp
 
         // Header
         static void renderHeader(struct buf* ob, const struct buf* text, int level, void* opaque);
-        void renderHeader(const ByteBuffer& text, int level);
+        void renderHeader(ByteBuffer text, int level);
 
         // List
         static void beginList(int flags, void* opaque);
         void beginList(int flags);
 
         static void renderList(struct buf* ob, const struct buf* text, int flags, void* opaque);
-        void renderList(const ByteBuffer& text, int flags);
+        void renderList(int flags);
 
         // List item
         static void beginListItem(int flags, void* opaque);
         void beginListItem(int flags);
 
         static void renderListItem(struct buf* ob, const struct buf* text, int flags, void* opaque);
-        void renderListItem(const ByteBuffer& text, int flags);
+        void renderListItem(const struct buf* text, int flags);
 
         // Code block
         static void renderBlockCode(struct buf* ob, const struct buf* text, const struct buf* lang, void* opaque);
-        void renderBlockCode(const ByteBuffer& text, const ByteBuffer& language);
+        void renderBlockCode(ByteBuffer text);
 
         // Paragraph
         static void renderParagraph(struct buf* ob, const struct buf* text, void* opaque);
-        void renderParagraph(const ByteBuffer& text);
+        void renderParagraph(ByteBuffer text);
 
         // Horizontal Rule
         static void renderHorizontalRule(struct buf* ob, void* opaque);
@@ -91,14 +124,14 @@ namespace mdp
 
         // HTML
         static void renderHTML(struct buf* ob, const struct buf* text, void* opaque);
-        void renderHTML(const ByteBuffer& text);
+        void renderHTML(ByteBuffer text);
 
         // Quote
         static void beginQuote(void* opaque);
         void beginQuote();
 
         static void renderQuote(struct buf* ob, const struct buf* text, void* opaque);
-        void renderQuote(const std::string& text);
+        void renderQuote(ByteBuffer text);
 
         // Source maps
         static void blockDidParse(const src_map* map, const uint8_t* txt_data, size_t size, void* opaque);
@@ -0,0 +1,258 @@
+//
+//  UTF8.cc
+//  markdownparser
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+#include "UTF8.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MDP_UTF8_X86 1
+#endif
+
+#if defined(MDP_UTF8_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#define MDP_UTF8_TARGET(isa)
+#else
+#include <immintrin.h>
+#define MDP_UTF8_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+using namespace mdp;
+
+/* UTF-8 continuation byte has the form 10xxxxxx */
+#define UTF8_IS_CONTINUATION(byte) (((byte)&0xC0) == 0x80)
+
+/* Number of bits set */
+static inline size_t PopCount(uint64_t value)
+{
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<size_t>((value * 0x0101010101010101ULL) >> 56);
+}
+
+/* Portable implementation, classifies 8 bytes at a time in a 64-bit word */
+static size_t CountScalar(const char* data, size_t length)
+{
+    size_t count = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        ::memcpy(&word, data + i, sizeof(word));
+
+        // High bit set and the next one clear marks a continuation byte
+        uint64_t continuation = word & ~(word << 1) & 0x8080808080808080ULL;
+        count += 8 - PopCount(continuation);
+    }
+
+    for (; i < length; ++i) {
+        if (!UTF8_IS_CONTINUATION(data[i]))
+            ++count;
+    }
+
+    return count;
+}
+
+#if defined(MDP_UTF8_X86)
+
+/*
+ *  The vectorized implementations compare bytes as signed integers, a
+ *  continuation byte (0x80 - 0xBF) is less than -64 (0xC0). Matches are
+ *  accumulated per byte lane for at most 255 rounds and then summed.
+ */
+
+MDP_UTF8_TARGET("sse2") static size_t CountSSE2(const char* data, size_t length)
+{
+    const __m128i threshold = _mm_set1_epi8(-64);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t count = 0;
+    size_t i = 0;
+
+    while (length - i >= 16) {
+        size_t rounds = std::min<size_t>((length - i) / 16, 255);
+        __m128i continuations = zero;
+
+        for (size_t r = 0; r < rounds; ++r, i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            continuations = _mm_sub_epi8(continuations, _mm_cmplt_epi8(bytes, threshold));
+        }
+
+        __m128i sums = _mm_sad_epu8(continuations, zero);
+        size_t total = static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_extract_epi16(sums, 4));
+
+        count += rounds * 16 - total;
+    }
+
+    return count + CountScalar(data + i, length - i);
+}
+
+MDP_UTF8_TARGET("avx2") static size_t CountAVX2(const char* data, size_t length)
+{
+    const __m256i threshold = _mm256_set1_epi8(-64);
+    const __m256i zero = _mm256_setzero_si256();
+
+    size_t count = 0;
+    size_t i = 0;
+
+    while (length - i >= 32) {
+        size_t rounds = std::min<size_t>((length - i) / 32, 255);
+        __m256i continuations = zero;
+
+        for (size_t r = 0; r < rounds; ++r, i += 32) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            continuations = _mm256_sub_epi8(continuations, _mm256_cmpgt_epi8(threshold, bytes));
+        }
+
+        uint64_t sums[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(continuations, zero));
+
+        count += rounds * 32 - static_cast<size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+    }
+
+    return count + CountScalar(data + i, length - i);
+}
+
+#if defined(_MSC_VER)
+
+static bool CPUSupports(UTF8CountingMethod method)
+{
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+
+    if (maxLeaf < 1)
+        return false;
+
+    __cpuid(info, 1);
+
+    if (method == SSE2UTF8CountingMethod)
+        return (info[3] & (1 << 26)) != 0;
+
+    // AVX2 needs OS support for saving the YMM registers
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+
+    if (!osxsave || !avx || maxLeaf < 7 || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+}
+
+#else
+
+static bool CPUSupports(UTF8CountingMethod method)
+{
+    __builtin_cpu_init();
+
+    if (method == SSE2UTF8CountingMethod)
+        return __builtin_cpu_supports("sse2");
+
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+#endif // MDP_UTF8_X86
+
+typedef size_t (*CountFunction)(const char*, size_t);
+
+static CountFunction CountFunctionForMethod(UTF8CountingMethod method)
+{
+#if defined(MDP_UTF8_X86)
+    switch (method) {
+        case AVX2UTF8CountingMethod:
+            return CountAVX2;
+
+        case SSE2UTF8CountingMethod:
+            return CountSSE2;
+
+        default:
+            break;
+    }
+#endif
+
+    return CountScalar;
+}
+
+static UTF8CountingMethod BestMethod()
+{
+    if (IsUTF8CountingMethodSupported(AVX2UTF8CountingMethod))
+        return AVX2UTF8CountingMethod;
+
+    if (IsUTF8CountingMethodSupported(SSE2UTF8CountingMethod))
+        return SSE2UTF8CountingMethod;
+
+    return ScalarUTF8CountingMethod;
+}
+
+/* Selected during static initialization, before any parsing can start */
+static UTF8CountingMethod selectedMethod = BestMethod();
+static CountFunction selectedFunction = CountFunctionForMethod(selectedMethod);
+
+bool mdp::IsUTF8CountingMethodSupported(UTF8CountingMethod method)
+{
+    switch (method) {
+        case ScalarUTF8CountingMethod:
+            return true;
+
+#if defined(MDP_UTF8_X86)
+        case SSE2UTF8CountingMethod:
+        case AVX2UTF8CountingMethod:
+            return CPUSupports(method);
+#endif
+
+        default:
+            return false;
+    }
+}
+
+size_t mdp::CountUTF8Characters(const char* data, size_t length)
+{
+    if (!data || !length)
+        return 0;
+
+    return selectedFunction(data, length);
+}
+
+size_t mdp::CountUTF8Characters(const char* data, size_t length, UTF8CountingMethod method)
+{
+    if (!data || !length)
+        return 0;
+
+    if (method == AutoUTF8CountingMethod)
+        method = selectedMethod;
+    else if (!IsUTF8CountingMethodSupported(method))
+        method = ScalarUTF8CountingMethod;
+
+    return CountFunctionForMethod(method)(data, length);
+}
+
+UTF8CountingMethod mdp::SelectUTF8CountingMethod(UTF8CountingMethod method)
+{
+    if (method == AutoUTF8CountingMethod)
+        method = BestMethod();
+    else if (!IsUTF8CountingMethodSupported(method))
+        method = ScalarUTF8CountingMethod;
+
+    selectedMethod = method;
+    selectedFunction = CountFunctionForMethod(method);
+
+    return selectedMethod;
+}
+
+UTF8CountingMethod mdp::SelectedUTF8CountingMethod()
+{
+    return selectedMethod;
+}
@@ -0,0 +1,61 @@
+//
+//  UTF8.h
+//  markdownparser
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef MARKDOWNPARSER_UTF8_H
+#define MARKDOWNPARSER_UTF8_H
+
+#include <cstddef>
+
+namespace mdp
+{
+
+    /**
+     *  UTF-8 character counting implementations
+     */
+    enum UTF8CountingMethod
+    {
+        ScalarUTF8CountingMethod = 0, /// < Portable, 8 bytes at a time
+        SSE2UTF8CountingMethod,       /// < x86 SSE2, 16 bytes at a time
+        AVX2UTF8CountingMethod,       /// < x86 AVX2, 32 bytes at a time
+        AutoUTF8CountingMethod = -1   /// < Best method supported by the CPU
+    };
+
+    /**
+     *  \brief  Count UTF-8 characters in a block of bytes
+     *
+     *  Counts the non-continuation bytes, which equals the number of
+     *  characters for well-formed UTF-8. The block is not expected to be
+     *  NUL-terminated and NUL bytes are counted as characters.
+     *
+     *  Uses the method selected by `SelectUTF8CountingMethod()`, by default
+     *  the best method supported by the CPU detected at runtime.
+     */
+    size_t CountUTF8Characters(const char* data, size_t length);
+
+    /** Count UTF-8 characters using given method, scalar if the method is not supported */
+    size_t CountUTF8Characters(const char* data, size_t length, UTF8CountingMethod method);
+
+    /** True if given counting method is supported by the CPU */
+    bool IsUTF8CountingMethodSupported(UTF8CountingMethod method);
+
+    /**
+     *  \brief  Select the method used by `CountUTF8Characters()`
+     *
+     *  Not thread-safe, intended to be used before any parsing starts
+     *  (e.g. by benchmarks). Unsupported methods fall back to the scalar
+     *  one, `AutoUTF8CountingMethod` restores the default.
+     *
+     *  \return The method actually selected
+     */
+    UTF8CountingMethod SelectUTF8CountingMethod(UTF8CountingMethod method);
+
+    /** \return Method currently used by `CountUTF8Characters()` */
+    UTF8CountingMethod SelectedUTF8CountingMethod();
+}
+
+#endif
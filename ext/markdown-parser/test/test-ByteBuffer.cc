@@ -6,6 +6,7 @@
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
 
+#include <cstring>
 #include "catch.hpp"
 #include "MarkdownParser.h"
 
@@ -180,3 +181,120 @@ TEST_CASE("Byte buffer and Index should return equal char ranges", "[bytebuffer]
     REQUIRE(charMap[4].location == indexMap[4].location);
     REQUIRE(charMap[4].length == indexMap[4].length);
 }
+
+TEST_CASE("Character index spanning multiple blocks", "[bytebuffer][sourcemap]")
+{
+    // $¢€𐍈 (byte length - 1, 2, 3, 4)
+    const char* characters[] = { "\x24", "\xc2\xa2", "\xe2\x82\xac", "\xf0\x90\x8d\x88" };
+
+    ByteBuffer src;
+    std::vector<size_t> expected;
+    std::vector<size_t> offsets;
+
+    for (size_t i = 0; i < 2000; ++i) {
+        const char* character = characters[(i * 7) % 4];
+        offsets.push_back(src.length());
+        src += character;
+        expected.insert(expected.end(), ::strlen(character), i);
+    }
+
+    ByteBufferCharacterIndex index;
+    mdp::BuildCharacterIndex(index, src);
+
+    // Built on the first lookup only
+    REQUIRE(!index.isBuilt());
+    REQUIRE(index.size() == src.length());
+    REQUIRE(index.size() > ByteBufferCharacterIndex::BlockSize * 10);
+
+    for (size_t i = 0; i < src.length(); ++i) {
+        INFO("byte " << i);
+        REQUIRE(index[i] == expected[i]);
+    }
+
+    REQUIRE(index.isBuilt());
+
+    BytesRangeSet byteMap;
+    byteMap.push_back(Range(0, src.length()));
+    byteMap.push_back(Range(offsets[25], offsets[60] - offsets[25]));
+    byteMap.push_back(Range(offsets[100], 1000));
+
+    CharactersRangeSet charMap = BytesRangeSetToCharactersRangeSet(byteMap, src);
+    CharactersRangeSet indexMap = BytesRangeSetToCharactersRangeSet(byteMap, index);
+
+    REQUIRE(indexMap.size() == 3);
+    REQUIRE(indexMap[0].location == 0);
+    REQUIRE(indexMap[0].length == 2000);
+
+    for (size_t i = 0; i < charMap.size(); ++i) {
+        REQUIRE(charMap[i].location == indexMap[i].location);
+        REQUIRE(charMap[i].length == indexMap[i].length);
+    }
+}
+
+TEST_CASE("Character index stops at NUL byte", "[bytebuffer][sourcemap]")
+{
+    ByteBuffer src("a\xc2\xa2" "b", 4);
+    src += '\0';
+    src += "cd";
+
+    ByteBufferCharacterIndex index;
+    mdp::BuildCharacterIndex(index, src);
+
+    REQUIRE(index.size() == 7);
+    REQUIRE(index[0] == 0);
+    REQUIRE(index[1] == 1);
+    REQUIRE(index[2] == 1);
+    REQUIRE(index[3] == 2);
+    REQUIRE(index[4] == 0);
+    REQUIRE(index[5] == 0);
+    REQUIRE(index[6] == 0);
+}
+
+TEST_CASE("Empty character index", "[bytebuffer][sourcemap]")
+{
+    ByteBufferCharacterIndex index;
+    REQUIRE(index.empty());
+
+    ByteBuffer src;
+    mdp::BuildCharacterIndex(index, src);
+    REQUIRE(index.empty());
+
+    BytesRangeSet byteMap;
+    byteMap.push_back(Range(0, 10));
+
+    CharactersRangeSet indexMap = BytesRangeSetToCharactersRangeSet(byteMap, index);
+    REQUIRE(indexMap.size() == 1);
+    REQUIRE(indexMap[0].location == 0);
+    REQUIRE(indexMap[0].length == 0);
+}
+
+TEST_CASE("Ranges of bytes not NUL terminated", "[bytebuffer][sourcemap]")
+{
+    // "Příliš" followed by bytes past the data
+    ByteBuffer src = "\x50\xC5\x99\xC3\xAD\x6C\x69\xC5\xA1 past";
+    size_t length = 9;
+
+    BytesRangeSet rangeSet;
+    rangeSet.push_back(BytesRange(1, 4));
+    rangeSet.push_back(BytesRange(7, 10));
+
+    CharactersRangeSet charMap = BytesRangeSetToCharactersRangeSet(rangeSet, src.data(), length);
+    REQUIRE(charMap.size() == 2);
+    REQUIRE(charMap[0].location == 1);
+    REQUIRE(charMap[0].length == 2);
+    REQUIRE(charMap[1].location == 5);
+    REQUIRE(charMap[1].length == 1);
+
+    ByteBufferCharacterIndex index;
+    BuildCharacterIndex(index, src.data(), length);
+
+    REQUIRE(index.size() == length);
+    REQUIRE(index[8] == 5);
+
+    BytesRangeSet lastLine;
+    lastLine.push_back(BytesRange(5, 5));
+
+    // Sundown adds a newline past the data
+    REQUIRE(MapBytesRangeSet(lastLine, src.data(), length) == "\x6C\x69\xC5\xA1");
+    REQUIRE(MapBytesRangeSet(rangeSet, src.data(), length).empty());
+}
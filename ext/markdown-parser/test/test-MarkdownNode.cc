@@ -0,0 +1,101 @@
+//
+//  test-MarkdownNode.cc
+//  markdownparser
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "catch.hpp"
+#include "MarkdownNode.h"
+
+using namespace mdp;
+
+TEST_CASE("Move node with children", "[node]")
+{
+    MarkdownNode node(ListItemMarkdownNodeType, NULL, "list item", 1);
+    node.children().emplace_back(ParagraphMarkdownNodeType, &node, "paragraph");
+    node.children().emplace_back(CodeMarkdownNodeType, &node, "code");
+    node.sourceMap.push_back(BytesRange(0, 10));
+
+    const char* text = node.children().front().text.c_str();
+
+    MarkdownNode moved(std::move(node));
+
+    REQUIRE(moved.type == ListItemMarkdownNodeType);
+    REQUIRE(moved.text == "list item");
+    REQUIRE(moved.data == 1);
+    REQUIRE(moved.sourceMap.size() == 1);
+    REQUIRE(moved.children().size() == 2);
+
+    // Children are not copied and point to their new parent
+    REQUIRE(moved.children().front().text.c_str() == text);
+    REQUIRE(&moved.children().front().parent() == &moved);
+    REQUIRE(&moved.children().back().parent() == &moved);
+}
+
+TEST_CASE("Move assign node with children", "[node]")
+{
+    MarkdownNode node(QuoteMarkdownNodeType, NULL, "quote");
+    node.children().emplace_back(ParagraphMarkdownNodeType, &node, "paragraph");
+
+    MarkdownNode assigned;
+    assigned = std::move(node);
+
+    REQUIRE(assigned.type == QuoteMarkdownNodeType);
+    REQUIRE(assigned.text == "quote");
+    REQUIRE(assigned.children().size() == 1);
+    REQUIRE(assigned.children().front().text == "paragraph");
+    REQUIRE(&assigned.children().front().parent() == &assigned);
+}
+
+TEST_CASE("Copy node with children", "[node]")
+{
+    MarkdownNode node(QuoteMarkdownNodeType, NULL, "quote");
+    node.children().emplace_back(ParagraphMarkdownNodeType, &node, "paragraph");
+
+    MarkdownNode copy(node);
+
+    REQUIRE(copy.text == "quote");
+    REQUIRE(copy.children().size() == 1);
+    REQUIRE(copy.children().front().text == "paragraph");
+
+    REQUIRE(node.text == "quote");
+    REQUIRE(node.children().size() == 1);
+}
+
+TEST_CASE("Parent pointers survive growing the children", "[node]")
+{
+    MarkdownNode root(RootMarkdownNodeType);
+
+    for (size_t i = 0; i < 100; ++i) {
+        root.children().emplace_back(ListItemMarkdownNodeType, &root);
+
+        MarkdownNode& item = root.children().back();
+        item.children().emplace_back(ParagraphMarkdownNodeType, &item, "item");
+    }
+
+    // Artificial paragraph inserted in front, as the parser does for list items
+    root.children().emplace(root.children().begin(), ParagraphMarkdownNodeType, &root, "first");
+
+    REQUIRE(root.children().size() == 101);
+    REQUIRE(root.children().front().text == "first");
+
+    for (MarkdownNodes::iterator it = root.children().begin(); it != root.children().end(); ++it) {
+        REQUIRE(&it->parent() == &root);
+
+        for (MarkdownNodes::iterator child = it->children().begin(); child != it->children().end(); ++child)
+            REQUIRE(&child->parent() == &*it);
+    }
+}
+
+TEST_CASE("Leaf node has no children", "[node]")
+{
+    MarkdownNode node(ParagraphMarkdownNodeType, NULL, "paragraph");
+
+    REQUIRE(node.children().empty());
+    REQUIRE(node.children().capacity() == 0);
+
+    const MarkdownNode& constNode = node;
+    REQUIRE(constNode.children().empty());
+}
@@ -753,3 +753,51 @@ TEST_CASE("Empty quota in listitem", "[parser]")
     REQUIRE(list.children()[1].children()[0].children()[0].sourceMap[0].location == 25);
     REQUIRE(list.children()[1].children()[0].children()[0].sourceMap[0].length == 3);
 }
+
+TEST_CASE("Cancel parsing", "[parser][cancel]")
+{
+    MarkdownParser parser;
+    MarkdownNode ast;
+
+    ByteBuffer src = "# A\n\nParagraph\n\n# B\n\nParagraph\n\n# C\n";
+
+    REQUIRE(parser.parse(src, ast, []() { return false; }));
+    REQUIRE(ast.children().size() == 5);
+
+    int checks = 0;
+    REQUIRE_FALSE(parser.parse(src, ast, [&checks]() { return ++checks > 2; }));
+
+    REQUIRE(checks == 3);
+    REQUIRE(ast.type == RootMarkdownNodeType);
+    REQUIRE(ast.children().size() < 5);
+
+    // Not cancelled by the previous parse
+    REQUIRE(parser.parse(src, ast));
+    REQUIRE(ast.children().size() == 5);
+}
+
+TEST_CASE("Parse source bytes in place", "[parser][sourcemap]")
+{
+    MarkdownParser parser;
+    MarkdownNode ast;
+
+    ByteBuffer src = "# A\n\nParagraph\n\n# B\n\n+ item\n";
+    ByteBuffer data = src + "\n# Past the source data\n";
+
+    parser.parse(data.data(), src.length(), ast);
+
+    MarkdownNode expected;
+    parser.parse(src, expected);
+
+    REQUIRE(ast.sourceMap.size() == 1);
+    REQUIRE(ast.sourceMap[0].length == src.length());
+    REQUIRE(ast.children().size() == expected.children().size());
+
+    for (size_t i = 0; i < ast.children().size(); ++i) {
+        REQUIRE(ast.children()[i].type == expected.children()[i].type);
+        REQUIRE(ast.children()[i].text == expected.children()[i].text);
+        REQUIRE(ast.children()[i].sourceMap.size() == expected.children()[i].sourceMap.size());
+        REQUIRE(ast.children()[i].sourceMap[0].location == expected.children()[i].sourceMap[0].location);
+        REQUIRE(ast.children()[i].sourceMap[0].length == expected.children()[i].sourceMap[0].length);
+    }
+}
@@ -0,0 +1,111 @@
+//
+//  test-UTF8.cc
+//  markdownparser
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <string>
+#include "catch.hpp"
+#include "UTF8.h"
+
+using namespace mdp;
+
+static const UTF8CountingMethod Methods[]
+    = { ScalarUTF8CountingMethod, SSE2UTF8CountingMethod, AVX2UTF8CountingMethod, AutoUTF8CountingMethod };
+
+/* Reference implementation, one byte at a time */
+static size_t CountCharacters(const std::string& s, size_t offset, size_t length)
+{
+    size_t count = 0;
+
+    for (size_t i = offset; i < offset + length; ++i) {
+        if ((s[i] & 0xC0) != 0x80)
+            ++count;
+    }
+
+    return count;
+}
+
+static void RequireMethodsAgree(const std::string& s)
+{
+    // Lengths and offsets around the 8, 16 and 32 byte strides
+    for (size_t offset = 0; offset < 33 && offset < s.length(); ++offset) {
+        size_t remaining = s.length() - offset;
+
+        for (size_t length = 0; length <= remaining; length += (length < 80 ? 1 : 61)) {
+            size_t expected = CountCharacters(s, offset, length);
+
+            for (size_t m = 0; m < sizeof(Methods) / sizeof(Methods[0]); ++m) {
+                INFO("method " << Methods[m] << " offset " << offset << " length " << length);
+                REQUIRE(CountUTF8Characters(s.data() + offset, length, Methods[m]) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Count ASCII characters", "[utf8]")
+{
+    std::string s;
+    for (size_t i = 0; i < 9000; ++i)
+        s += static_cast<char>('a' + i % 26);
+
+    REQUIRE(CountUTF8Characters(s.data(), s.length()) == s.length());
+    RequireMethodsAgree(s);
+}
+
+TEST_CASE("Count multi-byte characters", "[utf8]")
+{
+    // $¢€𐍈 (byte length - 1, 2, 3, 4)
+    const char* characters[] = { "\x24", "\xc2\xa2", "\xe2\x82\xac", "\xf0\x90\x8d\x88" };
+
+    std::string s;
+    for (size_t i = 0; i < 4000; ++i)
+        s += characters[(i * 7) % 4];
+
+    REQUIRE(CountUTF8Characters(s.data(), s.length()) == 4000);
+    RequireMethodsAgree(s);
+}
+
+TEST_CASE("Count arbitrary bytes", "[utf8]")
+{
+    // Every byte value including NUL and malformed sequences
+    std::string s;
+    unsigned int seed = 2026;
+    for (size_t i = 0; i < 9000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        s += static_cast<char>((seed >> 16) & 0xFF);
+    }
+
+    RequireMethodsAgree(s);
+}
+
+TEST_CASE("Count empty block", "[utf8]")
+{
+    REQUIRE(CountUTF8Characters(NULL, 0) == 0);
+    REQUIRE(CountUTF8Characters("abc", 0) == 0);
+    REQUIRE(CountUTF8Characters(NULL, 0, ScalarUTF8CountingMethod) == 0);
+}
+
+TEST_CASE("Select counting method", "[utf8]")
+{
+    UTF8CountingMethod initial = SelectedUTF8CountingMethod();
+
+    REQUIRE(IsUTF8CountingMethodSupported(ScalarUTF8CountingMethod));
+    REQUIRE(IsUTF8CountingMethodSupported(initial));
+
+    REQUIRE(SelectUTF8CountingMethod(ScalarUTF8CountingMethod) == ScalarUTF8CountingMethod);
+    REQUIRE(SelectedUTF8CountingMethod() == ScalarUTF8CountingMethod);
+    REQUIRE(CountUTF8Characters("\xc2\xa2\x24", 3) == 2);
+
+    // Unsupported methods fall back to scalar
+    UTF8CountingMethod avx2 = SelectUTF8CountingMethod(AVX2UTF8CountingMethod);
+    if (IsUTF8CountingMethodSupported(AVX2UTF8CountingMethod))
+        REQUIRE(avx2 == AVX2UTF8CountingMethod);
+    else
+        REQUIRE(avx2 == ScalarUTF8CountingMethod);
+
+    REQUIRE(SelectUTF8CountingMethod(AutoUTF8CountingMethod) == initial);
+    REQUIRE(SelectedUTF8CountingMethod() == initial);
+}
@@ -53,7 +53,9 @@
         'ext/markdown-parser/src/MarkdownNode.cc',
         'ext/markdown-parser/src/MarkdownNode.h',
         'ext/markdown-parser/src/MarkdownParser.cc',
-        'ext/markdown-parser/src/MarkdownParser.h'
+        'ext/markdown-parser/src/MarkdownParser.h',
+        'ext/markdown-parser/src/UTF8.cc',
+        'ext/markdown-parser/src/UTF8.h'
       ],
       'dependencies': [
         'libsundown'
@@ -74,7 +76,10 @@
       'sources': [
         'src/HTTP.cc',
         'src/HTTP.h',
+        'src/Instrumentation.cc',
+        'src/Instrumentation.h',
         'src/MSON.cc',
+        'src/MSONDependencyGraph.cc',
         'src/MSONOneOfParser.cc',
         'src/MSONSourcemap.cc',
         'src/MSONTypeSectionParser.cc',
@@ -95,15 +100,19 @@
         'src/AssetParser.h',
         'src/AttributesParser.h',
         'src/Blueprint.h',
+        'src/BlueprintIndex.h',
         'src/BlueprintParser.h',
+        'src/BlueprintSegmentCache.h',
         'src/BlueprintSourcemap.h',
         'src/BlueprintUtility.h',
         'src/CodeBlockUtility.h',
         'src/DataStructureGroupParser.h',
         'src/HeadersParser.h',
         'src/HeadersParser.cc',
+        'src/MappedFile.h',
         'src/ModelTable.h',
         'src/MSON.h',
+        'src/MSONDependencyGraph.h',
         'src/MSONSourcemap.h',
         'src/MSONMixinParser.h',
         'src/MSONNamedTypeParser.h',
@@ -115,6 +124,9 @@
         'src/MSONValueMemberParser.h',
         'src/ParameterParser.h',
         'src/ParametersParser.h',
+        'src/ParseCache.cc',
+        'src/ParseCache.h',
+        'src/ParseLimits.h',
         'src/Platform.h',
         'src/RegexMatch.h',
         'src/RelationParser.h',
@@ -122,15 +134,21 @@
         'src/ResourceParser.h',
         'src/SectionParser.h',
         'src/SectionProcessor.h',
+        'src/Serialization.cc',
+        'src/Serialization.h',
         'src/SignatureSectionProcessor.h',
         'src/SourceAnnotation.h',
+        'src/SourceMapUtility.h',
         'src/StringUtility.h',
+        'src/SymbolTable.h',
         'src/ValuesParser.h',
+        'src/WorkerPool.cc',
+        'src/WorkerPool.h',
       ],
       'conditions': [
         [ 'OS=="win"',
-          { 'sources': [ 'src/win/RegexMatch.cc' ] },
-          { 'sources': [ 'src/posix/RegexMatch.cc' ] } # OS != Windows
+          { 'sources': [ 'src/win/MappedFile.cc', 'src/win/RegexMatch.cc' ] },
+          { 'sources': [ 'src/posix/MappedFile.cc', 'src/posix/RegexMatch.cc' ] } # OS != Windows
         ]
       ],
       'dependencies': [
@@ -153,7 +171,9 @@
         'test/test-DataStructureGroupParser.cc',
         'test/test-HeadersParser.cc',
         'test/test-Indentation.cc',
+        'test/test-Instrumentation.cc',
         'test/test-ModelTable.cc',
+        'test/test-MSONDependencyGraph.cc',
         'test/test-MSONMixinParser.cc',
         'test/test-MSONNamedTypeParser.cc',
         'test/test-MSONOneOfParser.cc',
@@ -164,6 +184,7 @@
         'test/test-MSONValueMemberParser.cc',
         'test/test-ParameterParser.cc',
         'test/test-ParametersParser.cc',
+        'test/test-ParseCache.cc',
         'test/test-PayloadParser.cc',
         'test/test-RegexMatch.cc',
         'test/test-RelationParser.cc',
@@ -176,6 +197,7 @@
         'test/test-UriTemplateParser.cc',
         'test/test-ValuesParser.cc',
         'test/test-Warnings.cc',
+        'test/test-WorkerPool.cc',
         'test/test-snowcrash.cc'
       ],
       'dependencies': [
@@ -191,6 +213,53 @@
       'dependencies': [
         'libsnowcrash',
       ]
+    },
+    {
+      'target_name': 'perf-duplicates',
+      'type': 'executable',
+      'sources': [
+        'test/performance/perf-duplicates.cc'
+      ],
+      'dependencies': [
+        'libsnowcrash',
+      ]
+    },
+    {
+      'target_name': 'perf-validate',
+      'type': 'executable',
+      'sources': [
+        'test/performance/perf-validate.cc'
+      ],
+      'dependencies': [
+        'libsnowcrash',
+      ]
+    },
+    {
+      'target_name': 'perf-benchmark',
+      'type': 'executable',
+      'sources': [
+        'test/performance/perf-benchmark.cc'
+      ],
+      'dependencies': [
+        'libsnowcrash',
+      ]
+    },
+    {
+      'target_name': 'perf-generate',
+      'type': 'executable',
+      'sources': [
+        'test/performance/perf-generate.cc'
+      ]
+    },
+    {
+      'target_name': 'perf-bytebuffer',
+      'type': 'executable',
+      'sources': [
+        'test/performance/perf-bytebuffer.cc'
+      ],
+      'dependencies': [
+        'libmarkdownparser',
+      ]
     }
   ]
 }
@@ -96,10 +96,6 @@ namespace snowcrash
 
             SectionType sectionType = pd.sectionContext();
             MarkdownNodeIterator cur = node;
-            std::stringstream ss;
-
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
 
             switch (sectionType) {
                 case RelationSectionType: {
@@ -129,12 +125,13 @@ namespace snowcrash
                         }
                     }
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    checkPayload(sectionType, node->sourceMap, payload.node, pd, out);
 
-                    out.node.examples.back().requests.push_back(payload.node);
+                    out.node.examples.back().requests.push_back(std::move(payload.node));
 
                     if (pd.exportSourceMap()) {
-                        out.sourceMap.examples.collection.back().requests.collection.push_back(payload.sourceMap);
+                        out.sourceMap.examples.collection.back().requests.collection.push_back(
+                            std::move(payload.sourceMap));
                     }
 
                     break;
@@ -157,12 +154,13 @@ namespace snowcrash
                         }
                     }
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    checkPayload(sectionType, node->sourceMap, payload.node, pd, out);
 
-                    out.node.examples.back().responses.push_back(payload.node);
+                    out.node.examples.back().responses.push_back(std::move(payload.node));
 
                     if (pd.exportSourceMap()) {
-                        out.sourceMap.examples.collection.back().responses.collection.push_back(payload.sourceMap);
+                        out.sourceMap.examples.collection.back().responses.collection.push_back(
+                            std::move(payload.sourceMap));
                     }
 
                     break;
@@ -239,14 +237,15 @@ namespace snowcrash
             if (assetType != UndefinedSectionType) {
 
                 // WARN: Ignoring section
-                std::stringstream ss;
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-
-                ss << "Ignoring " << SectionName(assetType) << " list item, ";
-                ss << SectionName(assetType) << " list item is expected to be indented by 4 spaces or 1 tab";
+                std::string name = SectionName(assetType);
 
-                out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    IgnoringWarning,
+                    node->sourceMap,
+                    "Ignoring %s list item, %s list item is expected to be indented by 4 spaces or 1 tab",
+                    name,
+                    name);
 
                 return ++MarkdownNodeIterator(node);
             }
@@ -276,36 +275,43 @@ namespace snowcrash
 
             SectionType nestedType = UndefinedSectionType;
 
+            // Only confirm the keyword sections the node might match
+            KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+            if (candidates == NoKeywordCandidate) {
+                return UndefinedSectionType;
+            }
+
             // Check if relation section
-            nestedType = SectionProcessor<Relation>::sectionType(node);
+            nestedType = CandidateSectionType<Relation>(node, candidates, RelationKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = CandidateSectionType<Parameters>(node, candidates, ParametersKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = CandidateSectionType<Headers>(node, candidates, HeadersKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if attributes section
-            nestedType = SectionProcessor<Attributes>::sectionType(node);
+            nestedType = CandidateSectionType<Attributes>(node, candidates, AttributesKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if payload section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = CandidateSectionType<Payload>(node, candidates, PayloadKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -340,26 +346,27 @@ namespace snowcrash
             if (out.node.examples.empty()) {
 
                 // WARN: No response for action
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(
-                    Warning("action is missing a response", EmptyDefinitionWarning, sourceMap));
+                ReportWarning(out.report, pd, EmptyDefinitionWarning, node->sourceMap, "action is missing a response");
             } else if (!out.node.examples.empty() && !out.node.examples.back().requests.empty()
                 && out.node.examples.back().responses.empty()) {
 
                 // WARN: No response for request
-                std::stringstream ss;
-                ss << "action is missing a response for ";
-
-                if (out.node.examples.back().requests.back().name.empty()) {
-                    ss << "a request";
+                const std::string& name = out.node.examples.back().requests.back().name;
+
+                if (name.empty()) {
+                    ReportWarning(out.report,
+                        pd,
+                        EmptyDefinitionWarning,
+                        node->sourceMap,
+                        "action is missing a response for a request");
                 } else {
-                    ss << "the '" << out.node.examples.back().requests.back().name << "' request";
+                    ReportWarning(out.report,
+                        pd,
+                        EmptyDefinitionWarning,
+                        node->sourceMap,
+                        "action is missing a response for the '%s' request",
+                        name);
                 }
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
             }
         }
 
@@ -368,23 +375,27 @@ namespace snowcrash
          *  \param  sectionType A section of the payload.
          *  \param  sourceMap   Payload signature source map.
          *  \param  payload     The payload to be checked.
-         *  \param  action      The Action to which payload belongs to.
-         *  \param  report      Parser report.
+         *  \param  pd          Parser data.
+         *  \param  out         The Action to which payload belongs to.
          */
         static void checkPayload(SectionType sectionType,
-            const mdp::CharactersRangeSet sourceMap,
+            const mdp::BytesRangeSet& sourceMap,
             const Payload& payload,
+            const SectionParserData& pd,
             const ParseResultRef<Action>& out)
         {
 
             if (isPayloadDuplicate(sectionType, payload, out.node.examples.back())) {
 
                 // WARN: Duplicate payload
-                std::stringstream ss;
-                ss << SectionName(sectionType) << " payload `" << payload.name << "`";
-                ss << " already defined for `" << out.node.method << "` method";
-
-                out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    DuplicateWarning,
+                    sourceMap,
+                    "%s payload `%s` already defined for `%s` method",
+                    SectionName(sectionType),
+                    payload.name,
+                    out.node.method);
             }
 
             if (sectionType == ResponseSectionType || sectionType == ResponseBodySectionType) {
@@ -402,18 +413,23 @@ namespace snowcrash
                     // WARN: Edge case for 2xx CONNECT
                     if (out.node.method == HTTPMethodName::Connect && code / 100 == 2) {
 
-                        std::stringstream ss;
-                        ss << "the response for " << code << " " << out.node.method << " request MUST NOT include a "
-                           << SectionName(BodySectionType);
-
-                        out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            EmptyDefinitionWarning,
+                            sourceMap,
+                            "the response for %s %s request MUST NOT include a %s",
+                            code,
+                            out.node.method,
+                            SectionName(BodySectionType));
                     } else if (out.node.method != HTTPMethodName::Connect && !methodTraits.allowBody) {
 
-                        std::stringstream ss;
-                        ss << "the response for " << out.node.method << " request MUST NOT include a "
-                           << SectionName(BodySectionType);
-
-                        out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            EmptyDefinitionWarning,
+                            sourceMap,
+                            "the response for %s request MUST NOT include a %s",
+                            out.node.method,
+                            SectionName(BodySectionType));
                     }
 
                     return;
@@ -452,13 +468,12 @@ namespace snowcrash
             MarkdownNodeIterator cur = HeadersParser::parse(node, siblings, pd, out);
 
             // WARN: Deprecated header sections
-            std::stringstream ss;
-            ss << "the 'headers' section at this level is deprecated and will be removed in a future, use respective "
-                  "payload header section(s) instead";
-
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-            out.report.warnings.push_back(Warning(ss.str(), DeprecatedWarning, sourceMap));
+            ReportWarning(out.report,
+                pd,
+                DeprecatedWarning,
+                node->sourceMap,
+                "the 'headers' section at this level is deprecated and will be removed in a future, use respective "
+                "payload header section(s) instead");
 
             return cur;
         }
@@ -532,18 +547,17 @@ namespace snowcrash
         static void checkForTypoMistake(const MarkdownNodeIterator& node, SectionParserData& pd, Report& report)
         {
 
-            if (node->type != mdp::HeaderMarkdownNodeType) {
+            if (node->type != mdp::HeaderMarkdownNodeType || pd.isWarningSuppressed(URIWarning)) {
                 return;
             }
 
             if (RegexMatch(node->text, NamedActionNonAbsoluteURIRegex)) {
-                std::stringstream ss;
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-
-                ss << "URI path in '" << node->text << "' is not absolute, it should have a leading forward slash";
-
-                report.warnings.push_back(Warning(ss.str(), URIWarning, sourceMap));
+                ReportWarning(report,
+                    pd,
+                    URIWarning,
+                    node->sourceMap,
+                    "URI path in '%s' is not absolute, it should have a leading forward slash",
+                    node->text);
             }
         }
     };
@@ -12,6 +12,7 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <memory>
 #include "Platform.h"
 #include "MarkdownNode.h"
 #include "MSON.h"
@@ -193,6 +194,9 @@ namespace snowcrash
 
         /** Assignment operator for Named Type */
         DataStructure& operator=(const mson::NamedType& rhs);
+
+        /** Move assignment operator for Named Type */
+        DataStructure& operator=(mson::NamedType&& rhs);
     };
 
     /**
@@ -420,13 +424,20 @@ namespace snowcrash
             /** Copy constructor */
             Content(const Element::Content& rhs);
 
+            /** Move constructor */
+            Content(Element::Content&& rhs) noexcept;
+
             /** Assignment operator */
             Content& operator=(const Element::Content& rhs);
 
+            /** Move assignment operator */
+            Content& operator=(Element::Content&& rhs) noexcept;
+
             /** Destructor */
             ~Content();
 
         private:
+            /** Allocated on the first modification, NULL while empty */
             std::unique_ptr<Elements> m_elements;
         };
 
@@ -456,9 +467,15 @@ namespace snowcrash
         /** Copy constructor */
         Element(const Element& rhs);
 
+        /** Move constructor */
+        Element(Element&& rhs) noexcept;
+
         /** Assignment operator */
         Element& operator=(const Element& rhs);
 
+        /** Move assignment operator */
+        Element& operator=(Element&& rhs) noexcept;
+
         /** Destructor */
         ~Element();
     };
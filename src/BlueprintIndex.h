@@ -0,0 +1,128 @@
+//
+//  BlueprintIndex.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTINDEX_H
+#define SNOWCRASH_BLUEPRINTINDEX_H
+
+#include <unordered_set>
+#include "Blueprint.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Index of the names defined by a blueprint being parsed
+     *
+     *  Used to look up duplicate resources, resource groups and named types
+     *  without scanning the blueprint. Filled in as the top-level elements
+     *  are appended to the blueprint, resources are added as soon as they
+     *  are appended to the group being parsed.
+     */
+    struct BlueprintIndex {
+
+        BlueprintIndex() {}
+
+        /** Index of the elements of a blueprint */
+        explicit BlueprintIndex(const Blueprint& blueprint)
+        {
+            for (Elements::const_iterator it = blueprint.content.elements().begin();
+                 it != blueprint.content.elements().end();
+                 ++it) {
+                add(*it);
+            }
+        }
+
+        /** URI templates of the resources */
+        std::unordered_set<URITemplate> resources;
+
+        /** Names of the resource groups, empty one for an anonymous group */
+        std::unordered_set<mdp::ByteBuffer> resourceGroups;
+
+        /** Names of the named types, i.e. data structures and resource attributes */
+        std::unordered_set<mson::Literal> namedTypes;
+
+        /** Add a top-level element of the blueprint */
+        void add(const Element& element)
+        {
+            if (element.element != Element::CategoryElement) {
+                return;
+            }
+
+            if (element.category == Element::ResourceGroupCategory) {
+                resourceGroups.insert(element.attributes.name);
+            }
+
+            for (Elements::const_iterator it = element.content.elements().begin();
+                 it != element.content.elements().end();
+                 ++it) {
+
+                if (it->element == Element::ResourceElement) {
+                    resources.insert(it->content.resource.uriTemplate);
+                    namedTypes.insert(it->content.resource.attributes.name.symbol.literal);
+                } else if (it->element == Element::DataStructureElement) {
+                    namedTypes.insert(it->content.dataStructure.name.symbol.literal);
+                }
+            }
+        }
+
+        /** Add all the names of another index */
+        void add(const BlueprintIndex& index)
+        {
+            resources.insert(index.resources.begin(), index.resources.end());
+            resourceGroups.insert(index.resourceGroups.begin(), index.resourceGroups.end());
+            namedTypes.insert(index.namedTypes.begin(), index.namedTypes.end());
+        }
+
+        /** Add a resource of the group being parsed */
+        void addResource(const URITemplate& uri)
+        {
+            resources.insert(uri);
+        }
+
+        /** Remove all the names */
+        void clear()
+        {
+            resources.clear();
+            resourceGroups.clear();
+            namedTypes.clear();
+        }
+
+        /** \return True if there are no names */
+        bool empty() const
+        {
+            return resources.empty() && resourceGroups.empty() && namedTypes.empty();
+        }
+
+        /** \return True if both indexes have the same names */
+        bool operator==(const BlueprintIndex& other) const
+        {
+            return resources == other.resources && resourceGroups == other.resourceGroups
+                && namedTypes == other.namedTypes;
+        }
+
+        /** \return True if a resource with the URI template exists */
+        bool isResourceDuplicate(const URITemplate& uri) const
+        {
+            return resources.find(uri) != resources.end();
+        }
+
+        /** \return True if a resource group with the name exists */
+        bool isResourceGroupDuplicate(const mdp::ByteBuffer& name) const
+        {
+            return resourceGroups.find(name) != resourceGroups.end();
+        }
+
+        /** \return True if a named type with the name exists */
+        bool isNamedTypeDuplicate(const mson::Literal& name) const
+        {
+            return namedTypes.find(name) != namedTypes.end();
+        }
+    };
+}
+
+#endif
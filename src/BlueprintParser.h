@@ -17,15 +17,71 @@
 #include "SectionParser.h"
 #include "RegexMatch.h"
 #include "CodeBlockUtility.h"
+#include "WorkerPool.h"
 
 namespace snowcrash
 {
 
     const char* const ExpectedAPINameMessage = "expected API name, e.g. '# <API Name>'";
 
+    /** Source maps delivered to a visitor when they are not exported, see `SectionProcessor<Blueprint>::visitGroup()` */
+    const SourceMap<Element> EmptyElementSourceMap = SourceMap<Element>();
+    const SourceMap<Action> EmptyActionSourceMap = SourceMap<Action>();
+    const SourceMap<TransactionExample> EmptyTransactionExampleSourceMap = SourceMap<TransactionExample>();
+
     /** Internal type alias for Collection iterator of Metadata */
     typedef Collection<Metadata>::iterator MetadataCollectionIterator;
 
+    /**
+     *  \brief Part of the blueprint parsed in parallel
+     *
+     *  A range of the top-level Markdown nodes starting with a group or a
+     *  data structures section, along with the result of its parsing.
+     */
+    struct BlueprintSegment {
+
+        explicit BlueprintSegment(const MarkdownNodeIterator& begin_)
+            : begin(begin_), end(begin_), parsed(false), reused(false), kept(false), reparse(false), reparsed(false)
+        {
+        }
+
+        /** First node of the segment */
+        MarkdownNodeIterator begin;
+
+        /** First node of the next segment */
+        MarkdownNodes::const_iterator end;
+
+        /** True if parsed exactly up to the next segment, or reused */
+        bool parsed;
+
+        /** True if taken over from the segment cache, its elements are in the cache then */
+        bool reused;
+
+        /** Result of parsing on its own */
+        BlueprintSegmentResult result;
+
+        /** True if the elements of a reused segment are merged as they are */
+        bool kept;
+
+        /** True if to be parsed again with the earlier segments, see `SectionProcessor<Blueprint>::joinSegments()` */
+        bool reparse;
+
+        /** Models of the earlier segments referenced by the segment, to be parsed again with */
+        ModelTable earlierModelTable;
+
+        /** Source maps of the models of the earlier segments referenced by the segment */
+        ModelSourceMapTable earlierModelSourceMapTable;
+
+        /** True if parsed again exactly up to the next segment */
+        bool reparsed;
+
+        /** Result of parsing again, merged instead of the result of parsing on its own */
+        BlueprintSegmentResult reparsedResult;
+    };
+
+    /** Collection of blueprint segments */
+    typedef std::vector<BlueprintSegment> BlueprintSegments;
+
     /**
      * Blueprint processor
      */
@@ -93,6 +149,16 @@ namespace snowcrash
             return ++MarkdownNodeIterator(cur);
         }
 
+        static MarkdownNodeIterator processDescription(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<Blueprint>& out)
+        {
+
+            // Missing API name is reported if there is a description
+            return appendDescription(node, pd, out);
+        }
+
         static MarkdownNodeIterator processNestedSection(const MarkdownNodeIterator& node,
             const MarkdownNodes& siblings,
             SectionParserData& pd,
@@ -101,49 +167,197 @@ namespace snowcrash
 
             MarkdownNodeIterator cur = node;
 
+            // Memory of the group is released once it is visited and dropped
+            size_t memory = pd.memory ? pd.memory->current() : 0;
+
             if (pd.sectionContext() == ResourceGroupSectionType || pd.sectionContext() == ResourceSectionType) {
 
                 IntermediateParseResult<ResourceGroup> resourceGroup(out.report);
                 cur = ResourceGroupParser::parse(node, siblings, pd, resourceGroup);
 
-                if (isResourceGroupDuplicate(out.node, resourceGroup.node.attributes.name)) {
+                if (pd.blueprintIndex.isResourceGroupDuplicate(resourceGroup.node.attributes.name)) {
 
                     // WARN: duplicate resource group
-                    std::stringstream ss;
-
                     if (resourceGroup.node.attributes.name.empty()) {
-                        ss << "anonymous group";
+                        ReportWarning(
+                            out.report, pd, DuplicateWarning, node->sourceMap, "anonymous group is already defined");
                     } else {
-                        ss << "group '" << resourceGroup.node.attributes.name << "'";
+                        ReportWarning(out.report,
+                            pd,
+                            DuplicateWarning,
+                            node->sourceMap,
+                            "group '%s' is already defined",
+                            resourceGroup.node.attributes.name);
                     }
+                }
 
-                    ss << " is already defined";
+                pd.blueprintIndex.add(resourceGroup.node);
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                if (pd.validateOnly() && !pd.visitor) {
+                    pruneGroup(resourceGroup.node);
                 }
 
-                out.node.content.elements().push_back(resourceGroup.node);
+                out.node.content.elements().push_back(std::move(resourceGroup.node));
 
                 if (pd.exportSourceMap()) {
-                    out.sourceMap.content.elements().collection.push_back(resourceGroup.sourceMap);
+                    out.sourceMap.content.elements().collection.push_back(std::move(resourceGroup.sourceMap));
+                }
+
+                if (pd.visitor) {
+                    visitLastGroup(pd, out, memory);
                 }
             } else if (pd.sectionContext() == DataStructureGroupSectionType) {
 
                 IntermediateParseResult<DataStructureGroup> dataStructureGroup(out.report);
                 cur = DataStructureGroupParser::parse(node, siblings, pd, dataStructureGroup);
 
-                out.node.content.elements().push_back(dataStructureGroup.node);
+                pd.blueprintIndex.add(dataStructureGroup.node);
+
+                if (pd.validateOnly() && !pd.visitor) {
+                    pruneGroup(dataStructureGroup.node);
+                }
+
+                out.node.content.elements().push_back(std::move(dataStructureGroup.node));
 
                 if (pd.exportSourceMap()) {
-                    out.sourceMap.content.elements().collection.push_back(dataStructureGroup.sourceMap);
+                    out.sourceMap.content.elements().collection.push_back(std::move(dataStructureGroup.sourceMap));
+                }
+
+                if (pd.visitor) {
+                    visitLastGroup(pd, out, memory);
                 }
             }
 
             return cur;
         }
 
+        /**
+         *  \brief Drop the parts of a parsed group which are not checked anymore
+         *
+         *  Names in the group are already indexed, only the resources with
+         *  a pending reference are kept to be checked by `checkLazyReferencing()`.
+         *
+         *  \param group        Group to prune
+         *  \param sourceMap    Source map of the group to prune along, NULL if not exported
+         */
+        static void pruneGroup(Element& group, SourceMap<Element>* sourceMap = NULL)
+        {
+
+            Elements& elements = group.content.elements();
+            Collection<SourceMap<Element> >::type* elementsSourceMap
+                = sourceMap ? &sourceMap->content.elements().collection : NULL;
+
+            size_t kept = 0;
+
+            for (size_t i = 0; i < elements.size(); ++i) {
+
+                if (elements[i].element != Element::ResourceElement
+                    || !hasPendingReference(elements[i].content.resource)) {
+                    continue;
+                }
+
+                if (kept != i) {
+                    elements[kept] = std::move(elements[i]);
+
+                    if (elementsSourceMap && i < elementsSourceMap->size()) {
+                        (*elementsSourceMap)[kept] = std::move((*elementsSourceMap)[i]);
+                    }
+                }
+
+                ++kept;
+            }
+
+            elements.erase(elements.begin() + kept, elements.end());
+
+            if (elementsSourceMap && kept < elementsSourceMap->size()) {
+                elementsSourceMap->erase(elementsSourceMap->begin() + kept, elementsSourceMap->end());
+            }
+        }
+
+        /** \return Source map of an item of a collection, \a empty if there are no source maps */
+        template <typename T>
+        static const T& sourceMapAt(const std::vector<T>& collection, size_t index, const T& empty)
+        {
+            return index < collection.size() ? collection[index] : empty;
+        }
+
+        /**
+         *  \brief Deliver a parsed group to the visitor and drop it
+         *
+         *  Resources with a pending reference are kept, see `pruneGroup()`.
+         *
+         *  \param group        Group to visit
+         *  \param sourceMap    Source map of the group, NULL if not exported
+         *  \param pd           Parser data with the visitor
+         */
+        static void visitGroup(Element& group, SourceMap<Element>* sourceMap, SectionParserData& pd)
+        {
+
+            BlueprintVisitor& visitor = *pd.visitor;
+            const Elements& elements = group.content.elements();
+            const SourceMap<Element>& groupSourceMap = sourceMap ? *sourceMap : EmptyElementSourceMap;
+            const Collection<SourceMap<Element> >::type& elementsSourceMap
+                = groupSourceMap.content.elements().collection;
+
+            if (group.category == Element::ResourceGroupCategory) {
+                visitor.visitResourceGroup(group, groupSourceMap);
+            }
+
+            for (size_t i = 0; i < elements.size(); ++i) {
+
+                const SourceMap<Element>& elementSourceMap = sourceMapAt(elementsSourceMap, i, EmptyElementSourceMap);
+
+                if (elements[i].element == Element::ResourceElement) {
+                    visitResource(elements[i].content.resource, elementSourceMap.content.resource, visitor);
+                } else if (elements[i].element == Element::DataStructureElement) {
+                    visitor.visitDataStructure(
+                        elements[i].content.dataStructure, elementSourceMap.content.dataStructure);
+                }
+            }
+
+            pruneGroup(group, sourceMap);
+        }
+
+        /** Deliver a resource, its actions and their transaction examples to the visitor */
+        static void visitResource(
+            const Resource& resource, const SourceMap<Resource>& sourceMap, BlueprintVisitor& visitor)
+        {
+
+            visitor.visitResource(resource, sourceMap);
+
+            for (size_t i = 0; i < resource.actions.size(); ++i) {
+
+                const Action& action = resource.actions[i];
+                const SourceMap<Action>& actionSourceMap
+                    = sourceMapAt(sourceMap.actions.collection, i, EmptyActionSourceMap);
+
+                visitor.visitAction(action, actionSourceMap);
+
+                for (size_t j = 0; j < action.examples.size(); ++j) {
+                    visitor.visitTransactionExample(action.examples[j],
+                        sourceMapAt(actionSourceMap.examples.collection, j, EmptyTransactionExampleSourceMap));
+                }
+            }
+        }
+
+        /**
+         *  \brief Visit the group added last to the blueprint and drop it
+         *  \param memory   Memory used before the group was parsed, released if nothing of the group is kept
+         */
+        static void visitLastGroup(SectionParserData& pd, const ParseResultRef<Blueprint>& out, size_t memory)
+        {
+
+            Element& group = out.node.content.elements().back();
+            SourceMap<Element>* sourceMap
+                = pd.exportSourceMap() ? &out.sourceMap.content.elements().collection.back() : NULL;
+
+            visitGroup(group, sourceMap, pd);
+
+            if (pd.memory && group.content.elements().empty() && pd.memory->current() > memory) {
+                pd.memory->release(pd.memory->current() - memory);
+            }
+        }
+
         /**
          * Look ahead through all the nested sections and gather list of all
          * named types along with their base types and the types they are sub-typed from
@@ -221,6 +435,720 @@ namespace snowcrash
             resolveNamedTypeTables(pd, out.report);
         }
 
+        /**
+         *  \brief Parse top-level groups in parallel if `ParallelParsingOption` is set
+         *
+         *  Top-level nodes are split into segments, each starting with a group
+         *  or a data structures section. Every segment is parsed by a worker
+         *  with its own parser data, sharing the named type tables and the
+         *  character index with \a pd. The segments are then joined, see
+         *  `joinSegments()`, those referring to the models or names of the
+         *  earlier segments are parsed again with them, and the results are
+         *  merged in the document order. If a segment fails to parse or the
+         *  blueprint has an error, nothing is merged and the blueprint is
+         *  parsed sequentially instead, to report the same error.
+         *
+         *  With a segment cache, segments are parsed the same way, even with
+         *  a single worker. Segments found in the cache are not parsed again,
+         *  their elements are taken over from the cache unless the earlier
+         *  segments they depend on are changed, and the merged segments
+         *  replace the cache.
+         */
+        static bool parseNestedSectionsInParallel(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<Blueprint>& out,
+            MarkdownNodeIterator& cur)
+        {
+
+            bool parallel = (pd.options & ParallelParsingOption) != 0;
+
+            if (!parallel && !pd.segmentCache)
+                return false;
+
+            // The cache is left empty unless the segments are merged
+            BlueprintSegmentResults cachedSegments;
+
+            if (pd.segmentCache) {
+                cachedSegments.swap(pd.segmentCache->segments);
+            }
+
+            if (node == siblings.end())
+                return false;
+
+            // Everything checked against earlier segments is expected to be empty at this point
+            if (out.report.error.code != Error::OK || !pd.modelTable.empty() || !pd.modelSourceMapTable.empty()
+                || !out.node.content.elements().empty()) {
+                return false;
+            }
+
+            BlueprintSegments segments;
+            segments.push_back(BlueprintSegment(node));
+
+            for (MarkdownNodeIterator it = node + 1; it != siblings.end(); ++it) {
+
+                SectionType type = nestedSectionType(it);
+
+                if (type == ResourceGroupSectionType || type == DataStructureGroupSectionType) {
+                    segments.back().end = it;
+                    segments.push_back(BlueprintSegment(it));
+                }
+            }
+
+            segments.back().end = siblings.end();
+
+            if (segments.size() < 2)
+                return false;
+
+            bool located = locateSegments(segments, siblings, pd);
+            bool cacheValid = located && pd.segmentCache && isSegmentCacheValid(*pd.segmentCache, pd);
+
+            if (cacheValid) {
+                reuseCachedSegments(segments, cachedSegments);
+            }
+
+            std::vector<size_t> pending;
+
+            // Memory of the segments is released if they are dropped
+            size_t memory = pd.memory ? pd.memory->current() : 0;
+
+            for (size_t i = 0; i < segments.size(); ++i) {
+                if (!segments[i].parsed)
+                    pending.push_back(i);
+            }
+
+            runSegmentTasks(segments, pending, siblings, pd, parseSegment);
+
+            ModelTable modelTable;
+            ModelSourceMapTable modelSourceMapTable;
+            BlueprintIndex blueprintIndex;
+
+            bool joined = joinSegments(segments, pd, modelTable, modelSourceMapTable, blueprintIndex);
+
+            // Segments depending on the earlier ones are parsed again in their context
+            pending.clear();
+
+            for (size_t i = 0; joined && i < segments.size(); ++i) {
+                if (segments[i].reparse)
+                    pending.push_back(i);
+            }
+
+            runSegmentTasks(segments, pending, siblings, pd, reparseSegment);
+
+            for (size_t i = 0; joined && i < pending.size(); ++i) {
+                joined = segments[pending[i]].reparsed;
+            }
+
+            if (!joined) {
+
+                if (pd.memory && pd.memory->current() > memory)
+                    pd.memory->release(pd.memory->current() - memory);
+
+                return false;
+            }
+
+            pd.modelTable.swap(modelTable);
+            pd.modelSourceMapTable.swap(modelSourceMapTable);
+            pd.blueprintIndex = std::move(blueprintIndex);
+
+            mergeSegments(segments, pd, out);
+
+            if (located && pd.segmentCache) {
+                cacheSegments(segments, pd, cacheValid, *pd.segmentCache);
+            }
+
+            // Segments are visited only once all of them are merged
+            if (pd.visitor) {
+
+                Elements& elements = out.node.content.elements();
+
+                for (size_t i = 0; i < elements.size(); ++i) {
+                    visitGroup(elements[i],
+                        pd.exportSourceMap() ? &out.sourceMap.content.elements().collection[i] : NULL,
+                        pd);
+                }
+            }
+
+            // All the nodes are parsed
+            cur = node + (siblings.end() - node);
+            return true;
+        }
+
+        /**
+         *  \brief Fill in byte offsets and lengths of the segments
+         *  \return False if a segment has no source map, the segments cannot be cached then
+         */
+        static bool locateSegments(
+            BlueprintSegments& segments, const MarkdownNodes& siblings, const SectionParserData& pd)
+        {
+
+            size_t end = pd.sourceData.length();
+
+            for (BlueprintSegments::reverse_iterator it = segments.rbegin(); it != segments.rend(); ++it) {
+
+                if (it->begin->sourceMap.empty() || it->begin->sourceMap.front().location > end) {
+                    return false;
+                }
+
+                it->result.location = it->begin->sourceMap.front().location;
+                it->result.length = end - it->result.location;
+
+                end = it->result.location;
+            }
+
+            return true;
+        }
+
+        /** \return True if the cached segments were parsed with the same named types */
+        static bool isSegmentCacheValid(const BlueprintSegmentCache& cache, const SectionParserData& pd)
+        {
+
+            if (cache.namedTypeBaseTable != pd.namedTypeBaseTable
+                || cache.namedTypeDependencyGraph != pd.namedTypeDependencyGraph()
+                || cache.namedTypeInheritanceTable.size() != pd.namedTypeInheritanceTable.size()) {
+                return false;
+            }
+
+            // Source maps of the inheritance table are only used by the preprocessing
+            mson::NamedTypeInheritanceTable::const_iterator it = cache.namedTypeInheritanceTable.begin();
+            mson::NamedTypeInheritanceTable::const_iterator pdIt = pd.namedTypeInheritanceTable.begin();
+
+            for (; it != cache.namedTypeInheritanceTable.end(); ++it, ++pdIt) {
+
+                if (it->first != pdIt->first || it->second.first != pdIt->second.first) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /** Take over results of the cached segments at the same place and of the same length */
+        static void reuseCachedSegments(BlueprintSegments& segments, BlueprintSegmentResults& cachedSegments)
+        {
+
+            BlueprintSegmentResults::iterator cached = cachedSegments.begin();
+
+            for (BlueprintSegments::iterator it = segments.begin(); it != segments.end(); ++it) {
+
+                while (cached != cachedSegments.end() && cached->location < it->result.location) {
+                    ++cached;
+                }
+
+                if (cached != cachedSegments.end() && cached->location == it->result.location
+                    && cached->length == it->result.length) {
+
+                    it->result = std::move(*cached);
+                    it->parsed = true;
+                    it->reused = true;
+                }
+            }
+        }
+
+        /** Replace the cached segments with the merged ones, their elements are in the blueprint */
+        static void cacheSegments(
+            BlueprintSegments& segments, const SectionParserData& pd, bool cacheValid, BlueprintSegmentCache& cache)
+        {
+
+            cache.segments.clear();
+            cache.segments.reserve(segments.size());
+
+            for (BlueprintSegments::iterator it = segments.begin(); it != segments.end(); ++it) {
+                cache.segments.push_back(std::move(it->result));
+            }
+
+            // Named types of a valid cache are the same
+            if (!cacheValid) {
+                cache.namedTypeBaseTable = pd.namedTypeBaseTable;
+                cache.namedTypeInheritanceTable = pd.namedTypeInheritanceTable;
+                cache.namedTypeDependencyGraph = pd.namedTypeDependencyGraph();
+            }
+        }
+
+        /** Task run for a segment, see `runSegmentTasks()` */
+        typedef void (*SegmentTask)(BlueprintSegment&, const MarkdownNodes&, const SectionParserData&);
+
+        /** Run a task for each of the segments at the indexes, on the workers if parsing in parallel */
+        static void runSegmentTasks(BlueprintSegments& segments,
+            const std::vector<size_t>& indexes,
+            const MarkdownNodes& siblings,
+            const SectionParserData& pd,
+            SegmentTask task)
+        {
+
+            if (indexes.empty())
+                return;
+
+            bool parallel = (pd.options & ParallelParsingOption) != 0 && indexes.size() > 1;
+
+            // Shared by the workers, has to be built before they start, otherwise built only if used
+            if (parallel) {
+                pd.sourceCharacterIndex.build();
+            }
+
+            RunTasks(indexes.size(), parallel ? 0 : 1, [&](size_t i) { task(segments[indexes[i]], siblings, pd); });
+        }
+
+        /** Parse a segment on its own with parser data sharing the tables of \a parent, run by a worker */
+        static void parseSegment(
+            BlueprintSegment& segment, const MarkdownNodes& siblings, const SectionParserData& parent)
+        {
+
+            segment.parsed = parseSegmentResult(segment, siblings, parent, false, segment.result);
+        }
+
+        /** Parse a segment again with the models and the names of the earlier segments it depends on */
+        static void reparseSegment(
+            BlueprintSegment& segment, const MarkdownNodes& siblings, const SectionParserData& parent)
+        {
+
+            segment.reparsed = parseSegmentResult(segment, siblings, parent, true, segment.reparsedResult)
+                && segment.reparsedResult.report.error.code == Error::OK;
+        }
+
+        /**
+         *  \brief Parse a segment into the result
+         *
+         *  Parsed on its own, the result records what the segment defines and
+         *  refers to, which does not depend on the earlier segments. Parsed
+         *  again, the segment is parsed with the earlier models and names
+         *  found by `joinSegments()`.
+         *
+         *  \return True if parsed exactly up to the next segment
+         */
+        static bool parseSegmentResult(const BlueprintSegment& segment,
+            const MarkdownNodes& siblings,
+            const SectionParserData& parent,
+            bool reparse,
+            BlueprintSegmentResult& result)
+        {
+
+            try {
+                SectionParserData pd(parent, result.node);
+                ParseResultRef<Blueprint> out(result.report, result.node, result.sourceMap);
+
+                // Segments are checked against each other in full, they are pruned when merged
+                pd.options &= ~ValidateOnlyOption;
+
+                if (reparse) {
+                    pd.modelTable = segment.earlierModelTable;
+                    pd.modelSourceMapTable = segment.earlierModelSourceMapTable;
+                    pd.blueprintIndex = segment.result.earlierNames;
+                } else {
+                    pd.addedDependencies = &result.addedDependencies;
+                }
+
+                MarkdownNodeIterator cur = SectionParser<Blueprint, BlueprintSectionAdapter>::parseNestedSectionRange(
+                    segment.begin, segment.end, siblings, pd, out);
+
+                if (!reparse) {
+                    result.modelTable.swap(pd.modelTable);
+                    result.modelSourceMapTable.swap(pd.modelSourceMapTable);
+                    result.index = BlueprintIndex(result.node);
+                    findPendingReferences(result.node, result.pendingReferences);
+                }
+
+                return cur == segment.end;
+            } catch (...) {
+
+                // Sequential parsing reports the failure
+                return false;
+            }
+        }
+
+        /** Append items of a collection to another one, moving them */
+        template <typename T>
+        static void appendCollection(T& collection, T& items)
+        {
+            collection.insert(
+                collection.end(), std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+            items.clear();
+        }
+
+        /**
+         *  \brief Merge joined segments into the blueprint in the document order
+         *
+         *  Elements of the kept segments are moved from the segment cache,
+         *  the others from their results. Models and the blueprint index of
+         *  \a pd are expected to be joined already, see `joinSegments()`.
+         */
+        static void mergeSegments(
+            BlueprintSegments& segments, SectionParserData& pd, const ParseResultRef<Blueprint>& out)
+        {
+
+            Elements& elements = out.node.content.elements();
+            Collection<SourceMap<Element> >::type& elementsSourceMap = out.sourceMap.content.elements().collection;
+
+            for (BlueprintSegments::iterator it = segments.begin(); it != segments.end(); ++it) {
+
+                BlueprintSegmentResult& result = it->result;
+                size_t elementIndex = elements.size();
+
+                if (it->kept) {
+                    takeOverCachedElements(result, *pd.segmentCache, pd, out);
+                } else {
+
+                    BlueprintSegmentResult& merged = it->reparsed ? it->reparsedResult : result;
+
+                    appendCollection(elements, merged.node.content.elements());
+
+                    for (size_t i = elementIndex; pd.validateOnly() && !pd.visitor && i < elements.size(); ++i) {
+                        pruneGroup(elements[i]);
+                    }
+
+                    if (pd.exportSourceMap()) {
+                        appendCollection(elementsSourceMap, merged.sourceMap.content.elements().collection);
+                    }
+
+                    // Warnings of the merged elements are cached
+                    if (it->reparsed) {
+                        result.report = std::move(merged.report);
+                    }
+                }
+
+                out.report.warnings.insert(
+                    out.report.warnings.end(), result.report.warnings.begin(), result.report.warnings.end());
+
+                result.elementIndex = elementIndex;
+                result.elementCount = elements.size() - elementIndex;
+            }
+
+            // Elements of the segments not kept are not needed anymore
+            if (pd.segmentCache) {
+                pd.segmentCache->elements.clear();
+                pd.segmentCache->elementSourceMaps.clear();
+            }
+        }
+
+        /** Move elements of a kept segment from the cache to the blueprint */
+        static void takeOverCachedElements(const BlueprintSegmentResult& result,
+            BlueprintSegmentCache& cache,
+            const SectionParserData& pd,
+            const ParseResultRef<Blueprint>& out)
+        {
+
+            size_t end = result.elementIndex + result.elementCount;
+
+            for (size_t i = result.elementIndex; i < end && i < cache.elements.size(); ++i) {
+                out.node.content.elements().push_back(std::move(cache.elements[i]));
+            }
+
+            for (size_t i = result.elementIndex; pd.exportSourceMap() && i < end && i < cache.elementSourceMaps.size();
+                 ++i) {
+                out.sourceMap.content.elements().collection.push_back(std::move(cache.elementSourceMaps[i]));
+            }
+        }
+
+        /**
+         *  \brief Join segments parsed on their own in the document order
+         *
+         *  Parsed one after another, a segment would see the models, the
+         *  names and the named type dependencies of the earlier segments.
+         *  Models and names defined by a segment do not depend on them, so
+         *  the segments are joined in a single pass over what they define
+         *  and refer to: a segment referring to models of the earlier
+         *  segments, or defining their names again, is to be parsed again
+         *  with just those models and names. A reused segment is kept as
+         *  merged before unless they are changed. Named type dependencies
+         *  added by the segments are replayed on a copy of the graph of \a pd
+         *  in the document order, to find the circular references only found
+         *  sequentially.
+         *
+         *  \param segments             Segments parsed on their own or reused
+         *  \param pd                   Parser data the segments were parsed with
+         *  \param modelTable           Models referenced before they are defined, to be filled in
+         *  \param modelSourceMapTable  Source maps of the models referenced before they are defined, to be filled in
+         *  \param blueprintIndex       Names of all the segments to be filled in
+         *  \return False if a segment is not parsed or the blueprint has an error, it is parsed sequentially then
+         */
+        static bool joinSegments(BlueprintSegments& segments,
+            const SectionParserData& pd,
+            ModelTable& modelTable,
+            ModelSourceMapTable& modelSourceMapTable,
+            BlueprintIndex& blueprintIndex)
+        {
+
+            bool replay = false;
+
+            for (BlueprintSegments::const_iterator it = segments.begin(); it != segments.end(); ++it) {
+
+                if (!it->parsed || it->result.report.error.code != Error::OK) {
+                    return false;
+                }
+
+                // Dependencies of the reused segments are known not to be circular
+                replay = replay || (!it->reused && !it->result.addedDependencies.empty());
+            }
+
+            if (replay && !replayDependencies(segments, pd)) {
+                return false;
+            }
+
+            // Segments defining the models joined so far
+            std::map<Identifier, size_t> models;
+
+            for (size_t i = 0; i < segments.size(); ++i) {
+
+                BlueprintSegment& segment = segments[i];
+                BlueprintSegmentResult& result = segment.result;
+
+                // ERR: model already defined by an earlier segment
+                for (ModelTable::const_iterator it = result.modelTable.begin(); it != result.modelTable.end(); ++it) {
+
+                    if (models.find(it->first) != models.end()) {
+                        return false;
+                    }
+                }
+
+                BlueprintIndex earlierNames;
+                findEarlierNames(result.index, blueprintIndex, earlierNames);
+
+                std::set<Identifier> earlierModels;
+                bool earlierModelChanged = false;
+
+                for (std::set<Identifier>::const_iterator it = result.pendingReferences.begin();
+                     it != result.pendingReferences.end();
+                     ++it) {
+
+                    std::map<Identifier, size_t>::const_iterator modelIt = models.find(*it);
+
+                    if (modelIt != models.end()) {
+                        earlierModels.insert(*it);
+                        earlierModelChanged = earlierModelChanged || !segments[modelIt->second].reused;
+                    }
+                }
+
+                if (segment.reused) {
+
+                    // References to the later models are resolved again
+                    segment.kept = !earlierModelChanged && earlierModels == result.earlierModels
+                        && earlierNames == result.earlierNames && !result.hasForwardReferences();
+                    segment.reparse = !segment.kept;
+                } else {
+                    segment.reparse = !earlierModels.empty() || !earlierNames.empty();
+                }
+
+                result.earlierModels.swap(earlierModels);
+                result.earlierNames = std::move(earlierNames);
+
+                for (std::set<Identifier>::const_iterator it = result.earlierModels.begin();
+                     segment.reparse && it != result.earlierModels.end();
+                     ++it) {
+                    copyModel(segments[models[*it]].result,
+                        *it,
+                        segment.earlierModelTable,
+                        segment.earlierModelSourceMapTable);
+                }
+
+                for (ModelTable::const_iterator it = result.modelTable.begin(); it != result.modelTable.end(); ++it) {
+                    models[it->first] = i;
+                }
+
+                blueprintIndex.add(result.index);
+            }
+
+            // Models referenced before they are defined are resolved once all the segments are merged
+            for (BlueprintSegments::const_iterator it = segments.begin(); it != segments.end(); ++it) {
+
+                if (!it->result.hasForwardReferences()) {
+                    continue;
+                }
+
+                for (std::set<Identifier>::const_iterator referenceIt = it->result.pendingReferences.begin();
+                     referenceIt != it->result.pendingReferences.end();
+                     ++referenceIt) {
+
+                    std::map<Identifier, size_t>::const_iterator modelIt = models.find(*referenceIt);
+
+                    if (modelIt != models.end()) {
+                        copyModel(segments[modelIt->second].result, *referenceIt, modelTable, modelSourceMapTable);
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /** \return False if the dependencies added by the segments make a named type depend on itself */
+        static bool replayDependencies(const BlueprintSegments& segments, const SectionParserData& pd)
+        {
+
+            // The graph is copied only once a dependency is added
+            mson::NamedTypeDependencyGraph graph;
+            bool graphCopied = false;
+
+            for (BlueprintSegments::const_iterator it = segments.begin(); it != segments.end(); ++it) {
+
+                for (mson::NamedTypeDependencies::const_iterator dependencyIt = it->result.addedDependencies.begin();
+                     dependencyIt != it->result.addedDependencies.end();
+                     ++dependencyIt) {
+
+                    const mson::NamedTypeDependencyGraph& joinedGraph
+                        = graphCopied ? graph : pd.namedTypeDependencyGraph();
+
+                    // ERR: circular reference through a dependency of an earlier segment
+                    if (dependencyIt->circularCheck
+                        && (dependencyIt->dependent == dependencyIt->dependency
+                               || joinedGraph.dependsOn(dependencyIt->dependency, dependencyIt->dependent))) {
+                        return false;
+                    }
+
+                    if (!joinedGraph.dependsOn(dependencyIt->dependent, dependencyIt->dependency)) {
+
+                        if (!graphCopied) {
+                            graph = pd.namedTypeDependencyGraph();
+                            graphCopied = true;
+                        }
+
+                        graph.addDependency(dependencyIt->dependent, dependencyIt->dependency);
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /** Copy a model defined by a segment, along with its source map if any */
+        static void copyModel(const BlueprintSegmentResult& result,
+            const Identifier& name,
+            ModelTable& modelTable,
+            ModelSourceMapTable& modelSourceMapTable)
+        {
+
+            ModelTable::const_iterator modelIt = result.modelTable.find(name);
+
+            if (modelIt != result.modelTable.end()) {
+                modelTable.insert(*modelIt);
+            }
+
+            ModelSourceMapTable::const_iterator modelSourceMapIt = result.modelSourceMapTable.find(name);
+
+            if (modelSourceMapIt != result.modelSourceMapTable.end()) {
+                modelSourceMapTable.insert(*modelSourceMapIt);
+            }
+        }
+
+        /** Find the names of a segment defined by the earlier segments, empty names of named types are ignored */
+        static void findEarlierNames(const BlueprintIndex& names, const BlueprintIndex& earlier, BlueprintIndex& found)
+        {
+
+            for (std::unordered_set<mdp::ByteBuffer>::const_iterator it = names.resourceGroups.begin();
+                 it != names.resourceGroups.end();
+                 ++it) {
+
+                if (earlier.isResourceGroupDuplicate(*it)) {
+                    found.resourceGroups.insert(*it);
+                }
+            }
+
+            for (std::unordered_set<URITemplate>::const_iterator it = names.resources.begin();
+                 it != names.resources.end();
+                 ++it) {
+
+                if (earlier.isResourceDuplicate(*it)) {
+                    found.addResource(*it);
+                }
+            }
+
+            for (std::unordered_set<mson::Literal>::const_iterator it = names.namedTypes.begin();
+                 it != names.namedTypes.end();
+                 ++it) {
+
+                if (!it->empty() && earlier.isNamedTypeDuplicate(*it)) {
+                    found.namedTypes.insert(*it);
+                }
+            }
+        }
+
+        /** Find the models the payloads of the blueprint refer to before they are defined */
+        static void findPendingReferences(const Blueprint& blueprint, std::set<Identifier>& references)
+        {
+
+            for (Elements::const_iterator it = blueprint.content.elements().begin();
+                 it != blueprint.content.elements().end();
+                 ++it) {
+
+                for (Elements::const_iterator resourceIt = it->content.elements().begin();
+                     resourceIt != it->content.elements().end();
+                     ++resourceIt) {
+
+                    if (resourceIt->element != Element::ResourceElement) {
+                        continue;
+                    }
+
+                    const Actions& actions = resourceIt->content.resource.actions;
+
+                    for (Actions::const_iterator actionIt = actions.begin(); actionIt != actions.end(); ++actionIt) {
+
+                        for (TransactionExamples::const_iterator exampleIt = actionIt->examples.begin();
+                             exampleIt != actionIt->examples.end();
+                             ++exampleIt) {
+
+                            findPendingReferences(exampleIt->requests, references);
+                            findPendingReferences(exampleIt->responses, references);
+                        }
+                    }
+                }
+            }
+        }
+
+        /** Find the models the payloads refer to before they are defined */
+        static void findPendingReferences(const Collection<Payload>::type& payloads, std::set<Identifier>& references)
+        {
+
+            for (Collection<Payload>::const_iterator it = payloads.begin(); it != payloads.end(); ++it) {
+
+                if (!it->reference.id.empty() && it->reference.meta.state == Reference::StatePending) {
+                    references.insert(it->reference.id);
+                }
+            }
+        }
+
+        /** \return True if one of the payloads of the resource has a pending reference */
+        static bool hasPendingReference(const Resource& resource)
+        {
+
+            for (Actions::const_iterator actionIt = resource.actions.begin(); actionIt != resource.actions.end();
+                 ++actionIt) {
+
+                if (hasPendingReference(*actionIt)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /** \return True if one of the payloads of the action has a pending reference */
+        static bool hasPendingReference(const Action& action)
+        {
+
+            for (TransactionExamples::const_iterator exampleIt = action.examples.begin();
+                 exampleIt != action.examples.end();
+                 ++exampleIt) {
+
+                if (hasPendingReference(exampleIt->requests) || hasPendingReference(exampleIt->responses)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /** \return True if one of the payloads has a pending reference */
+        static bool hasPendingReference(const Collection<Payload>::type& payloads)
+        {
+
+            for (Collection<Payload>::const_iterator it = payloads.begin(); it != payloads.end(); ++it) {
+
+                if (!it->reference.id.empty() && it->reference.meta.state == Reference::StatePending) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         static void checkForPossibleSectionMistakes(
             const MarkdownNodeIterator& node, SectionParserData& pd, Report& report)
         {
@@ -268,6 +1196,12 @@ namespace snowcrash
         {
 
             checkLazyReferencing(pd, out);
+
+            // Resources kept for the lazy referencing are visited by now
+            if (pd.visitor) {
+                dropGroupContent(out);
+            }
+
             out.node.element = Element::CategoryElement;
 
             if (pd.exportSourceMap()) {
@@ -287,9 +1221,23 @@ namespace snowcrash
             } else if (!out.node.description.empty()) {
 
                 // WARN: No API name specified
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ExpectedAPINameMessage, APINameWarning, sourceMap));
+                ReportWarning(out.report, pd, APINameWarning, node->sourceMap, ExpectedAPINameMessage);
+            }
+        }
+
+        /** Drop the content of all the groups of the blueprint */
+        static void dropGroupContent(const ParseResultRef<Blueprint>& out)
+        {
+
+            for (Elements::iterator it = out.node.content.elements().begin(); it != out.node.content.elements().end();
+                 ++it) {
+                it->content.elements().clear();
+            }
+
+            for (Collection<SourceMap<Element> >::iterator it = out.sourceMap.content.elements().collection.begin();
+                 it != out.sourceMap.content.elements().collection.end();
+                 ++it) {
+                it->content.elements().collection.clear();
             }
         }
 
@@ -340,7 +1288,7 @@ namespace snowcrash
             }
 
             // If named type already exists, return error
-            if (pd.namedTypeDependencyTable.find(identifier) != pd.namedTypeDependencyTable.end()) {
+            if (pd.namedTypeDependencyGraph().contains(identifier)) {
 
                 // ERR: Named type is defined more than once
                 std::stringstream ss;
@@ -354,8 +1302,8 @@ namespace snowcrash
 
             mson::BaseTypeName baseTypeName = typeDefinition.typeSpecification.name.base;
 
-            // Initialize an entry in the dependency table
-            pd.namedTypeDependencyTable[identifier] = std::set<mson::Literal>();
+            // Initialize an entry in the dependency graph
+            pd.modifiableNamedTypeDependencyGraph().add(identifier);
 
             // Add the respective entries to the tables
             if (baseTypeName != mson::UndefinedTypeName) {
@@ -369,7 +1317,7 @@ namespace snowcrash
                          ++it) {
 
                         if (!it->symbol.literal.empty() && !it->symbol.variable) {
-                            pd.namedTypeDependencyTable[identifier].insert(it->symbol.literal);
+                            pd.modifiableNamedTypeDependencyGraph().addDirectDependency(identifier, it->symbol.literal);
                         }
                     }
                 }
@@ -380,7 +1328,8 @@ namespace snowcrash
                     = std::make_pair(typeDefinition.typeSpecification.name.symbol.literal, node->sourceMap);
 
                 // Make the sub type dependent on super type
-                pd.namedTypeDependencyTable[identifier].insert(typeDefinition.typeSpecification.name.symbol.literal);
+                pd.modifiableNamedTypeDependencyGraph().addDirectDependency(
+                    identifier, typeDefinition.typeSpecification.name.symbol.literal);
             } else if (typeDefinition.typeSpecification.name.empty()) {
 
                 // If there is no specification, an object is assumed
@@ -396,15 +1345,12 @@ namespace snowcrash
          */
         static void resolveNamedTypeTables(SectionParserData& pd, Report& report)
         {
+            SNOWCRASH_INSTRUMENT_STAGE("resolveNamedTypeTables");
 
-            mson::NamedTypeInheritanceTable::iterator it;
-            mson::NamedTypeDependencyTable::iterator depIt;
-
-            // First resolve dependency tables
-            for (depIt = pd.namedTypeDependencyTable.begin(); depIt != pd.namedTypeDependencyTable.end(); depIt++) {
+            // First resolve dependencies
+            pd.modifiableNamedTypeDependencyGraph().resolve();
 
-                resolveNamedTypeDependencyTableEntry(pd, depIt->first, report);
-            }
+            mson::NamedTypeInheritanceTable::iterator it;
 
             for (it = pd.namedTypeInheritanceTable.begin(); it != pd.namedTypeInheritanceTable.end(); it++) {
 
@@ -416,41 +1362,6 @@ namespace snowcrash
             }
         }
 
-        /**
-         * \brief Resolve the inheritance dependencies of the current named type
-         *        (Does not include mixin or member dependencies)
-         *
-         * \param pd Section parser data
-         * \param identifier The named type whose dependents need to be resolved
-         * \param report Parse report
-         */
-        static void resolveNamedTypeDependencyTableEntry(
-            SectionParserData& pd, const mson::Literal& identifier, Report& report)
-        {
-
-            std::set<mson::Literal> diffDeps, finalDeps, initialDeps;
-
-            do {
-                initialDeps = pd.namedTypeDependencyTable[identifier];
-                diffDeps.clear();
-
-                for (std::set<mson::Literal>::iterator it = initialDeps.begin(); it != initialDeps.end(); it++) {
-
-                    std::set<mson::Literal> superTypeDeps = pd.namedTypeDependencyTable[*it];
-                    pd.namedTypeDependencyTable[identifier].insert(superTypeDeps.begin(), superTypeDeps.end());
-                }
-
-                // Check if the list of dependents has grown
-                finalDeps = pd.namedTypeDependencyTable[identifier];
-                std::set_difference(finalDeps.begin(),
-                    finalDeps.end(),
-                    initialDeps.begin(),
-                    initialDeps.end(),
-                    std::inserter(diffDeps, diffDeps.end()));
-
-            } while (!diffDeps.empty());
-        };
-
         /**
          * \brief For each entry in the named type inheritance table, resolve the sub-type's base type recursively
          *
@@ -475,9 +1386,7 @@ namespace snowcrash
             }
 
             // Check for circular references
-            std::set<mson::Literal> deps = pd.namedTypeDependencyTable[subType];
-
-            if (deps.find(subType) != deps.end()) {
+            if (pd.namedTypeDependencyGraph().isCircular(subType)) {
 
                 // ERR: A named type is circularly referenced
                 std::stringstream ss;
@@ -571,70 +1480,71 @@ namespace snowcrash
                         duplicateKeys.push_back(it->first);
 
                         // WARN: duplicate metadata definition
-                        std::stringstream ss;
-                        ss << "duplicate definition of '" << it->first << "'";
-
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                        out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            DuplicateWarning,
+                            node->sourceMap,
+                            "duplicate definition of '%s'",
+                            it->first);
                     }
                 }
             } else if (!out.node.empty()) {
 
                 // WARN: malformed metadata block
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(
-                    Warning("ignoring possible metadata, expected '<key> : <value>', one one per line",
-                        FormattingWarning,
-                        sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    FormattingWarning,
+                    node->sourceMap,
+                    "ignoring possible metadata, expected '<key> : <value>', one one per line");
             }
         }
 
         /**
-         * \brief Check if a resource group already exists with the given name
-         *
-         * \param blueprint The blueprint which is formed until now
-         * \param name The resource group name to be checked
+         *  \brief  Checks both blueprint and source map AST to resolve references with `Pending` state (Lazy
+         * referencing)
+         *  \param  pd       Section parser state
+         *  \param  out      Processed output
          */
-        static bool isResourceGroupDuplicate(const Blueprint& blueprint, mdp::ByteBuffer& name)
+        static void checkLazyReferencing(SectionParserData& pd, const ParseResultRef<Blueprint>& out)
         {
+            SNOWCRASH_INSTRUMENT_STAGE("checkLazyReferencing");
 
-            for (Elements::const_iterator it = blueprint.content.elements().begin();
-                 it != blueprint.content.elements().end();
-                 ++it) {
+            // Only the merged segments referring to the later models have references left pending
+            if (pd.segmentCache && !pd.segmentCache->segments.empty()) {
 
-                if (it->element == Element::CategoryElement && it->category == Element::ResourceGroupCategory
-                    && it->attributes.name == name) {
+                const BlueprintSegmentResults& segments = pd.segmentCache->segments;
 
-                    return true;
+                for (BlueprintSegmentResults::const_iterator it = segments.begin(); it != segments.end(); ++it) {
+
+                    if (it->hasForwardReferences()) {
+                        checkLazyReferencing(it->elementIndex, it->elementIndex + it->elementCount, pd, out);
+                    }
                 }
+
+                return;
             }
 
-            return false;
+            checkLazyReferencing(0, out.node.content.elements().size(), pd, out);
         }
 
-        /**
-         *  \brief  Checks both blueprint and source map AST to resolve references with `Pending` state (Lazy
-         * referencing)
-         *  \param  pd       Section parser state
-         *  \param  out      Processed output
-         */
-        static void checkLazyReferencing(SectionParserData& pd, const ParseResultRef<Blueprint>& out)
+        /** Resolves references with `Pending` state of the top-level elements in the range */
+        static void checkLazyReferencing(
+            size_t begin, size_t end, SectionParserData& pd, const ParseResultRef<Blueprint>& out)
         {
 
+            Elements& elements = out.node.content.elements();
             Collection<SourceMap<Element> >::iterator elementSourceMapIt;
 
             if (pd.exportSourceMap()) {
-                elementSourceMapIt = out.sourceMap.content.elements().collection.begin();
+                elementSourceMapIt = out.sourceMap.content.elements().collection.begin() + begin;
             }
 
-            for (Elements::iterator elementIt = out.node.content.elements().begin();
-                 elementIt != out.node.content.elements().end();
-                 ++elementIt) {
+            for (size_t i = begin; i < end && i < elements.size(); ++i) {
+
+                CheckParseLimits(pd.limits);
 
-                if (elementIt->element == Element::CategoryElement) {
-                    checkResourceLazyReferencing(*elementIt, elementSourceMapIt, pd, out);
+                if (elements[i].element == Element::CategoryElement) {
+                    checkResourceLazyReferencing(elements[i], elementSourceMapIt, pd, out);
                 }
 
                 if (pd.exportSourceMap()) {
@@ -661,6 +1571,9 @@ namespace snowcrash
                  ++resourceElementIt) {
 
                 if (resourceElementIt->element == Element::ResourceElement) {
+
+                    CheckParseLimits(pd.limits);
+
                     if (pd.exportSourceMap()) {
                         checkActionLazyReferencing(
                             resourceElementIt->content.resource, resourceElementSourceMapIt->content.resource, pd, out);
@@ -692,8 +1605,16 @@ namespace snowcrash
             for (Actions::iterator actionIt = resource.actions.begin(); actionIt != resource.actions.end();
                  ++actionIt) {
 
+                // Actions already visited with a pending reference are visited again
+                bool visit = pd.visitor && hasPendingReference(*actionIt);
+
                 checkExampleLazyReferencing(*actionIt, actionSourceMapIt, pd, out);
 
+                if (visit) {
+                    pd.visitor->visitResolvedAction(
+                        resource, *actionIt, pd.exportSourceMap() ? *actionSourceMapIt : SourceMap<Action>());
+                }
+
                 if (pd.exportSourceMap()) {
                     actionSourceMapIt++;
                 }
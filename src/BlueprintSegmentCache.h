@@ -0,0 +1,117 @@
+//
+//  BlueprintSegmentCache.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTSEGMENTCACHE_H
+#define SNOWCRASH_BLUEPRINTSEGMENTCACHE_H
+
+#include <set>
+#include <vector>
+#include "BlueprintIndex.h"
+#include "BlueprintSourcemap.h"
+#include "ModelTable.h"
+#include "MSONDependencyGraph.h"
+#include "SourceAnnotation.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Result of parsing a blueprint segment
+     *
+     *  A segment is a range of the top-level Markdown nodes starting with
+     *  a group or a data structures section, see `SectionProcessor<Blueprint>`.
+     *  Once merged into the blueprint, the parsed elements are moved there
+     *  and the result keeps only what the segment defines and refers to.
+     */
+    struct BlueprintSegmentResult {
+
+        BlueprintSegmentResult() : location(0), length(0), elementIndex(0), elementCount(0) {}
+
+        /** Byte offset of the segment in the source data */
+        size_t location;
+
+        /** Length of the segment in bytes, up to the next segment */
+        size_t length;
+
+        /** Parsed elements, empty once merged */
+        Blueprint node;
+
+        /** Source map of the parsed elements, empty once merged */
+        SourceMap<Blueprint> sourceMap;
+
+        /** Warnings and error of the segment */
+        Report report;
+
+        /** Models defined by the segment */
+        ModelTable modelTable;
+
+        /** Source maps of the models defined by the segment */
+        ModelSourceMapTable modelSourceMapTable;
+
+        /** Dependencies between named types added by the segment, replayed when merged */
+        mson::NamedTypeDependencies addedDependencies;
+
+        /** Names defined by the segment */
+        BlueprintIndex index;
+
+        /** Models referenced by the segment before they are defined, parsed on its own */
+        std::set<Identifier> pendingReferences;
+
+        /** Names of the earlier segments defined again by the segment, when merged */
+        BlueprintIndex earlierNames;
+
+        /** Models of the earlier segments referenced by the segment, when merged */
+        std::set<Identifier> earlierModels;
+
+        /** Index of the first merged element in the blueprint */
+        size_t elementIndex;
+
+        /** Number of the merged elements */
+        size_t elementCount;
+
+        /** \return True if the segment refers to models of the later segments, resolved once all are merged */
+        bool hasForwardReferences() const
+        {
+            return pendingReferences.size() > earlierModels.size();
+        }
+    };
+
+    /** Collection of blueprint segment results */
+    typedef std::vector<BlueprintSegmentResult> BlueprintSegmentResults;
+
+    /**
+     *  \brief Segments of a previous parse of the same blueprint
+     *
+     *  A segment whose source is not changed by an edit of the blueprint is
+     *  reused instead of parsed again, as long as the named types it was
+     *  parsed with are the same. Its elements are not copied, they are taken
+     *  over from the result of the previous parse, see `reparse()`.
+     */
+    struct BlueprintSegmentCache {
+
+        /** Named types the segments were parsed with */
+        mson::NamedTypeBaseTable namedTypeBaseTable;
+
+        /** Named type inheritance the segments were parsed with */
+        mson::NamedTypeInheritanceTable namedTypeInheritanceTable;
+
+        /** Named type dependencies the segments were parsed with */
+        mson::NamedTypeDependencyGraph namedTypeDependencyGraph;
+
+        /** Parsed segments, in the document order */
+        BlueprintSegmentResults segments;
+
+        /** Elements of the previous parse taken over until the segments are merged */
+        Elements elements;
+
+        /** Source maps of the elements taken over, empty if not exported */
+        Collection<SourceMap<Element> >::type elementSourceMaps;
+    };
+}
+
+#endif
@@ -10,10 +10,13 @@
 
 using namespace snowcrash;
 
+/** Source map of a content without any elements */
+static const SourceMap<Elements> EmptyElements;
+
 SourceMap<Elements>& SourceMap<Element>::Content::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new SourceMap<Elements>);
 
     return *m_elements;
 }
@@ -21,14 +24,13 @@ SourceMap<Elements>& SourceMap<Element>::Content::elements()
 const SourceMap<Elements>& SourceMap<Element>::Content::elements() const
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return EmptyElements;
 
     return *m_elements;
 }
 
 SourceMap<Element>::Content::Content()
 {
-    m_elements.reset(::new SourceMap<Elements>);
 }
 
 SourceMap<Element>::Content::Content(const SourceMap<Element>::Content& rhs)
@@ -36,7 +38,17 @@ SourceMap<Element>::Content::Content(const SourceMap<Element>::Content& rhs)
     this->copy = rhs.copy;
     this->resource = rhs.resource;
     this->dataStructure = rhs.dataStructure;
-    m_elements.reset(::new SourceMap<Elements>(*rhs.m_elements.get()));
+
+    if (rhs.m_elements.get())
+        m_elements.reset(::new SourceMap<Elements>(*rhs.m_elements.get()));
+}
+
+SourceMap<Element>::Content::Content(SourceMap<Element>::Content&& rhs) noexcept
+    : copy(std::move(rhs.copy))
+    , resource(std::move(rhs.resource))
+    , dataStructure(std::move(rhs.dataStructure))
+    , m_elements(std::move(rhs.m_elements))
+{
 }
 
 SourceMap<Element>::Content& SourceMap<Element>::Content::operator=(const SourceMap<Element>::Content& rhs)
@@ -44,7 +56,17 @@ SourceMap<Element>::Content& SourceMap<Element>::Content::operator=(const Source
     this->copy = rhs.copy;
     this->resource = rhs.resource;
     this->dataStructure = rhs.dataStructure;
-    m_elements.reset(::new SourceMap<Elements>(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new SourceMap<Elements>(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+SourceMap<Element>::Content& SourceMap<Element>::Content::operator=(SourceMap<Element>::Content&& rhs) noexcept
+{
+    this->copy = std::move(rhs.copy);
+    this->resource = std::move(rhs.resource);
+    this->dataStructure = std::move(rhs.dataStructure);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -65,6 +87,15 @@ SourceMap<Element>::SourceMap(const SourceMap<Element>& rhs)
     this->category = rhs.category;
 }
 
+// As with the copy constructor, source map of the element itself is left out
+SourceMap<Element>::SourceMap(SourceMap<Element>&& rhs) noexcept
+    : element(rhs.element)
+    , attributes(std::move(rhs.attributes))
+    , content(std::move(rhs.content))
+    , category(rhs.category)
+{
+}
+
 SourceMap<Element>& SourceMap<Element>::operator=(const SourceMap<Element>& rhs)
 {
     this->element = rhs.element;
@@ -75,6 +106,16 @@ SourceMap<Element>& SourceMap<Element>::operator=(const SourceMap<Element>& rhs)
     return *this;
 }
 
+SourceMap<Element>& SourceMap<Element>::operator=(SourceMap<Element>&& rhs) noexcept
+{
+    this->element = rhs.element;
+    this->attributes = std::move(rhs.attributes);
+    this->content = std::move(rhs.content);
+    this->category = rhs.category;
+
+    return *this;
+}
+
 SourceMap<Element>::~SourceMap()
 {
 }
@@ -272,13 +272,20 @@ namespace snowcrash
             /** Copy constructor */
             Content(const SourceMap<Element>::Content& rhs);
 
+            /** Move constructor */
+            Content(SourceMap<Element>::Content&& rhs) noexcept;
+
             /** Assignment operator */
             SourceMap<Element>::Content& operator=(const SourceMap<Element>::Content& rhs);
 
+            /** Move assignment operator */
+            SourceMap<Element>::Content& operator=(SourceMap<Element>::Content&& rhs) noexcept;
+
             /** Destructor */
             ~Content();
 
         private:
+            /** Allocated on the first modification, NULL while empty */
             std::unique_ptr<SourceMap<Elements> > m_elements;
         };
 
@@ -300,9 +307,15 @@ namespace snowcrash
         /** Copy constructor */
         SourceMap(const SourceMap<Element>& rhs);
 
+        /** Move constructor */
+        SourceMap(SourceMap<Element>&& rhs) noexcept;
+
         /** Assignment operator */
         SourceMap<Element>& operator=(const SourceMap<Element>& rhs);
 
+        /** Move assignment operator */
+        SourceMap<Element>& operator=(SourceMap<Element>&& rhs) noexcept;
+
         /** Destructor */
         ~SourceMap();
     };
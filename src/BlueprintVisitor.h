@@ -0,0 +1,67 @@
+//
+//  BlueprintVisitor.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTVISITOR_H
+#define SNOWCRASH_BLUEPRINTVISITOR_H
+
+#include "Blueprint.h"
+#include "BlueprintSourcemap.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Visitor of the parts of a blueprint as they are parsed
+     *
+     *  Every top-level group is visited as soon as it is parsed, then its
+     *  content is dropped. Parts of a group are visited in the document
+     *  order, a resource group first, then each of its resources followed
+     *  by its actions, each followed by its transaction examples. Data
+     *  structures are visited one by one, there is no event for their group.
+     *
+     *  A payload referring to a model defined later in the document is
+     *  visited with the reference pending. Its action is visited again by
+     *  `visitResolvedAction()` at the end of the parse, with the reference
+     *  resolved or, if the model is not defined, unresolved.
+     *
+     *  Source maps are empty unless the blueprint is parsed with
+     *  `ExportSourcemapOption`. The parts are only valid during the call.
+     */
+    struct BlueprintVisitor {
+
+        virtual ~BlueprintVisitor() {}
+
+        /** A resource group with all its content */
+        virtual void visitResourceGroup(const Element& group, const SourceMap<Element>& sourceMap) {}
+
+        /** A resource with all its actions */
+        virtual void visitResource(const Resource& resource, const SourceMap<Resource>& sourceMap) {}
+
+        /** An action of the resource visited last */
+        virtual void visitAction(const Action& action, const SourceMap<Action>& sourceMap) {}
+
+        /** A transaction example of the action visited last */
+        virtual void visitTransactionExample(
+            const TransactionExample& example, const SourceMap<TransactionExample>& sourceMap)
+        {
+        }
+
+        /** A named data structure of a data structures section */
+        virtual void visitDataStructure(const DataStructure& dataStructure, const SourceMap<DataStructure>& sourceMap)
+        {
+        }
+
+        /** An action visited with a pending model reference, once its references are resolved */
+        virtual void visitResolvedAction(
+            const Resource& resource, const Action& action, const SourceMap<Action>& sourceMap)
+        {
+        }
+    };
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include <sstream>
 #include "Section.h"
 #include "StringUtility.h"
+#include "WarningUtility.h"
 
 namespace snowcrash
 {
@@ -61,23 +62,21 @@ namespace snowcrash
             }
 
             // Other blocks, process & warn
-            content += mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+            content += MapSourceData(node->sourceMap, pd);
 
             // WARN: Not a preformatted code block
             size_t level = codeBlockIndentationLevel(pd.parentSectionContext());
-            std::stringstream ss;
-            ss << SectionName(pd.sectionContext());
 
-            if (pd.sectionContext() == BodySectionType) {
-                ss << " asset";
-            }
-
-            ss << " is expected to be a pre-formatted code block, every of its line indented by exactly ";
-            ss << level * 4 << " spaces or " << level << " tabs";
-
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-            report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
+            ReportWarning(report,
+                pd,
+                IndentationWarning,
+                node->sourceMap,
+                "%s%s is expected to be a pre-formatted code block, every of its line indented by exactly "
+                "%s spaces or %s tabs",
+                SectionName(pd.sectionContext()),
+                (pd.sectionContext() == BodySectionType) ? " asset" : "",
+                level * 4,
+                level);
         }
 
         /** \brief  Retrieve the textual content of a signature markdown */
@@ -96,21 +95,17 @@ namespace snowcrash
 
             // WARN: Not a preformatted code block but multiline signature
             size_t level = codeBlockIndentationLevel(pd.parentSectionContext());
-            std::stringstream ss;
-
-            ss << SectionName(pd.sectionContext());
-
-            if (pd.sectionContext() == BodySectionType) {
-                ss << " asset";
-            }
-
-            ss << " is expected to be a pre-formatted code block, separate it by a newline and ";
-            ss << "indent every of its line by ";
-            ss << level * 4 << " spaces or " << level << " tabs";
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-            report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
+            ReportWarning(report,
+                pd,
+                IndentationWarning,
+                node->sourceMap,
+                "%s%s is expected to be a pre-formatted code block, separate it by a newline and "
+                "indent every of its line by %s spaces or %s tabs",
+                SectionName(pd.sectionContext()),
+                (pd.sectionContext() == BodySectionType) ? " asset" : "",
+                level * 4,
+                level);
         }
 
         /**
@@ -121,6 +116,10 @@ namespace snowcrash
             const MarkdownNodeIterator& node, const SectionParserData& pd, Report& report)
         {
 
+            // Nothing else is checked
+            if (pd.isWarningSuppressed(IndentationWarning))
+                return false;
+
             // Check for possible superfluous indentation of a recognized list items.
             mdp::ByteBuffer r;
             mdp::ByteBuffer line = GetFirstLine(node->text, r);
@@ -143,23 +142,24 @@ namespace snowcrash
                 --level;
 
                 // WARN: Superfluous indentation
-                std::stringstream ss;
-                ss << "excessive indentation, ";
-                ss << SectionName(type) << " ";
-
                 if (level) {
-                    ss << "section is expected to be indented by just ";
-                    ss << level * 4 << " spaces or " << level << " tab";
-
-                    if (level > 1)
-                        ss << "s";
+                    ReportWarning(report,
+                        pd,
+                        IndentationWarning,
+                        node->sourceMap,
+                        "excessive indentation, %s section is expected to be indented by just %s spaces or %s tab%s",
+                        SectionName(type),
+                        level * 4,
+                        level,
+                        (level > 1) ? "s" : "");
                 } else {
-                    ss << "section is not expected to be indented";
+                    ReportWarning(report,
+                        pd,
+                        IndentationWarning,
+                        node->sourceMap,
+                        "excessive indentation, %s section is not expected to be indented",
+                        SectionName(type));
                 }
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
             }
 
             return false;
@@ -203,7 +203,7 @@ namespace snowcrash
             if (node->type == mdp::CodeMarkdownNodeType) {
                 asset = node->text;
             } else {
-                asset = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+                asset = MapSourceData(node->sourceMap, pd);
             }
 
             TwoNewLines(asset);
@@ -218,13 +218,14 @@ namespace snowcrash
 
             if (level) {
                 // WARN: Dangling asset
-                std::stringstream ss;
-                ss << "dangling message-body asset, expected a pre-formatted code block, ";
-                ss << "indent every of it's line by " << level * 4 << " spaces or " << level << " tabs";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
+                ReportWarning(report,
+                    pd,
+                    IndentationWarning,
+                    node->sourceMap,
+                    "dangling message-body asset, expected a pre-formatted code block, "
+                    "indent every of it's line by %s spaces or %s tabs",
+                    level * 4,
+                    level);
             }
 
             return asset;
@@ -245,14 +246,14 @@ namespace snowcrash
 
             if (GetModelReference(source, symbol)) {
 
-                std::stringstream ss;
-                ss << "found a possible '" << symbol << "' model reference, ";
-                ss << "a reference must be directly in the " << SectionName(pd.sectionContext())
-                   << " section, indented by 4 spaces or 1 tab, without any additional sections";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                ReportWarning(report,
+                    pd,
+                    IgnoringWarning,
+                    node->sourceMap,
+                    "found a possible '%s' model reference, a reference must be directly in the %s section, "
+                    "indented by 4 spaces or 1 tab, without any additional sections",
+                    symbol,
+                    SectionName(pd.sectionContext()));
 
                 return true;
             }
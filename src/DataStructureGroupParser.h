@@ -40,32 +40,32 @@ namespace snowcrash
                 IntermediateParseResult<mson::NamedType> namedType(out.report);
                 cur = MSONNamedTypeParser::parse(node, siblings, pd, namedType);
 
-                if (isNamedTypeDuplicate(pd.blueprint, namedType.node.name.symbol.literal)) {
+                if (pd.blueprintIndex.isNamedTypeDuplicate(namedType.node.name.symbol.literal)) {
 
                     // WARN: duplicate named type
-                    std::stringstream ss;
-                    ss << "named type with name '" << namedType.node.name.symbol.literal << "' already exists";
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        DuplicateWarning,
+                        node->sourceMap,
+                        "named type with name '%s' already exists",
+                        namedType.node.name.symbol.literal);
                     return cur;
                 }
 
                 Element element(Element::DataStructureElement);
-                element.content.dataStructure = namedType.node;
+                element.content.dataStructure = std::move(namedType.node);
 
-                out.node.content.elements().push_back(element);
+                out.node.content.elements().push_back(std::move(element));
 
                 if (pd.exportSourceMap()) {
 
                     SourceMap<Element> elementSM(Element::DataStructureElement);
 
-                    elementSM.content.dataStructure.name = namedType.sourceMap.name;
-                    elementSM.content.dataStructure.typeDefinition = namedType.sourceMap.typeDefinition;
-                    elementSM.content.dataStructure.sections = namedType.sourceMap.sections;
+                    elementSM.content.dataStructure.name = std::move(namedType.sourceMap.name);
+                    elementSM.content.dataStructure.typeDefinition = std::move(namedType.sourceMap.typeDefinition);
+                    elementSM.content.dataStructure.sections = std::move(namedType.sourceMap.sections);
 
-                    out.sourceMap.content.elements().collection.push_back(elementSM);
+                    out.sourceMap.content.elements().collection.push_back(std::move(elementSM));
                 }
             }
 
@@ -114,43 +114,6 @@ namespace snowcrash
         {
             return { DataStructureGroupSectionType, ResourceGroupSectionType, ResourceSectionType };
         }
-
-        /**
-         * \brief Check if a named type already exists with the given name
-         *
-         * \param blueprint The blueprint which is formed until now
-         * \param name The named type name to be checked
-         */
-        static bool isNamedTypeDuplicate(const Blueprint& blueprint, mdp::ByteBuffer& name)
-        {
-
-            for (Elements::const_iterator it = blueprint.content.elements().begin();
-                 it != blueprint.content.elements().end();
-                 ++it) {
-
-                if (it->element == Element::CategoryElement) {
-
-                    for (Elements::const_iterator subIt = it->content.elements().begin();
-                         subIt != it->content.elements().end();
-                         ++subIt) {
-
-                        if (subIt->element == Element::ResourceElement
-                            && subIt->content.resource.attributes.name.symbol.literal == name) {
-
-                            return true;
-                        }
-
-                        if (subIt->element == Element::DataStructureElement
-                            && subIt->content.dataStructure.name.symbol.literal == name) {
-
-                            return true;
-                        }
-                    }
-                }
-            }
-
-            return false;
-        }
     };
 
     /** Data Structures Parser */
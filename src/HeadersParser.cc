@@ -1,3 +1,4 @@
+#include <cstring>
 #include "HeadersParser.h"
 
 using namespace snowcrash;
@@ -10,38 +11,22 @@ static HeaderIterator findHeader(const Headers& headers, const Header& header)
         headers.begin(), headers.end(), std::bind2nd(MatchFirsts<Header, IEqual<Header::first_type> >(), header));
 }
 
-typedef std::vector<std::string> HeadersKeyCollection;
-
-/** Get collection of allowed keywords - workaround due to C++98 restriction - static initialization of vector */
-static const HeadersKeyCollection& getAllowedMultipleDefinitions()
-{
-
-    static std::string keys[] = {
-        HTTPHeaderName::SetCookie, HTTPHeaderName::Link,
-    };
-
-    static const HeadersKeyCollection allowedMultipleDefinitions(keys, keys + (sizeof(keys) / sizeof(keys[0])));
-
-    return allowedMultipleDefinitions;
-}
-
 /** Check if Header name has allowed multiple definitions */
 static bool isAllowedMultipleDefinition(const Header& header)
 {
 
-    const HeadersKeyCollection& keys = getAllowedMultipleDefinitions();
+    IEqual<std::string> equal;
 
-    return std::find_if(keys.begin(),
-               keys.end(),
-               std::bind1st(MatchFirstWith<Header, std::string, IEqual<std::string> >(), header))
-        != keys.end();
+    return equal(header.first, HTTPHeaderName::SetCookie) || equal(header.first, HTTPHeaderName::Link);
 }
 
+/** Characters allowed in a header name besides alphanumeric ones */
+static const char ValidTokenChars[] = "-#$%&'*+.^_`|~";
+
 static bool isNotValidTokenChar(const std::string::value_type& c)
 {
-    static const std::string validChars("-#$%&'*+.^_`|~");
 
-    return !(std::isalnum(c) || (validChars.find(c) != std::string::npos));
+    return !(std::isalnum(c) || (c != '\0' && std::strchr(ValidTokenChars, c) != NULL));
 }
 
 static std::string::const_iterator findNonValidCharInHeaderName(const std::string& token)
@@ -116,8 +101,8 @@ bool HeaderParserValidator::operator()(const ValidateFunctorBase& rule)
 {
     bool rc = rule();
 
-    if (!rc) {
-        out.report.warnings.push_back(Warning(rule.getMessage(), HTTPWarning, sourceMap));
+    if (!rc && !pd.isWarningSuppressed(HTTPWarning)) {
+        ReportWarning(out.report, pd, HTTPWarning, sourceMap, "%s", rule.getMessage());
     }
 
     return rc;
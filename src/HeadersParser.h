@@ -101,10 +101,12 @@ namespace snowcrash
     struct HeaderParserValidator {
 
         const ParseResultRef<Headers>& out;
-        mdp::CharactersRangeSet sourceMap;
+        const SectionParserData& pd;
+        const mdp::BytesRangeSet& sourceMap;
 
-        HeaderParserValidator(const ParseResultRef<Headers>& out, mdp::CharactersRangeSet sourceMap)
-            : out(out), sourceMap(sourceMap)
+        HeaderParserValidator(
+            const ParseResultRef<Headers>& out, const SectionParserData& pd, const mdp::BytesRangeSet& sourceMap)
+            : out(out), pd(pd), sourceMap(sourceMap)
         {
         }
 
@@ -185,9 +187,7 @@ namespace snowcrash
             if (out.node.empty()) {
 
                 // WARN: No valid headers defined
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning("no valid headers specified", FormattingWarning, sourceMap));
+                ReportWarning(out.report, pd, FormattingWarning, node->sourceMap, "no valid headers specified");
             }
         }
 
@@ -200,12 +200,14 @@ namespace snowcrash
          * \param line - contains individual line with header definition
          * \param header - is filled by name and value if definition is valid
          * \param out - "report" member can receive warning while checking validity
+         * \param pd - parser data
          * \param sourceMap - just contain source mapping for warning report
          */
         static bool parseHeaderLine(const mdp::ByteBuffer& line,
             Header& header,
             const ParseResultRef<Headers>& out,
-            const mdp::CharactersRangeSet sourceMap)
+            const SectionParserData& pd,
+            const mdp::BytesRangeSet& sourceMap)
         {
 
             std::string re = "^ *([^:[:blank:]]+)(( *:? *)(.*)?)$";
@@ -215,17 +217,18 @@ namespace snowcrash
 
             if (!matched) {
                 // WARN: unable to parse header
-                out.report.warnings.push_back(Warning(
-                    "unable to parse HTTP header, expected '<header name> : <header value>', one header per line",
+                ReportWarning(out.report,
+                    pd,
                     FormattingWarning,
-                    sourceMap));
+                    sourceMap,
+                    "unable to parse HTTP header, expected '<header name> : <header value>', one header per line");
                 return false;
             }
 
             header = std::make_pair(parts[1], parts[4]);
             TrimString(header.second);
 
-            HeaderParserValidator validate(out, sourceMap);
+            HeaderParserValidator validate(out, pd, sourceMap);
 
             if (!validate(HeaderNameTokenChecker(header.first))) {
                 return false;
@@ -238,24 +241,24 @@ namespace snowcrash
             return !header.first.empty();
         }
 
-        static bool fetchLine(const std::string& input, mdp::BytesRange& map, std::string& line)
+        static bool fetchLine(const StringView& input, mdp::BytesRange& map, std::string& line)
         {
 
             if (input.length() < (map.location + map.length)) {
                 return false;
             }
 
-            TrimRange trim = GetTrimInfo(input.begin() + map.location, input.begin() + map.location + map.length);
+            StringView trimmed = TrimStringView(input.substr(map.location, map.length));
 
-            map.length = std::get<1>(trim);
+            map.length = trimmed.length();
 
             if (map.length <= 0) {
                 return false;
             }
 
-            map.location += std::get<0>(trim);
+            map.location = trimmed.data() - input.data();
 
-            line = input.substr(map.location, map.length);
+            line = trimmed.str();
 
             return true;
         }
@@ -296,16 +299,14 @@ namespace snowcrash
 
                 mdp::BytesRangeSet byteMap;
                 byteMap.push_back(map);
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(byteMap, pd.sourceCharacterIndex);
 
-                if (parseHeaderLine(line, header, out, sourceMap)) {
-                    out.node.push_back(header);
+                if (parseHeaderLine(line, header, out, pd, byteMap)) {
+                    out.node.push_back(std::move(header));
 
                     if (pd.exportSourceMap()) {
                         SourceMap<Header> headerSM;
-                        headerSM.sourceMap = sourceMap;
-                        out.sourceMap.collection.push_back(headerSM);
+                        headerSM.sourceMap = mdp::BytesRangeSetToCharactersRangeSet(byteMap, pd.sourceCharacterIndex);
+                        out.sourceMap.collection.push_back(std::move(headerSM));
                     }
                 }
             }
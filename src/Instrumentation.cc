@@ -0,0 +1,391 @@
+//
+//  Instrumentation.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include "Instrumentation.h"
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+using namespace snowcrash;
+
+namespace
+{
+    /** Names of the counters in the trace, indexed by `InstrumentationCounter` */
+    const char* const CounterNames[] = { "regexEvaluations", "warnings", "bytesCopied" };
+
+    /** Index of a thread which has recorded nothing since the instrumentation was cleared */
+    const size_t UnassignedThreadIndex = static_cast<size_t>(-1);
+
+    typedef std::unordered_map<const char*, InstrumentationStage> StageMap;
+    typedef std::unordered_map<std::type_index, std::string> StageNameMap;
+    typedef std::unordered_map<std::type_index, const char*> StageNameCache;
+
+    /**
+     *  \brief  Statistics recorded by a thread
+     *
+     *  Written by its thread only, the lock is taken by others only to read
+     *  or clear the statistics.
+     */
+    struct ThreadRecord {
+
+        ThreadRecord() : index(UnassignedThreadIndex), droppedEvents(0), counters() {}
+
+        std::mutex mutex;
+        size_t index;
+        StageMap stages;
+        std::vector<InstrumentationEvent> events;
+        size_t droppedEvents;
+        size_t counters[InstrumentationCounterCount];
+
+        /** Names of the section parser stages looked up by the thread, never cleared */
+        StageNameCache sectionParserStageNames;
+
+        /** Add statistics of another record, the events up to the limit */
+        void merge(const ThreadRecord& other)
+        {
+            for (StageMap::const_iterator it = other.stages.begin(); it != other.stages.end(); ++it) {
+
+                InstrumentationStage& stage = stages[it->first];
+                stage.calls += it->second.calls;
+                stage.duration += it->second.duration;
+            }
+
+            size_t room = InstrumentationEventLimit - std::min(events.size(), InstrumentationEventLimit);
+            size_t count = std::min(other.events.size(), room);
+
+            events.insert(events.end(), other.events.begin(), other.events.begin() + count);
+            droppedEvents += other.droppedEvents + (other.events.size() - count);
+
+            for (size_t i = 0; i < InstrumentationCounterCount; ++i) {
+                counters[i] += other.counters[i];
+            }
+        }
+
+        void clear()
+        {
+            index = UnassignedThreadIndex;
+            stages.clear();
+            events.clear();
+            droppedEvents = 0;
+            std::memset(counters, 0, sizeof(counters));
+        }
+    };
+
+    /** \return True if the event finished before the other one */
+    bool FinishedBefore(const InstrumentationEvent& lhs, const InstrumentationEvent& rhs)
+    {
+        return lhs.start + lhs.duration < rhs.start + rhs.duration;
+    }
+
+    /**
+     *  \brief  Statistics of all the threads
+     *
+     *  Every thread records into its own `ThreadRecord`, the records are
+     *  only merged when the statistics are read. Records of the threads
+     *  which finished are merged into a single one.
+     */
+    class InstrumentationRecorder
+    {
+    public:
+        InstrumentationRecorder()
+            : m_origin(std::chrono::steady_clock::now().time_since_epoch().count()), m_threadCount(0)
+        {
+        }
+
+        void record(ThreadRecord& record,
+            const char* name,
+            const std::chrono::steady_clock::time_point& start,
+            const std::chrono::steady_clock::time_point& end)
+        {
+            std::chrono::steady_clock::time_point origin(std::chrono::steady_clock::duration(m_origin.load()));
+            std::lock_guard<std::mutex> lock(record.mutex);
+
+            if (record.index == UnassignedThreadIndex) {
+                record.index = m_threadCount++;
+            }
+
+            double duration = std::chrono::duration<double, std::micro>(end - start).count();
+
+            InstrumentationStage& stage = record.stages[name];
+            ++stage.calls;
+            stage.duration += duration;
+
+            if (record.events.size() >= InstrumentationEventLimit) {
+                ++record.droppedEvents;
+                return;
+            }
+
+            InstrumentationEvent event;
+            event.name = name;
+            event.thread = record.index;
+            event.start = std::chrono::duration<double, std::micro>(start - origin).count();
+            event.duration = duration;
+
+            record.events.push_back(event);
+        }
+
+        void count(ThreadRecord& record, InstrumentationCounter counter, size_t count)
+        {
+            std::lock_guard<std::mutex> lock(record.mutex);
+            record.counters[counter] += count;
+        }
+
+        /** \return Name of the stage of `SectionParser<T>::parse`, valid as long as the recorder */
+        const char* sectionParserStageName(ThreadRecord& record, const std::type_info& type)
+        {
+            StageNameCache::const_iterator cached = record.sectionParserStageNames.find(std::type_index(type));
+
+            if (cached != record.sectionParserStageNames.end()) {
+                return cached->second;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            std::pair<StageNameMap::iterator, bool> result
+                = m_sectionParserStageNames.insert(std::make_pair(std::type_index(type), std::string()));
+
+            if (result.second) {
+                result.first->second = "SectionParser<" + TypeName(type) + ">::parse";
+            }
+
+            record.sectionParserStageNames[std::type_index(type)] = result.first->second.c_str();
+
+            return result.first->second.c_str();
+        }
+
+        /** Start recording statistics of the calling thread */
+        void addThread(ThreadRecord* record)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_threads.push_back(record);
+        }
+
+        /** Stop recording statistics of a finishing thread, the statistics are kept */
+        void removeThread(ThreadRecord* record)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_threads.erase(std::remove(m_threads.begin(), m_threads.end(), record), m_threads.end());
+            m_finishedThreads.merge(*record);
+        }
+
+        InstrumentationStatistics statistics()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            ThreadRecord merged;
+            merged.merge(m_finishedThreads);
+
+            for (std::vector<ThreadRecord*>::const_iterator it = m_threads.begin(); it != m_threads.end(); ++it) {
+
+                std::lock_guard<std::mutex> threadLock((*it)->mutex);
+                merged.merge(**it);
+            }
+
+            InstrumentationStatistics result;
+
+            // The same name might be recorded from different string literals
+            std::map<std::string, InstrumentationStage> stages;
+
+            for (StageMap::const_iterator it = merged.stages.begin(); it != merged.stages.end(); ++it) {
+
+                InstrumentationStage& stage = stages[it->first];
+                stage.calls += it->second.calls;
+                stage.duration += it->second.duration;
+            }
+
+            for (std::map<std::string, InstrumentationStage>::iterator it = stages.begin(); it != stages.end(); ++it) {
+
+                it->second.name = it->first;
+                result.stages.push_back(it->second);
+            }
+
+            result.events.swap(merged.events);
+            std::stable_sort(result.events.begin(), result.events.end(), FinishedBefore);
+
+            result.droppedEvents = merged.droppedEvents;
+            std::memcpy(result.counters, merged.counters, sizeof(merged.counters));
+
+            return result;
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_origin = std::chrono::steady_clock::now().time_since_epoch().count();
+            m_threadCount = 0;
+            m_finishedThreads.clear();
+
+            for (std::vector<ThreadRecord*>::const_iterator it = m_threads.begin(); it != m_threads.end(); ++it) {
+
+                std::lock_guard<std::mutex> threadLock((*it)->mutex);
+                (*it)->clear();
+            }
+        }
+
+    private:
+        /** \return Readable name of the type without the `snowcrash` namespace */
+        static std::string TypeName(const std::type_info& type)
+        {
+            std::string name = type.name();
+
+#if defined(__GNUG__)
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(type.name(), NULL, NULL, &status);
+
+            if (status == 0 && demangled) {
+                name = demangled;
+            }
+
+            std::free(demangled);
+#endif
+
+            // MSVC names are readable, e.g. `struct snowcrash::Resource`
+            static const char* const Prefixes[] = { "struct ", "class ", "snowcrash::" };
+
+            for (size_t i = 0; i < sizeof(Prefixes) / sizeof(Prefixes[0]); ++i) {
+
+                if (name.compare(0, std::strlen(Prefixes[i]), Prefixes[i]) == 0) {
+                    name.erase(0, std::strlen(Prefixes[i]));
+                }
+            }
+
+            return name;
+        }
+
+        std::mutex m_mutex;
+        std::atomic<std::chrono::steady_clock::rep> m_origin;
+        std::atomic<size_t> m_threadCount;
+        std::vector<ThreadRecord*> m_threads;
+        ThreadRecord m_finishedThreads;
+
+        /** Never cleared, recorded events refer to the names */
+        StageNameMap m_sectionParserStageNames;
+    };
+
+    InstrumentationRecorder recorder;
+
+    /** Record of a thread, registered with the recorder while the thread runs */
+    class ThreadRecordHolder
+    {
+    public:
+        ThreadRecordHolder() : m_record(NULL) {}
+
+        ~ThreadRecordHolder()
+        {
+            if (m_record) {
+                recorder.removeThread(m_record);
+                delete m_record;
+            }
+        }
+
+        ThreadRecord& record()
+        {
+            if (!m_record) {
+                m_record = new ThreadRecord;
+                recorder.addThread(m_record);
+            }
+
+            return *m_record;
+        }
+
+    private:
+        ThreadRecord* m_record;
+    };
+
+    thread_local ThreadRecordHolder threadRecord;
+
+    /** Write a string as a JSON string */
+    void WriteJSONString(const std::string& value, std::ostream& stream)
+    {
+        stream << '"';
+
+        for (std::string::const_iterator it = value.begin(); it != value.end(); ++it) {
+
+            if (*it == '"' || *it == '\\')
+                stream << '\\';
+
+            stream << *it;
+        }
+
+        stream << '"';
+    }
+}
+
+InstrumentationScope::~InstrumentationScope()
+{
+    recorder.record(threadRecord.record(), m_name, m_start, std::chrono::steady_clock::now());
+}
+
+InstrumentationStatistics snowcrash::GetInstrumentationStatistics()
+{
+    return recorder.statistics();
+}
+
+void snowcrash::ClearInstrumentation()
+{
+    recorder.clear();
+}
+
+void snowcrash::CountInstrumentation(InstrumentationCounter counter, size_t count)
+{
+    recorder.count(threadRecord.record(), counter, count);
+}
+
+const char* snowcrash::SectionParserStageName(const std::type_info& type)
+{
+    return recorder.sectionParserStageName(threadRecord.record(), type);
+}
+
+void snowcrash::WriteInstrumentationTrace(const InstrumentationStatistics& statistics, std::ostream& stream)
+{
+    std::ios::fmtflags flags = stream.flags();
+    std::streamsize precision = stream.precision();
+
+    stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+    for (std::vector<InstrumentationEvent>::const_iterator it = statistics.events.begin();
+         it != statistics.events.end();
+         ++it) {
+
+        if (it != statistics.events.begin())
+            stream << ",";
+
+        // Complete event, times in microseconds
+        stream << "\n{\"name\":";
+        WriteJSONString(it->name ? it->name : "", stream);
+        stream << ",\"cat\":\"snowcrash\",\"ph\":\"X\",\"pid\":0,\"tid\":" << it->thread << ",\"ts\":" << it->start
+               << ",\"dur\":" << it->duration << "}";
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{";
+
+    for (size_t i = 0; i < InstrumentationCounterCount; ++i) {
+
+        if (i > 0)
+            stream << ",";
+
+        stream << "\"" << CounterNames[i] << "\":\"" << statistics.counters[i] << "\"";
+    }
+
+    stream << "}}\n";
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
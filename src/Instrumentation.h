@@ -0,0 +1,117 @@
+//
+//  Instrumentation.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_INSTRUMENTATION_H
+#define SNOWCRASH_INSTRUMENTATION_H
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+/**
+ *  Stages and counters are recorded only if built with `SNOWCRASH_INSTRUMENTATION`
+ *  defined, see `./configure --instrument`. Otherwise the macros expand to nothing
+ *  and the statistics stay empty.
+ */
+#ifdef SNOWCRASH_INSTRUMENTATION
+#define SNOWCRASH_INSTRUMENT_STAGE(name) snowcrash::InstrumentationScope instrumentationScope(name)
+#define SNOWCRASH_INSTRUMENT_COUNT(counter, count) snowcrash::CountInstrumentation(snowcrash::counter, count)
+#else
+#define SNOWCRASH_INSTRUMENT_STAGE(name)
+#define SNOWCRASH_INSTRUMENT_COUNT(counter, count)
+#endif
+
+namespace snowcrash
+{
+
+    /** Counters of the instrumentation */
+    enum InstrumentationCounter
+    {
+        RegexEvaluationsCounter = 0, /// < Regular expressions evaluated
+        WarningsCounter,             /// < Warnings reported by finished parses
+        BytesCopiedCounter,          /// < Bytes of the source data copied into the AST
+        InstrumentationCounterCount
+    };
+
+    /** Calls of a stage, e.g. `MarkdownParser::parse` */
+    struct InstrumentationStage {
+        std::string name;
+        size_t calls;
+        double duration; /// < Total wall time in microseconds, nested stages included
+
+        InstrumentationStage() : calls(0), duration(0) {}
+    };
+
+    /** One call of a stage */
+    struct InstrumentationEvent {
+        const char* name;
+        size_t thread;   /// < Index of the thread in the order the threads were first seen
+        double start;    /// < Microseconds since the instrumentation was cleared
+        double duration; /// < Wall time in microseconds
+
+        InstrumentationEvent() : name(NULL), thread(0), start(0), duration(0) {}
+    };
+
+    /** Events kept per thread, later calls are only added to their stages */
+    const size_t InstrumentationEventLimit = 65536;
+
+    /** Statistics recorded since the instrumentation was cleared */
+    struct InstrumentationStatistics {
+        std::vector<InstrumentationStage> stages; /// < Sorted by name
+        std::vector<InstrumentationEvent> events; /// < In the order the calls finished
+        size_t droppedEvents;                     /// < Events over the limit of their thread
+        size_t counters[InstrumentationCounterCount];
+
+        InstrumentationStatistics() : droppedEvents(0), counters() {}
+    };
+
+    /**
+     *  \return Statistics recorded by all the threads so far
+     *
+     *  Every thread records into its own buffer, the buffers are merged only
+     *  here. Threads which finished are merged as they finish, at most
+     *  `InstrumentationEventLimit` of their events are kept.
+     */
+    InstrumentationStatistics GetInstrumentationStatistics();
+
+    /** Drop the statistics recorded so far and restart the clock */
+    void ClearInstrumentation();
+
+    /**
+     *  \brief Write the events as a Chrome trace
+     *
+     *  Writes JSON in the Trace Event Format, to be loaded by `chrome://tracing`
+     *  or Perfetto. Counters are written as the trace metadata.
+     */
+    void WriteInstrumentationTrace(const InstrumentationStatistics& statistics, std::ostream& stream);
+
+    /** \return Name of the stage of `SectionParser<T>::parse` parsing the type, e.g. `SectionParser<Resource>::parse` */
+    const char* SectionParserStageName(const std::type_info& type);
+
+    /** Add to a counter */
+    void CountInstrumentation(InstrumentationCounter counter, size_t count);
+
+    /** Records a call of a stage when leaving the scope */
+    class InstrumentationScope
+    {
+    public:
+        explicit InstrumentationScope(const char* name) : m_name(name), m_start(std::chrono::steady_clock::now()) {}
+        ~InstrumentationScope();
+
+    private:
+        const char* m_name;
+        std::chrono::steady_clock::time_point m_start;
+
+        InstrumentationScope(const InstrumentationScope&);
+        InstrumentationScope& operator=(const InstrumentationScope&);
+    };
+}
+
+#endif
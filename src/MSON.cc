@@ -40,10 +40,13 @@ bool ValueDefinition::empty() const
     return (this->values.empty() && this->typeDefinition.empty());
 }
 
+/** Elements of a content without any */
+static const Elements EmptyElements;
+
 Elements& TypeSection::Content::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new Elements);
 
     return *m_elements;
 }
@@ -51,7 +54,7 @@ Elements& TypeSection::Content::elements()
 const Elements& TypeSection::Content::elements() const
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return EmptyElements;
 
     return *m_elements;
 }
@@ -59,21 +62,38 @@ const Elements& TypeSection::Content::elements() const
 TypeSection::Content::Content(const Markdown& description_, const Literal& value_)
     : description(description_), value(value_)
 {
-    m_elements.reset(::new Elements);
 }
 
 TypeSection::Content::Content(const TypeSection::Content& rhs)
 {
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+
+    if (rhs.m_elements.get())
+        m_elements.reset(::new Elements(*rhs.m_elements.get()));
+}
+
+TypeSection::Content::Content(TypeSection::Content&& rhs) noexcept
+    : description(std::move(rhs.description))
+    , value(std::move(rhs.value))
+    , m_elements(std::move(rhs.m_elements))
+{
 }
 
 TypeSection::Content& TypeSection::Content::operator=(const TypeSection::Content& rhs)
 {
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new Elements(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+TypeSection::Content& TypeSection::Content::operator=(TypeSection::Content&& rhs) noexcept
+{
+    this->description = std::move(rhs.description);
+    this->value = std::move(rhs.value);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -111,24 +131,18 @@ bool PropertyMember::empty() const
 
 OneOf& Element::Content::oneOf()
 {
-    if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
-
-    return *m_elements;
+    return elements();
 }
 
 const OneOf& Element::Content::oneOf() const
 {
-    if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
-
-    return *m_elements;
+    return elements();
 }
 
 Elements& Element::Content::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new Elements);
 
     return *m_elements;
 }
@@ -136,7 +150,7 @@ Elements& Element::Content::elements()
 const Elements& Element::Content::elements() const
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return EmptyElements;
 
     return *m_elements;
 }
@@ -148,9 +162,15 @@ Element::Content& Element::Content::operator=(const Elements& rhs)
     return *this;
 }
 
+Element::Content& Element::Content::operator=(Elements&& rhs)
+{
+    m_elements.reset(::new Elements(std::move(rhs)));
+
+    return *this;
+}
+
 Element::Content::Content()
 {
-    m_elements.reset(::new Elements);
 }
 
 Element::Content::Content(const Element::Content& rhs)
@@ -158,7 +178,17 @@ Element::Content::Content(const Element::Content& rhs)
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+
+    if (rhs.m_elements.get())
+        m_elements.reset(::new Elements(*rhs.m_elements.get()));
+}
+
+Element::Content::Content(Element::Content&& rhs) noexcept
+    : property(std::move(rhs.property))
+    , value(std::move(rhs.value))
+    , mixin(std::move(rhs.mixin))
+    , m_elements(std::move(rhs.m_elements))
+{
 }
 
 Element::Content& Element::Content::operator=(const Element::Content& rhs)
@@ -166,7 +196,17 @@ Element::Content& Element::Content::operator=(const Element::Content& rhs)
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new Elements(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+Element::Content& Element::Content::operator=(Element::Content&& rhs) noexcept
+{
+    this->property = std::move(rhs.property);
+    this->value = std::move(rhs.value);
+    this->mixin = std::move(rhs.mixin);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -185,6 +225,10 @@ Element::Element(const Element& rhs)
     this->content = rhs.content;
 }
 
+Element::Element(Element&& rhs) noexcept : klass(rhs.klass), content(std::move(rhs.content))
+{
+}
+
 Element& Element::operator=(const Element& rhs)
 {
     this->klass = rhs.klass;
@@ -193,6 +237,14 @@ Element& Element::operator=(const Element& rhs)
     return *this;
 }
 
+Element& Element::operator=(Element&& rhs) noexcept
+{
+    this->klass = rhs.klass;
+    this->content = std::move(rhs.content);
+
+    return *this;
+}
+
 Element::~Element()
 {
 }
@@ -208,6 +260,17 @@ void Element::build(const PropertyMember& propertyMember)
     this->content.property = propertyMember;
 }
 
+/**
+ * \brief Build Element from property member, taking over its content
+ *
+ * \param propertyMember Property member which was given
+ */
+void Element::build(PropertyMember&& propertyMember)
+{
+    this->klass = Element::PropertyClass;
+    this->content.property = std::move(propertyMember);
+}
+
 /**
  * \brief Build Element from value member
  *
@@ -219,6 +282,17 @@ void Element::build(const ValueMember& valueMember)
     this->content.value = valueMember;
 }
 
+/**
+ * \brief Build Element from value member, taking over its content
+ *
+ * \param valueMember Value member which was given
+ */
+void Element::build(ValueMember&& valueMember)
+{
+    this->klass = Element::ValueClass;
+    this->content.value = std::move(valueMember);
+}
+
 /**
  * \brief Build Element from mixin type
  *
@@ -241,6 +315,17 @@ void Element::build(const OneOf& oneOf)
     this->klass = Element::OneOfClass;
 }
 
+/**
+ * \brief Build Element from one of type, taking over its elements
+ *
+ * \param oneOf One Of which was given
+ */
+void Element::build(OneOf&& oneOf)
+{
+    this->buildFromElements(std::move(oneOf));
+    this->klass = Element::OneOfClass;
+}
+
 /**
  * \brief Build Element from a value
  *
@@ -251,7 +336,7 @@ void Element::build(const Value& value)
     ValueMember valueMember;
 
     valueMember.valueDefinition.values.push_back(value);
-    this->build(valueMember);
+    this->build(std::move(valueMember));
 }
 
 /**
@@ -264,3 +349,14 @@ void Element::buildFromElements(const Elements& elements)
     this->klass = Element::GroupClass;
     this->content = elements;
 }
+
+/**
+ * \brief Build Element from group of elements, taking over the elements
+ *
+ * \param elements Group of elements
+ */
+void Element::buildFromElements(Elements&& elements)
+{
+    this->klass = Element::GroupClass;
+    this->content = std::move(elements);
+}
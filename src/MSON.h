@@ -13,13 +13,11 @@
 #include <string>
 #include <set>
 #include <map>
-#include <stdexcept>
+#include <memory>
 
 #include "Platform.h"
 #include "MarkdownParser.h"
 
-#define ELEMENTS_NOT_SET_ERR std::logic_error("no elements set")
-
 /**
  * MSON Abstract Syntax Tree
  * -------------------------
@@ -239,13 +237,20 @@ namespace mson
             /** Copy constructor */
             Content(const TypeSection::Content& rhs);
 
+            /** Move constructor */
+            Content(TypeSection::Content&& rhs) noexcept;
+
             /** Assignment operator */
             TypeSection::Content& operator=(const TypeSection::Content& rhs);
 
+            /** Move assignment operator */
+            TypeSection::Content& operator=(TypeSection::Content&& rhs) noexcept;
+
             /** Desctructor */
             ~Content();
 
         private:
+            /** Allocated on the first modification, NULL while empty */
             std::unique_ptr<Elements> m_elements;
         };
 
@@ -368,6 +373,7 @@ namespace mson
 
             /** Builds the structure from group of elements */
             Element::Content& operator=(const Elements& rhs);
+            Element::Content& operator=(Elements&& rhs);
 
             /** Constructor */
             Content();
@@ -375,13 +381,20 @@ namespace mson
             /** Copy constructor */
             Content(const Element::Content& rhs);
 
+            /** Move constructor */
+            Content(Element::Content&& rhs) noexcept;
+
             /** Assignment operator */
             Content& operator=(const Element::Content& rhs);
 
+            /** Move assignment operator */
+            Content& operator=(Element::Content&& rhs) noexcept;
+
             /** Destructor */
             ~Content();
 
         private:
+            /** Allocated on the first modification, NULL while empty */
             std::unique_ptr<Elements> m_elements;
         };
 
@@ -397,17 +410,27 @@ namespace mson
         /** Copy constructor */
         Element(const Element& rhs);
 
+        /** Move constructor */
+        Element(Element&& rhs) noexcept;
+
         /** Assignment operator */
         Element& operator=(const Element& rhs);
 
+        /** Move assignment operator */
+        Element& operator=(Element&& rhs) noexcept;
+
         /** Functions which allow the building of member type */
         void build(const PropertyMember& propertyMember);
+        void build(PropertyMember&& propertyMember);
         void build(const ValueMember& valueMember);
+        void build(ValueMember&& valueMember);
         void build(const Mixin& mixin);
         void build(const OneOf& oneOf);
+        void build(OneOf&& oneOf);
         void build(const Value& value);
 
         void buildFromElements(const Elements& elements);
+        void buildFromElements(Elements&& elements);
 
         /** Destructor */
         ~Element();
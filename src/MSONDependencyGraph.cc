@@ -0,0 +1,373 @@
+//
+//  MSONDependencyGraph.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include "MSONDependencyGraph.h"
+
+using namespace mson;
+using snowcrash::SymbolID;
+using snowcrash::UndefinedSymbolID;
+
+typedef std::vector<uint64_t> Bits;
+
+static const size_t BitsPerWord = 64;
+
+/** \return True if the bit is set */
+static bool TestBit(const Bits& bits, SymbolID id)
+{
+    size_t word = id / BitsPerWord;
+    return word < bits.size() && (bits[word] & (uint64_t(1) << (id % BitsPerWord)));
+}
+
+static void SetBit(Bits& bits, SymbolID id)
+{
+    size_t word = id / BitsPerWord;
+
+    if (word >= bits.size())
+        bits.resize(word + 1, 0);
+
+    bits[word] |= uint64_t(1) << (id % BitsPerWord);
+}
+
+/** Add the bits set in \a other */
+static void UniteBits(Bits& bits, const Bits& other)
+{
+    if (other.size() > bits.size())
+        bits.resize(other.size(), 0);
+
+    for (size_t i = 0; i < other.size(); ++i) {
+        bits[i] |= other[i];
+    }
+}
+
+static size_t CountBits(const Bits& bits)
+{
+    size_t count = 0;
+
+    for (Bits::const_iterator it = bits.begin(); it != bits.end(); ++it) {
+
+        for (uint64_t word = *it; word; word &= word - 1) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+/** Call \a f with the ID of every bit set */
+template <typename F>
+static void ForEachBit(const Bits& bits, F f)
+{
+    for (size_t i = 0; i < bits.size(); ++i) {
+
+        size_t bit = i * BitsPerWord;
+
+        for (uint64_t word = bits[i]; word; word >>= 1, ++bit) {
+
+            if (word & 1)
+                f(bit);
+        }
+    }
+}
+
+NamedTypeDependencyGraph::NamedTypeDependencyGraph(const NamedTypeDependencyTable& table) : m_size(0)
+{
+    for (NamedTypeDependencyTable::const_iterator it = table.begin(); it != table.end(); ++it) {
+
+        add(it->first);
+
+        for (std::set<Literal>::const_iterator depIt = it->second.begin(); depIt != it->second.end(); ++depIt) {
+            addDirectDependency(it->first, *depIt);
+        }
+    }
+}
+
+SymbolID NamedTypeDependencyGraph::intern(const Literal& name)
+{
+    SymbolID id = m_symbols.intern(name);
+
+    if (id >= m_entries.size()) {
+        m_entries.resize(id + 1, false);
+        m_dependencies.resize(id + 1);
+    }
+
+    return id;
+}
+
+SymbolID NamedTypeDependencyGraph::findEntry(const Literal& name) const
+{
+    SymbolID id = m_symbols.find(name);
+    return (id != UndefinedSymbolID && m_entries[id]) ? id : UndefinedSymbolID;
+}
+
+bool NamedTypeDependencyGraph::contains(const Literal& name) const
+{
+    return findEntry(name) != UndefinedSymbolID;
+}
+
+void NamedTypeDependencyGraph::add(const Literal& name)
+{
+    SymbolID id = intern(name);
+
+    if (!m_entries[id]) {
+        m_entries[id] = true;
+        ++m_size;
+    }
+
+    m_dependencies[id].clear();
+}
+
+void NamedTypeDependencyGraph::addDirectDependency(const Literal& name, const Literal& dependency)
+{
+    SymbolID dependencyID = intern(dependency);
+    SymbolID id = intern(name);
+
+    SetBit(m_dependencies[id], dependencyID);
+}
+
+void NamedTypeDependencyGraph::resolve()
+{
+    size_t count = m_symbols.size();
+
+    // Every named type depended on gets an entry
+    for (SymbolID id = 0; id < count; ++id) {
+
+        if (!m_entries[id]) {
+            m_entries[id] = true;
+            ++m_size;
+        }
+    }
+
+    std::vector<std::vector<SymbolID> > edges(count);
+
+    for (SymbolID id = 0; id < count; ++id) {
+        ForEachBit(m_dependencies[id], [&](SymbolID dependency) { edges[id].push_back(dependency); });
+    }
+
+    std::vector<size_t> component(count, UndefinedSymbolID);
+    std::vector<size_t> index(count, UndefinedSymbolID);
+    std::vector<size_t> lowLink(count, 0);
+    std::vector<bool> onStack(count, false);
+    std::vector<SymbolID> stack;
+    size_t nextIndex = 0;
+
+    // Depth-first search without recursion, a frame is a node and its next edge
+    std::vector<std::pair<SymbolID, size_t> > frames;
+
+    for (SymbolID root = 0; root < count; ++root) {
+
+        if (index[root] != UndefinedSymbolID)
+            continue;
+
+        frames.push_back(std::make_pair(root, 0));
+        index[root] = lowLink[root] = nextIndex++;
+        stack.push_back(root);
+        onStack[root] = true;
+
+        while (!frames.empty()) {
+
+            SymbolID node = frames.back().first;
+
+            if (frames.back().second < edges[node].size()) {
+
+                SymbolID next = edges[node][frames.back().second++];
+
+                if (index[next] == UndefinedSymbolID) {
+
+                    frames.push_back(std::make_pair(next, 0));
+                    index[next] = lowLink[next] = nextIndex++;
+                    stack.push_back(next);
+                    onStack[next] = true;
+                } else if (onStack[next]) {
+                    lowLink[node] = std::min(lowLink[node], index[next]);
+                }
+
+                continue;
+            }
+
+            frames.pop_back();
+
+            if (!frames.empty()) {
+                SymbolID parent = frames.back().first;
+                lowLink[parent] = std::min(lowLink[parent], lowLink[node]);
+            }
+
+            if (lowLink[node] != index[node])
+                continue;
+
+            // Node is the root of a component, dependencies of the other components are resolved
+            std::vector<SymbolID> members;
+            SymbolID member;
+
+            do {
+                member = stack.back();
+                stack.pop_back();
+                onStack[member] = false;
+                members.push_back(member);
+                component[member] = node;
+            } while (member != node);
+
+            Bits dependencies;
+            bool circular = members.size() > 1;
+
+            for (std::vector<SymbolID>::const_iterator it = members.begin(); it != members.end(); ++it) {
+
+                for (std::vector<SymbolID>::const_iterator edgeIt = edges[*it].begin(); edgeIt != edges[*it].end();
+                     ++edgeIt) {
+
+                    if (component[*edgeIt] == node) {
+                        circular = circular || (*edgeIt == *it);
+                        continue;
+                    }
+
+                    SetBit(dependencies, *edgeIt);
+                    UniteBits(dependencies, m_dependencies[*edgeIt]);
+                }
+            }
+
+            if (circular) {
+                for (std::vector<SymbolID>::const_iterator it = members.begin(); it != members.end(); ++it) {
+                    SetBit(dependencies, *it);
+                }
+            }
+
+            for (std::vector<SymbolID>::const_iterator it = members.begin(); it != members.end(); ++it) {
+                m_dependencies[*it] = dependencies;
+            }
+        }
+    }
+}
+
+void NamedTypeDependencyGraph::addDependency(const Literal& dependent, const Literal& dependency)
+{
+    SymbolID dependencyID = findEntry(dependency);
+
+    if (dependencyID == UndefinedSymbolID)
+        return;
+
+    SymbolID dependentID = intern(dependent);
+
+    if (!m_entries[dependentID]) {
+        m_entries[dependentID] = true;
+        ++m_size;
+    }
+
+    if (TestBit(m_dependencies[dependentID], dependencyID))
+        return;
+
+    Bits added = m_dependencies[dependencyID];
+    SetBit(added, dependencyID);
+
+    for (SymbolID id = 0; id < m_dependencies.size(); ++id) {
+
+        if (id == dependentID || TestBit(m_dependencies[id], dependentID)) {
+            UniteBits(m_dependencies[id], added);
+        }
+    }
+}
+
+bool NamedTypeDependencyGraph::dependsOn(const Literal& name, const Literal& dependency) const
+{
+    SymbolID id = findEntry(name);
+    SymbolID dependencyID = m_symbols.find(dependency);
+
+    return id != UndefinedSymbolID && dependencyID != UndefinedSymbolID
+        && TestBit(m_dependencies[id], dependencyID);
+}
+
+bool NamedTypeDependencyGraph::isCircular(const Literal& name) const
+{
+    return dependsOn(name, name);
+}
+
+size_t NamedTypeDependencyGraph::size() const
+{
+    return m_size;
+}
+
+size_t NamedTypeDependencyGraph::dependencyCount() const
+{
+    size_t count = 0;
+
+    for (SymbolID id = 0; id < m_dependencies.size(); ++id) {
+
+        if (m_entries[id]) {
+            count += CountBits(m_dependencies[id]);
+        }
+    }
+
+    return count;
+}
+
+NamedTypeDependencyTable NamedTypeDependencyGraph::table() const
+{
+    NamedTypeDependencyTable table;
+
+    for (SymbolID id = 0; id < m_dependencies.size(); ++id) {
+
+        if (!m_entries[id])
+            continue;
+
+        std::set<Literal>& entry = table[m_symbols.symbol(id)];
+        ForEachBit(m_dependencies[id], [&](SymbolID dependency) { entry.insert(m_symbols.symbol(dependency)); });
+    }
+
+    return table;
+}
+
+size_t NamedTypeDependencyGraph::allocatedMemory() const
+{
+    size_t bytes = m_entries.capacity() / 8 + m_dependencies.capacity() * sizeof(Bits);
+
+    for (SymbolID id = 0; id < m_dependencies.size(); ++id) {
+        bytes += m_dependencies[id].capacity() * sizeof(uint64_t);
+    }
+
+    // Symbols are kept both in a vector and as keys of a map
+    for (SymbolID id = 0; id < m_symbols.size(); ++id) {
+        bytes += 2 * (sizeof(std::string) + m_symbols.symbol(id).capacity()) + sizeof(SymbolID);
+    }
+
+    return bytes;
+}
+
+bool NamedTypeDependencyGraph::operator==(const NamedTypeDependencyGraph& rhs) const
+{
+    if (m_size != rhs.m_size)
+        return false;
+
+    for (SymbolID id = 0; id < m_dependencies.size(); ++id) {
+
+        if (!m_entries[id])
+            continue;
+
+        SymbolID rhsID = rhs.findEntry(m_symbols.symbol(id));
+
+        if (rhsID == UndefinedSymbolID
+            || CountBits(m_dependencies[id]) != CountBits(rhs.m_dependencies[rhsID])) {
+            return false;
+        }
+
+        bool equal = true;
+
+        ForEachBit(m_dependencies[id], [&](SymbolID dependency) {
+            SymbolID rhsDependency = rhs.m_symbols.find(m_symbols.symbol(dependency));
+            equal = equal && rhsDependency != UndefinedSymbolID && TestBit(rhs.m_dependencies[rhsID], rhsDependency);
+        });
+
+        if (!equal)
+            return false;
+    }
+
+    return true;
+}
+
+bool NamedTypeDependencyGraph::operator!=(const NamedTypeDependencyGraph& rhs) const
+{
+    return !(*this == rhs);
+}
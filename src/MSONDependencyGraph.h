@@ -0,0 +1,133 @@
+//
+//  MSONDependencyGraph.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_MSONDEPENDENCYGRAPH_H
+#define SNOWCRASH_MSONDEPENDENCYGRAPH_H
+
+#include <stdint.h>
+#include <vector>
+#include "MSON.h"
+#include "SymbolTable.h"
+
+namespace mson
+{
+
+    /**
+     *  \brief Graph of dependencies between named types
+     *
+     *  Named types are interned as dense IDs, dependencies of every named
+     *  type are kept as a set of bits indexed by the IDs.
+     *
+     *  The direct dependencies found while preprocessing the blueprint are
+     *  resolved into the transitive ones by `resolve()`. Strongly connected
+     *  components are found in a single pass of Tarjan's algorithm, which
+     *  yields them in reverse topological order, so all the dependencies of
+     *  a component are resolved before it is. Dependencies added while
+     *  parsing are added to the transitive ones right away.
+     */
+    class NamedTypeDependencyGraph
+    {
+    public:
+        NamedTypeDependencyGraph() : m_size(0) {}
+
+        /** Graph of the dependencies in the table */
+        explicit NamedTypeDependencyGraph(const NamedTypeDependencyTable& table);
+
+        /** \return True if the named type has an entry */
+        bool contains(const Literal& name) const;
+
+        /** Add an entry for the named type, without dependencies */
+        void add(const Literal& name);
+
+        /** Add a direct dependency of the named type, see `resolve()` */
+        void addDirectDependency(const Literal& name, const Literal& dependency);
+
+        /**
+         *  \brief Replace the direct dependencies with the transitive ones
+         *
+         *  Named types which are only depended on get an entry without
+         *  dependencies.
+         */
+        void resolve();
+
+        /**
+         *  \brief Add a dependency to the dependent and to every named type depending on it
+         *
+         *  The dependent gets an entry if it has none, the dependency has to
+         *  have one.
+         */
+        void addDependency(const Literal& dependent, const Literal& dependency);
+
+        /** \return True if the named type depends on the other one */
+        bool dependsOn(const Literal& name, const Literal& dependency) const;
+
+        /** \return True if the named type depends on itself */
+        bool isCircular(const Literal& name) const;
+
+        /** \return Number of named types with an entry */
+        size_t size() const;
+
+        /** \return Total number of dependencies */
+        size_t dependencyCount() const;
+
+        /** \return Table of the dependencies */
+        NamedTypeDependencyTable table() const;
+
+        /** \return Estimated bytes allocated by the graph */
+        size_t allocatedMemory() const;
+
+        /** \return True if both graphs have the same entries with the same dependencies */
+        bool operator==(const NamedTypeDependencyGraph& rhs) const;
+        bool operator!=(const NamedTypeDependencyGraph& rhs) const;
+
+    private:
+        typedef std::vector<uint64_t> Bits;
+        typedef snowcrash::SymbolID SymbolID;
+
+        /** \return ID of the named type, interned if not yet */
+        SymbolID intern(const Literal& name);
+
+        /** \return ID of the named type with an entry, `UndefinedSymbolID` if there is none */
+        SymbolID findEntry(const Literal& name) const;
+
+        /** Named types */
+        snowcrash::SymbolTable m_symbols;
+
+        /** True if the named type has an entry */
+        std::vector<bool> m_entries;
+
+        /** Dependencies of every named type */
+        std::vector<Bits> m_dependencies;
+
+        /** Number of named types with an entry */
+        size_t m_size;
+    };
+
+    /** Dependency between named types added while parsing, see `mson::addDependency()` */
+    struct NamedTypeDependency {
+
+        NamedTypeDependency(const Literal& dependent_, const Literal& dependency_, bool circularCheck_)
+            : dependent(dependent_), dependency(dependency_), circularCheck(circularCheck_)
+        {
+        }
+
+        /** Named type the dependency is added to */
+        Literal dependent;
+
+        /** Named type depended on */
+        Literal dependency;
+
+        /** True if the dependency was checked for circular references */
+        bool circularCheck;
+    };
+
+    /** Collection of dependencies between named types, in the order added */
+    typedef std::vector<NamedTypeDependency> NamedTypeDependencies;
+}
+
+#endif
@@ -59,10 +59,11 @@ namespace snowcrash
             if ((out.node.baseType == mson::PrimitiveBaseType) || (out.node.baseType == mson::UndefinedBaseType)) {
 
                 // WARN: invalid mixin base type
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(
-                    Warning("mixin type may not include a type of a primitive sub-type", FormattingWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    FormattingWarning,
+                    node->sourceMap,
+                    "mixin type may not include a type of a primitive sub-type");
             }
 
             // Check circular references
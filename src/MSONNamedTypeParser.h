@@ -48,13 +48,12 @@ namespace snowcrash
             if (subject[0] != '`' && RegexMatch(out.node.name.symbol.literal, MSONReservedCharsRegex)) {
 
                 // WARN: named type name should not contain reserved characters
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(
-                    Warning("please escape the name of the data structure using backticks since it contains MSON "
-                            "reserved characters",
-                        FormattingWarning,
-                        sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    FormattingWarning,
+                    node->sourceMap,
+                    "please escape the name of the data structure using backticks since it contains MSON "
+                    "reserved characters");
             }
 
             if (pd.exportSourceMap()) {
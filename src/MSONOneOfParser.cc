@@ -42,10 +42,10 @@ namespace snowcrash
                 IntermediateParseResult<mson::OneOf> oneOf(out.report);
                 cur = MSONOneOfParser::parse(node, siblings, pd, oneOf);
 
-                element.build(oneOf.node);
+                element.build(std::move(oneOf.node));
 
                 if (pd.exportSourceMap()) {
-                    elementSM = oneOf.sourceMap;
+                    elementSM = std::move(oneOf.sourceMap);
                 }
 
                 break;
@@ -57,10 +57,10 @@ namespace snowcrash
 
                 cur = MSONTypeSectionListParser::parse(node, siblings, pd, typeSection);
 
-                element.buildFromElements(typeSection.node.content.elements());
+                element.buildFromElements(std::move(typeSection.node.content.elements()));
 
                 if (pd.exportSourceMap()) {
-                    elementSM = typeSection.sourceMap.elements();
+                    elementSM = std::move(typeSection.sourceMap.elements());
                 }
 
                 break;
@@ -70,10 +70,10 @@ namespace snowcrash
                 IntermediateParseResult<mson::PropertyMember> propertyMember(out.report);
                 cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                element.build(propertyMember.node);
+                element.build(std::move(propertyMember.node));
 
                 if (pd.exportSourceMap()) {
-                    elementSM.property = propertyMember.sourceMap;
+                    elementSM.property = std::move(propertyMember.sourceMap);
                 }
 
                 break;
@@ -84,10 +84,10 @@ namespace snowcrash
         }
 
         if (element.klass != mson::Element::UndefinedClass) {
-            out.node.push_back(element);
+            out.node.push_back(std::move(element));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.collection.push_back(elementSM);
+                out.sourceMap.collection.push_back(std::move(elementSM));
             }
         }
 
@@ -100,22 +100,25 @@ namespace snowcrash
 
         SectionType nestedType = UndefinedSectionType;
 
+        // Only confirm the keyword sections the node might match
+        KeywordCandidates candidates = SectionKeywordCandidates(node);
+
         // Check if mson mixin section
-        nestedType = SectionProcessor<mson::Mixin>::sectionType(node);
+        nestedType = CandidateSectionType<mson::Mixin>(node, candidates, MixinKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson one of section
-        nestedType = SectionProcessor<mson::OneOf>::sectionType(node);
+        nestedType = CandidateSectionType<mson::OneOf>(node, candidates, OneOfKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson member type section section
-        nestedType = SectionProcessor<mson::TypeSection>::sectionType(node);
+        nestedType = CandidateSectionType<mson::TypeSection>(node, candidates, TypeSectionKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
@@ -45,10 +45,8 @@ namespace snowcrash
             if (out.node.empty()) {
 
                 // WARN: one of type do not have nested members
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(
-                    Warning("one of type must have nested members", EmptyDefinitionWarning, sourceMap));
+                ReportWarning(
+                    out.report, pd, EmptyDefinitionWarning, node->sourceMap, "one of type must have nested members");
             }
         }
 
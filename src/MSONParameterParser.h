@@ -111,7 +111,8 @@ namespace snowcrash
                     }
 
                     for (size_t i = 0; i < typeSection.node.content.elements().size(); i++) {
-                        mson::ValueMember valueMember = typeSection.node.content.elements().at(i).content.value;
+                        const mson::ValueMember& valueMember
+                            = typeSection.node.content.elements().at(i).content.value;
                         SourceMap<mson::ValueMember> valueMemberSM;
 
                         if (pd.exportSourceMap()) {
@@ -153,8 +154,11 @@ namespace snowcrash
 
             SectionType nestedType = UndefinedSectionType;
 
+            // Only confirm the keyword sections the node might match
+            KeywordCandidates candidates = SectionKeywordCandidates(node);
+
             // Recognize `Default` and `Members` sections
-            nestedType = SectionProcessor<mson::TypeSection>::sectionType(node);
+            nestedType = CandidateSectionType<mson::TypeSection>(node, candidates, TypeSectionKeywordCandidate);
 
             return nestedType;
         }
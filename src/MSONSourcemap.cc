@@ -26,10 +26,13 @@ bool SourceMap<mson::PropertyMember>::empty() const
         && sections.collection.empty());
 }
 
+/** Source map of a type section or an element without any elements */
+static const SourceMap<mson::Elements> EmptyElements;
+
 SourceMap<mson::Elements>& SourceMap<mson::TypeSection>::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new SourceMap<mson::Elements>);
 
     return *m_elements;
 }
@@ -37,7 +40,7 @@ SourceMap<mson::Elements>& SourceMap<mson::TypeSection>::elements()
 const SourceMap<mson::Elements>& SourceMap<mson::TypeSection>::elements() const
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return EmptyElements;
 
     return *m_elements;
 }
@@ -46,21 +49,39 @@ SourceMap<mson::TypeSection>::SourceMap(
     const SourceMap<mson::Markdown>& description_, const SourceMap<mson::Literal>& value_)
     : description(description_), value(value_)
 {
-    m_elements.reset(::new SourceMap<mson::Elements>);
 }
 
 SourceMap<mson::TypeSection>::SourceMap(const SourceMap<mson::TypeSection>& rhs)
 {
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+
+    if (rhs.m_elements.get())
+        m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+}
+
+// As with the copy constructor, source map of the type section itself is left out
+SourceMap<mson::TypeSection>::SourceMap(SourceMap<mson::TypeSection>&& rhs) noexcept
+    : description(std::move(rhs.description))
+    , value(std::move(rhs.value))
+    , m_elements(std::move(rhs.m_elements))
+{
 }
 
 SourceMap<mson::TypeSection>& SourceMap<mson::TypeSection>::operator=(const SourceMap<mson::TypeSection>& rhs)
 {
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new SourceMap<mson::Elements>(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+SourceMap<mson::TypeSection>& SourceMap<mson::TypeSection>::operator=(SourceMap<mson::TypeSection>&& rhs) noexcept
+{
+    this->description = std::move(rhs.description);
+    this->value = std::move(rhs.value);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -71,24 +92,18 @@ SourceMap<mson::TypeSection>::~SourceMap()
 
 SourceMap<mson::OneOf>& SourceMap<mson::Element>::oneOf()
 {
-    if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
-
-    return *m_elements;
+    return elements();
 }
 
 const SourceMap<mson::OneOf>& SourceMap<mson::Element>::oneOf() const
 {
-    if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
-
-    return *m_elements;
+    return elements();
 }
 
 SourceMap<mson::Elements>& SourceMap<mson::Element>::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new SourceMap<mson::Elements>);
 
     return *m_elements;
 }
@@ -96,7 +111,7 @@ SourceMap<mson::Elements>& SourceMap<mson::Element>::elements()
 const SourceMap<mson::Elements>& SourceMap<mson::Element>::elements() const
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return EmptyElements;
 
     return *m_elements;
 }
@@ -108,9 +123,15 @@ SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(const SourceMap<ms
     return *this;
 }
 
+SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(SourceMap<mson::Elements>&& rhs)
+{
+    m_elements.reset(::new SourceMap<mson::Elements>(std::move(rhs)));
+
+    return *this;
+}
+
 SourceMap<mson::Element>::SourceMap()
 {
-    m_elements.reset(::new SourceMap<mson::Elements>);
 }
 
 SourceMap<mson::Element>::SourceMap(const SourceMap<mson::Element>& rhs)
@@ -118,7 +139,18 @@ SourceMap<mson::Element>::SourceMap(const SourceMap<mson::Element>& rhs)
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+
+    if (rhs.m_elements.get())
+        m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+}
+
+// As with the copy constructor, source map of the element itself is left out
+SourceMap<mson::Element>::SourceMap(SourceMap<mson::Element>&& rhs) noexcept
+    : property(std::move(rhs.property))
+    , value(std::move(rhs.value))
+    , mixin(std::move(rhs.mixin))
+    , m_elements(std::move(rhs.m_elements))
+{
 }
 
 SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(const SourceMap<mson::Element>& rhs)
@@ -126,7 +158,17 @@ SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(const SourceMap<ms
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new SourceMap<mson::Elements>(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(SourceMap<mson::Element>&& rhs) noexcept
+{
+    this->property = std::move(rhs.property);
+    this->value = std::move(rhs.value);
+    this->mixin = std::move(rhs.mixin);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -78,13 +78,20 @@ namespace snowcrash
         /** Copy constructor */
         SourceMap(const SourceMap<mson::TypeSection>& rhs);
 
+        /** Move constructor */
+        SourceMap(SourceMap<mson::TypeSection>&& rhs) noexcept;
+
         /** Assignment operator */
         SourceMap<mson::TypeSection>& operator=(const SourceMap<mson::TypeSection>& rhs);
 
+        /** Move assignment operator */
+        SourceMap<mson::TypeSection>& operator=(SourceMap<mson::TypeSection>&& rhs) noexcept;
+
         /** Desctructor */
         ~SourceMap();
 
     private:
+        /** Allocated on the first modification, NULL while empty */
         std::unique_ptr<SourceMap<mson::Elements> > m_elements;
     };
 
@@ -162,6 +169,7 @@ namespace snowcrash
 
         /** Builds the structure from group of elements */
         SourceMap<mson::Element>& operator=(const SourceMap<mson::Elements>& rhs);
+        SourceMap<mson::Element>& operator=(SourceMap<mson::Elements>&& rhs);
 
         /** Constructor */
         SourceMap();
@@ -169,13 +177,20 @@ namespace snowcrash
         /** Copy constructor */
         SourceMap(const SourceMap<mson::Element>& rhs);
 
+        /** Move constructor */
+        SourceMap(SourceMap<mson::Element>&& rhs) noexcept;
+
         /** Assignment operator */
         SourceMap<mson::Element>& operator=(const SourceMap<mson::Element>& rhs);
 
+        /** Move assignment operator */
+        SourceMap<mson::Element>& operator=(SourceMap<mson::Element>&& rhs) noexcept;
+
         /** Destructor */
         ~SourceMap();
 
     private:
+        /** Allocated on the first modification, NULL while empty */
         std::unique_ptr<SourceMap<mson::Elements> > m_elements;
     };
 }
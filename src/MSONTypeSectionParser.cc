@@ -49,12 +49,11 @@ namespace snowcrash
                     if (parentSectionType != MSONPropertyMembersSectionType) {
 
                         // WARN: One of can not be a nested member for a non object structure type
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                        out.report.warnings.push_back(
-                            Warning("one-of can not be a nested member for a type not sub typed from object",
-                                LogicalErrorWarning,
-                                sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            LogicalErrorWarning,
+                            node->sourceMap,
+                            "one-of can not be a nested member for a type not sub typed from object");
 
                         return cur;
                     }
@@ -62,10 +61,10 @@ namespace snowcrash
                     IntermediateParseResult<mson::OneOf> oneOf(out.report);
                     cur = MSONOneOfParser::parse(node, siblings, pd, oneOf);
 
-                    element.build(oneOf.node);
+                    element.build(std::move(oneOf.node));
 
                     if (pd.exportSourceMap()) {
-                        elementSM = oneOf.sourceMap;
+                        elementSM = std::move(oneOf.sourceMap);
                     }
 
                     break;
@@ -77,20 +76,20 @@ namespace snowcrash
                         IntermediateParseResult<mson::PropertyMember> propertyMember(out.report);
                         cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                        element.build(propertyMember.node);
+                        element.build(std::move(propertyMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.property = propertyMember.sourceMap;
+                            elementSM.property = std::move(propertyMember.sourceMap);
                         }
                     } else {
 
                         IntermediateParseResult<mson::ValueMember> valueMember(out.report);
                         cur = MSONValueMemberParser::parse(node, siblings, pd, valueMember);
 
-                        element.build(valueMember.node);
+                        element.build(std::move(valueMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.value = valueMember.sourceMap;
+                            elementSM.value = std::move(valueMember.sourceMap);
                         }
                     }
 
@@ -106,14 +105,12 @@ namespace snowcrash
                 case MSONMixinSectionType:
                 case MSONOneOfSectionType: {
                     // WARN: mixin and oneOf not supported in sample/default
-                    std::stringstream ss;
-
-                    ss << "sample and default type sections cannot have `" << SectionName(pd.sectionContext())
-                       << "` type";
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "sample and default type sections cannot have `%s` type",
+                        SectionName(pd.sectionContext()));
                     break;
                 }
 
@@ -124,10 +121,10 @@ namespace snowcrash
                         IntermediateParseResult<mson::ValueMember> valueMember(out.report);
                         cur = MSONValueMemberParser::parse(node, siblings, pd, valueMember);
 
-                        element.build(valueMember.node);
+                        element.build(std::move(valueMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.value = valueMember.sourceMap;
+                            elementSM.value = std::move(valueMember.sourceMap);
                         }
                     } else if ((out.node.baseType == mson::ObjectBaseType
                                    || out.node.baseType == mson::ImplicitObjectBaseType)
@@ -136,10 +133,10 @@ namespace snowcrash
                         IntermediateParseResult<mson::PropertyMember> propertyMember(out.report);
                         cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                        element.build(propertyMember.node);
+                        element.build(std::move(propertyMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.property = propertyMember.sourceMap;
+                            elementSM.property = std::move(propertyMember.sourceMap);
                         }
                     }
 
@@ -150,7 +147,7 @@ namespace snowcrash
                             TwoNewLines(out.node.content.value);
                         }
 
-                        mdp::ByteBuffer content = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+                        mdp::ByteBuffer content = MapSourceData(node->sourceMap, pd);
                         out.node.content.value += content;
 
                         if (pd.exportSourceMap() && !content.empty()) {
@@ -169,10 +166,10 @@ namespace snowcrash
         }
 
         if (element.klass != mson::Element::UndefinedClass) {
-            out.node.content.elements().push_back(element);
+            out.node.content.elements().push_back(std::move(element));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.elements().collection.push_back(elementSM);
+                out.sourceMap.elements().collection.push_back(std::move(elementSM));
             }
         }
 
@@ -185,15 +182,22 @@ namespace snowcrash
 
         SectionType nestedType = UndefinedSectionType;
 
+        // Only confirm the keyword sections the node might match
+        KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+        if (candidates == NoKeywordCandidate) {
+            return MSONSectionType;
+        }
+
         // Check if mson mixin section
-        nestedType = SectionProcessor<mson::Mixin>::sectionType(node);
+        nestedType = CandidateSectionType<mson::Mixin>(node, candidates, MixinKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson one of section
-        nestedType = SectionProcessor<mson::OneOf>::sectionType(node);
+        nestedType = CandidateSectionType<mson::OneOf>(node, candidates, OneOfKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
@@ -65,14 +65,12 @@ namespace snowcrash
                 if (out.node.baseType != mson::ValueBaseType && out.node.baseType != mson::ImplicitValueBaseType) {
 
                     // WARN: Items/Members should only be allowed for value types
-                    std::stringstream ss;
-
-                    ss << "type section `" << signature.identifier;
-                    ss << "` not allowed for a type sub-typed from a primitive or object type";
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "type section `%s` not allowed for a type sub-typed from a primitive or object type",
+                        signature.identifier);
 
                     return node;
                 }
@@ -83,14 +81,12 @@ namespace snowcrash
                 if (out.node.baseType != mson::ObjectBaseType && out.node.baseType != mson::ImplicitObjectBaseType) {
 
                     // WARN: Properties should only be allowed for object types
-                    std::stringstream ss;
-
-                    ss << "type section `" << signature.identifier;
-                    ss << "` is only allowed for a type sub-typed from an object type";
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "type section `%s` is only allowed for a type sub-typed from an object type",
+                        signature.identifier);
 
                     return node;
                 }
@@ -117,25 +113,24 @@ namespace snowcrash
                         SourceMap<mson::Element> elementSM;
 
                         element.build(mson::parseValue(signature.values[i]));
-                        out.node.content.elements().push_back(element);
+                        out.node.content.elements().push_back(std::move(element));
 
                         if (pd.exportSourceMap()) {
 
                             elementSM.value.valueDefinition.sourceMap = node->sourceMap;
-                            out.sourceMap.elements().collection.push_back(elementSM);
+                            out.sourceMap.elements().collection.push_back(std::move(elementSM));
                         }
                     }
                 } else if (out.node.baseType == mson::ObjectBaseType
                     || out.node.baseType == mson::ImplicitObjectBaseType) {
 
                     // WARN: sample/default is for an object but it has values in signature
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(
-                        Warning("a sample and/or default type section for a type which is sub-typed from an object "
-                                "cannot have value(s) beside the keyword",
-                            LogicalErrorWarning,
-                            sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "a sample and/or default type section for a type which is sub-typed from an object "
+                        "cannot have value(s) beside the keyword");
                 }
             }
 
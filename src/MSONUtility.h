@@ -10,6 +10,7 @@
 #define SNOWCRASH_MSONUTILITY_H
 
 #include "MSONSourcemap.h"
+#include "WarningUtility.h"
 
 using namespace scpl;
 
@@ -301,14 +302,14 @@ namespace mson
      */
     inline void addDependency(const mdp::MarkdownNodeIterator& node,
         snowcrash::SectionParserData& pd,
-        const mson::Literal dependency,
-        const mson::Literal dependent,
+        const mson::Literal& dependency,
+        const mson::Literal& dependent,
         snowcrash::Report& report,
         bool circularCheck = false)
     {
 
         // First, check if the type exists
-        if (pd.namedTypeDependencyTable.find(dependency) == pd.namedTypeDependencyTable.end()) {
+        if (!pd.namedTypeDependencyGraph().contains(dependency)) {
 
             // ERR: We cannot find the dependency type
             std::stringstream ss;
@@ -320,10 +321,9 @@ namespace mson
             return;
         }
 
-        std::set<mson::Literal> dependencyDeps = pd.namedTypeDependencyTable[dependency];
-
         // Second, check if it is circular reference between them
-        if (circularCheck && (dependent == dependency || dependencyDeps.find(dependent) != dependencyDeps.end())) {
+        if (circularCheck
+            && (dependent == dependency || pd.namedTypeDependencyGraph().dependsOn(dependency, dependent))) {
 
             // ERR: Dependency named type circular references itself
             std::stringstream ss;
@@ -335,21 +335,13 @@ namespace mson
             return;
         }
 
-        // Third, check if the dependency is already in the list
-        if (pd.namedTypeDependencyTable[dependent].find(dependency) != pd.namedTypeDependencyTable[dependent].end()) {
-            return;
+        if (pd.addedDependencies) {
+            pd.addedDependencies->push_back(mson::NamedTypeDependency(dependent, dependency, circularCheck));
         }
 
-        for (mson::NamedTypeDependencyTable::iterator it = pd.namedTypeDependencyTable.begin();
-             it != pd.namedTypeDependencyTable.end();
-             ++it) {
-
-            // If the entry is dependent itself or contain dependent in its list
-            if (it->first == dependent || it->second.find(dependent) != it->second.end()) {
-
-                it->second.insert(dependency);
-                it->second.insert(dependencyDeps.begin(), dependencyDeps.end());
-            }
+        // Add to the dependent and to all the named types depending on it, unless already there
+        if (!pd.namedTypeDependencyGraph().dependsOn(dependent, dependency)) {
+            pd.modifiableNamedTypeDependencyGraph().addDependency(dependent, dependency);
         }
     }
 
@@ -380,10 +372,11 @@ namespace mson
                 if (foundTypeSpecification) {
 
                     // WARN: Ignoring unrecognized type attribute
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    report.warnings.push_back(snowcrash::Warning(
-                        "ignoring unrecognized type attribute", snowcrash::IgnoringWarning, sourceMap));
+                    snowcrash::ReportWarning(report,
+                        pd,
+                        snowcrash::IgnoringWarning,
+                        node->sourceMap,
+                        "ignoring unrecognized type attribute");
                 } else {
 
                     foundTypeSpecification = true;
@@ -412,13 +405,12 @@ namespace mson
             && !typeDefinition.typeSpecification.nestedTypes.empty()) {
 
             // WARN: Nested types for non (array or enum) structure base type
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-            report.warnings.push_back(
-                snowcrash::Warning("nested types should be present only for types which are sub typed from either "
-                                   "array or enum structure type",
-                    snowcrash::LogicalErrorWarning,
-                    sourceMap));
+            snowcrash::ReportWarning(report,
+                pd,
+                snowcrash::LogicalErrorWarning,
+                node->sourceMap,
+                "nested types should be present only for types which are sub typed from either "
+                "array or enum structure type");
         }
     }
 
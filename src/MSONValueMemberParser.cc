@@ -18,22 +18,29 @@ namespace snowcrash
 
         SectionType nestedType = UndefinedSectionType;
 
+        // Only confirm the keyword sections the node might match
+        KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+        if (candidates == NoKeywordCandidate) {
+            return MSONSectionType;
+        }
+
         // Check if mson type section section
-        nestedType = SectionProcessor<mson::TypeSection>::sectionType(node);
+        nestedType = CandidateSectionType<mson::TypeSection>(node, candidates, TypeSectionKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson mixin section
-        nestedType = SectionProcessor<mson::Mixin>::sectionType(node);
+        nestedType = CandidateSectionType<mson::Mixin>(node, candidates, MixinKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson one of section
-        nestedType = SectionProcessor<mson::OneOf>::sectionType(node);
+        nestedType = CandidateSectionType<mson::OneOf>(node, candidates, OneOfKeywordCandidate);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
@@ -74,12 +81,12 @@ namespace snowcrash
             mson::TypeSection typeSection(mson::TypeSection::MemberTypeClass);
 
             typeSection.baseType = baseType;
-            sections.node.push_back(typeSection);
+            sections.node.push_back(std::move(typeSection));
 
             if (pd.exportSourceMap()) {
 
                 SourceMap<mson::TypeSection> typeSectionSM;
-                sections.sourceMap.collection.push_back(typeSectionSM);
+                sections.sourceMap.collection.push_back(std::move(typeSectionSM));
             }
         }
 
@@ -94,13 +101,12 @@ namespace snowcrash
             if (!isSameBaseType(baseType, mixin.node.baseType)) {
 
                 // WARN: Mixin base type should be compatible with the parent base type
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                sections.report.warnings.push_back(
-                    Warning("mixin base type should be the same as parent base type. objects should contain object "
-                            "mixins. arrays should contain array mixins",
-                        LogicalErrorWarning,
-                        sourceMap));
+                ReportWarning(sections.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "mixin base type should be the same as parent base type. objects should contain object "
+                    "mixins. arrays should contain array mixins");
             } else {
                 element.build(mixin.node);
 
@@ -113,10 +119,11 @@ namespace snowcrash
             if (baseType != mson::ObjectBaseType && baseType != mson::ImplicitObjectBaseType) {
 
                 // WARN: One of can not be a nested member for a non object structure type
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                sections.report.warnings.push_back(Warning(
-                    "one of may be a nested member of a object sub-types only", LogicalErrorWarning, sourceMap));
+                ReportWarning(sections.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "one of may be a nested member of a object sub-types only");
 
                 return cur;
             }
@@ -124,10 +131,10 @@ namespace snowcrash
             IntermediateParseResult<mson::OneOf> oneOf(sections.report);
             cur = MSONOneOfParser::parse(node, siblings, pd, oneOf);
 
-            element.build(oneOf.node);
+            element.build(std::move(oneOf.node));
 
             if (pd.exportSourceMap()) {
-                elementSM = oneOf.sourceMap;
+                elementSM = std::move(oneOf.sourceMap);
             }
         } else {
 
@@ -137,8 +144,6 @@ namespace snowcrash
                 IntermediateParseResult<mson::ValueMember> valueMember(sections.report);
                 cur = MSONValueMemberParser::parse(node, siblings, pd, valueMember);
 
-                element.build(valueMember.node);
-
                 if ((valueMember.node.valueDefinition.typeDefinition.baseType == mson::ImplicitObjectBaseType
                         || valueMember.node.valueDefinition.typeDefinition.baseType == mson::ObjectBaseType)
                     && !valueMember.node.valueDefinition.values.empty()) {
@@ -146,17 +151,18 @@ namespace snowcrash
                     // e.g
                     // - a (array)
                     //   - key (object)
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    sections.report.warnings.push_back(
-                        Warning("array member definition of type 'object' contains value. You should use type "
-                                "definition without value eg. '- (object)'",
-                            LogicalErrorWarning,
-                            sourceMap));
+                    ReportWarning(sections.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "array member definition of type 'object' contains value. You should use type "
+                        "definition without value eg. '- (object)'");
                 }
 
+                element.build(std::move(valueMember.node));
+
                 if (pd.exportSourceMap()) {
-                    elementSM.value = valueMember.sourceMap;
+                    elementSM.value = std::move(valueMember.sourceMap);
                 }
             } else if ((baseType == mson::ObjectBaseType || baseType == mson::ImplicitObjectBaseType)
                 && node->type == mdp::ListItemMarkdownNodeType) {
@@ -164,49 +170,47 @@ namespace snowcrash
                 IntermediateParseResult<mson::PropertyMember> propertyMember(sections.report);
                 cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                element.build(propertyMember.node);
-
                 if ((propertyMember.node.valueDefinition.typeDefinition.baseType == mson::ImplicitObjectBaseType
                         || propertyMember.node.valueDefinition.typeDefinition.baseType == mson::ObjectBaseType)
                     && !propertyMember.node.valueDefinition.values.empty()) {
                     // WARN: object definition contain value
                     // e.g
                     // - key: value (object)
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    sections.report.warnings.push_back(
-                        Warning("'object' with value definition. You should use type definition without value eg. '- "
-                                "key (object)'",
-                            LogicalErrorWarning,
-                            sourceMap));
+                    ReportWarning(sections.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "'object' with value definition. You should use type definition without value eg. '- "
+                        "key (object)'");
                 }
 
+                element.build(std::move(propertyMember.node));
+
                 if (pd.exportSourceMap()) {
-                    elementSM.property = propertyMember.sourceMap;
+                    elementSM.property = std::move(propertyMember.sourceMap);
                 }
             } else if (baseType == mson::PrimitiveBaseType || baseType == mson::ImplicitPrimitiveBaseType) {
 
                 // WARN: Primitive type members should not have nested members
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                sections.report.warnings.push_back(Warning(
-                    "sub-types of primitive types should not have nested members", LogicalErrorWarning, sourceMap));
+                ReportWarning(sections.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "sub-types of primitive types should not have nested members");
             } else {
 
                 // WARN: Ignoring unrecognized block in mson nested members
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                sections.report.warnings.push_back(Warning("ignoring unrecognized block", IgnoringWarning, sourceMap));
+                ReportWarning(sections.report, pd, IgnoringWarning, node->sourceMap, "ignoring unrecognized block");
 
                 cur = ++MarkdownNodeIterator(node);
             }
         }
 
         if (element.klass != mson::Element::UndefinedClass) {
-            sections.node.back().content.elements().push_back(element);
+            sections.node.back().content.elements().push_back(std::move(element));
 
             if (pd.exportSourceMap()) {
-                sections.sourceMap.collection.back().elements().collection.push_back(elementSM);
+                sections.sourceMap.collection.back().elements().collection.push_back(std::move(elementSM));
             }
         }
 
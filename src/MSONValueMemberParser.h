@@ -214,14 +214,14 @@ namespace snowcrash
             mson::TypeSection typeSection(mson::TypeSection::BlockDescriptionClass);
 
             typeSection.content.description = remainingContent;
-            sections.push_back(typeSection);
+            sections.push_back(std::move(typeSection));
 
             if (pd.exportSourceMap()) {
 
                 SourceMap<mson::TypeSection> typeSectionSM;
 
                 typeSectionSM.description.sourceMap = node->sourceMap;
-                sourceMap.collection.push_back(typeSectionSM);
+                sourceMap.collection.push_back(std::move(typeSectionSM));
             }
         }
 
@@ -258,7 +258,7 @@ namespace snowcrash
                     TwoNewLines(sections[0].content.description);
                 }
 
-                mdp::ByteBuffer content = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+                mdp::ByteBuffer content = MapSourceData(node->sourceMap, pd);
                 TrimString(content);
 
                 sections[0].content.description += content;
@@ -307,10 +307,10 @@ namespace snowcrash
                 cur = PARSER::parse(node, siblings, pd, typeSection);
 
                 if (typeSection.node.klass != mson::TypeSection::UndefinedClass) {
-                    sections.node.push_back(typeSection.node);
+                    sections.node.push_back(std::move(typeSection.node));
 
                     if (pd.exportSourceMap()) {
-                        sections.sourceMap.collection.push_back(typeSection.sourceMap);
+                        sections.sourceMap.collection.push_back(std::move(typeSection.sourceMap));
                     }
                 }
             }
@@ -0,0 +1,67 @@
+//
+//  MappedFile.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_MAPPEDFILE_H
+#define SNOWCRASH_MAPPEDFILE_H
+
+#include <string>
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Read-only memory mapping of a whole file
+     *
+     *  The file is mapped on construction and unmapped on destruction, its
+     *  content is neither copied nor NUL terminated. Pages are read by the
+     *  operating system on first access and can be dropped under memory
+     *  pressure, the file must not be modified while mapped.
+     */
+    class MappedFile
+    {
+    public:
+        /** Map the file at \a path, check `isOpen()` for failure */
+        explicit MappedFile(const std::string& path);
+        ~MappedFile();
+
+        /** True if the file is mapped, an empty file is mapped with no data */
+        bool isOpen() const
+        {
+            return m_open;
+        }
+
+        /** \return Content of the file, not NUL terminated */
+        const char* data() const
+        {
+            return m_data;
+        }
+
+        /** \return Size of the file in bytes */
+        size_t length() const
+        {
+            return m_length;
+        }
+
+        /** \return Reason of the failure if the file is not mapped */
+        const std::string& error() const
+        {
+            return m_error;
+        }
+
+    private:
+        const char* m_data;
+        size_t m_length;
+        bool m_open;
+        std::string m_error;
+
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+    };
+}
+
+#endif
@@ -141,13 +141,12 @@ namespace snowcrash
             // Check redefinition
             if (!out.node.values.empty()) {
                 // WARN: parameter values are already defined
-                std::stringstream ss;
-                ss << "overshadowing previous 'values' definition";
-                ss << " for parameter '" << out.node.name << "'";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), RedefinitionWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    RedefinitionWarning,
+                    node->sourceMap,
+                    "overshadowing previous 'values' definition for parameter '%s'",
+                    out.node.name);
             }
 
             // Clear any previous values
@@ -162,12 +161,12 @@ namespace snowcrash
 
             if (out.node.values.empty()) {
                 // WARN: empty definition
-                std::stringstream ss;
-                ss << "no possible values specified for parameter '" << out.node.name << "'";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    EmptyDefinitionWarning,
+                    node->sourceMap,
+                    "no possible values specified for parameter '%s'",
+                    out.node.name);
             }
 
             return ++MarkdownNodeIterator(node);
@@ -229,7 +228,9 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<Values>::sectionType(node);
+            KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+            return CandidateSectionType<Values>(node, candidates, ValuesKeywordCandidate);
         }
 
         template <typename T>
@@ -303,13 +304,12 @@ namespace snowcrash
         {
 
             // WARN: Additional parameters traits warning
-            std::stringstream ss;
-            ss << "unable to parse additional parameter traits";
-            ss << (oldSyntax ? OldSyntaxAdditionalTraitsWarning : NewSyntaxAdditionalTraitsWarning);
-
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-            out.report.warnings.push_back(Warning(ss.str(), FormattingWarning, sourceMap));
+            ReportWarning(out.report,
+                pd,
+                FormattingWarning,
+                node->sourceMap,
+                "unable to parse additional parameter traits%s",
+                oldSyntax ? OldSyntaxAdditionalTraitsWarning : NewSyntaxAdditionalTraitsWarning);
 
             out.node.type.clear();
             out.node.use = UndefinedParameterUse;
@@ -338,14 +338,13 @@ namespace snowcrash
             if (out.node.use != OptionalParameterUse && !out.node.defaultValue.empty()) {
 
                 // WARN: Required vs default clash
-                std::stringstream ss;
-                ss << "specifying parameter '" << out.node.name
-                   << "' as required supersedes its default value"
-                      ", declare the parameter as 'optional' to specify its default value";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "specifying parameter '%s' as required supersedes its default value"
+                    ", declare the parameter as 'optional' to specify its default value",
+                    out.node.name);
             }
         }
 
@@ -362,9 +361,6 @@ namespace snowcrash
             bool isExampleFound = false;
             bool isDefaultFound = false;
 
-            std::stringstream ss;
-            bool printWarning = false;
-
             for (Collection<Value>::iterator it = out.node.values.begin(); it != out.node.values.end(); ++it) {
 
                 if (out.node.exampleValue == *it) {
@@ -376,26 +372,42 @@ namespace snowcrash
                 }
             }
 
-            if (!out.node.exampleValue.empty() && !isExampleFound) {
+            bool isExampleMissing = !out.node.exampleValue.empty() && !isExampleFound;
+            bool isDefaultMissing = !out.node.defaultValue.empty() && !isDefaultFound;
 
-                // WARN: missing example in values.
-                ss << "the example value '" << out.node.exampleValue << "' of parameter '" << out.node.name
-                   << "' is not in its list of expected values";
-                printWarning = true;
-            }
+            if (isExampleMissing && isDefaultMissing) {
 
-            if (!out.node.defaultValue.empty() && !isDefaultFound) {
+                // WARN: missing example and default in values.
+                ReportWarning(out.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "the example value '%s' of parameter '%s' is not in its list of expected values"
+                    "the default value '%s' of parameter '%s' is not in its list of expected values",
+                    out.node.exampleValue,
+                    out.node.name,
+                    out.node.defaultValue,
+                    out.node.name);
+            } else if (isExampleMissing) {
 
-                // WARN: missing default in values.
-                ss << "the default value '" << out.node.defaultValue << "' of parameter '" << out.node.name
-                   << "' is not in its list of expected values";
-                printWarning = true;
-            }
+                // WARN: missing example in values.
+                ReportWarning(out.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "the example value '%s' of parameter '%s' is not in its list of expected values",
+                    out.node.exampleValue,
+                    out.node.name);
+            } else if (isDefaultMissing) {
 
-            if (printWarning) {
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
+                // WARN: missing default in values.
+                ReportWarning(out.report,
+                    pd,
+                    LogicalErrorWarning,
+                    node->sourceMap,
+                    "the default value '%s' of parameter '%s' is not in its list of expected values",
+                    out.node.defaultValue,
+                    out.node.name);
             }
         }
 
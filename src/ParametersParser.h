@@ -49,13 +49,12 @@ namespace snowcrash
             if (!remainingContent.empty()) {
 
                 // WARN: Extra content in parameters section
-                std::stringstream ss;
-                ss << "ignoring additional content after 'parameters' keyword,";
-                ss << " expected a nested list of parameters, one parameter per list item";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    IgnoringWarning,
+                    node->sourceMap,
+                    "ignoring additional content after 'parameters' keyword,"
+                    " expected a nested list of parameters, one parameter per list item");
             }
 
             return ++MarkdownNodeIterator(node);
@@ -93,19 +92,19 @@ namespace snowcrash
                     removeParameter(duplicate, pd, out);
 
                     // WARN: Parameter already defined
-                    std::stringstream ss;
-                    ss << "overshadowing previous parameter '" << parameter.node.name << "' definition";
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), RedefinitionWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        RedefinitionWarning,
+                        node->sourceMap,
+                        "overshadowing previous parameter '%s' definition",
+                        parameter.node.name);
                 }
             }
 
-            out.node.push_back(parameter.node);
+            out.node.push_back(std::move(parameter.node));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.collection.push_back(parameter.sourceMap);
+                out.sourceMap.collection.push_back(std::move(parameter.sourceMap));
             }
 
             return ++MarkdownNodeIterator(node);
@@ -142,9 +141,7 @@ namespace snowcrash
             if (out.node.empty()) {
 
                 // WARN: No parameters defined
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(NoParametersMessage, FormattingWarning, sourceMap));
+                ReportWarning(out.report, pd, FormattingWarning, node->sourceMap, NoParametersMessage);
             }
         }
 
@@ -204,22 +201,33 @@ namespace snowcrash
         const ParseResultRef<T>& out)
     {
 
+        // Nothing else is checked
+        if (pd.isWarningSuppressed(LogicalErrorWarning))
+            return;
+
         for (ParameterIterator it = parameters.begin(); it != parameters.end(); ++it) {
 
             if (!isValidUriTemplateParam(out.node.uriTemplate, it->name)) {
 
                 // WARN: parameter name not present
-                std::stringstream ss;
-                ss << "parameter '" << it->name << "' is not found within the URI template '" << out.node.uriTemplate
-                   << "'";
-
-                if (!out.node.name.empty()) {
-                    ss << " for '" << out.node.name << "' ";
+                if (out.node.name.empty()) {
+                    ReportWarning(out.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "parameter '%s' is not found within the URI template '%s'",
+                        it->name,
+                        out.node.uriTemplate);
+                } else {
+                    ReportWarning(out.report,
+                        pd,
+                        LogicalErrorWarning,
+                        node->sourceMap,
+                        "parameter '%s' is not found within the URI template '%s' for '%s' ",
+                        it->name,
+                        out.node.uriTemplate,
+                        out.node.name);
                 }
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
             }
         }
     }
@@ -0,0 +1,166 @@
+//
+//  ParseCache.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include "ParseCache.h"
+#include "Serialization.h"
+
+using namespace snowcrash;
+
+/** Options not affecting the parse result, the cached warnings are always formatted */
+static const BlueprintParserOptions ResultIndependentOptions = ParallelParsingOption | DeferWarningsOption;
+
+/** \return 64-bit FNV-1a hash of the data continuing from the hash */
+static uint64_t HashBytes(const char* data, size_t length, uint64_t hash = 14695981039346656037ULL)
+{
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/** \return Header of an entry, a cached result is only used if its header is the same */
+static std::string EntryHeader(const mdp::ByteBuffer& source, BlueprintParserOptions options, const std::string& version)
+{
+    std::stringstream ss;
+    ss << "snowcrash:" << SerializationFormatVersion << ":" << ParseCacheParserVersion << ":" << options << ":"
+       << source.size() << ":" << version.size() << ":" << version << "\n";
+
+    return ss.str();
+}
+
+ParseCache::ParseCache(const std::string& directory, const std::string& version)
+    : m_directory(directory), m_version(version), m_hits(0), m_misses(0), m_writes(0)
+{
+}
+
+std::string ParseCache::entryPath(const mdp::ByteBuffer& source, BlueprintParserOptions options) const
+{
+    std::string header = EntryHeader(source, options & ~ResultIndependentOptions, m_version);
+
+    uint64_t hash = HashBytes(header.data(), header.size());
+    hash = HashBytes(source.data(), source.size(), hash);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.snowcrash", static_cast<unsigned long long>(hash));
+
+    if (m_directory.empty())
+        return name;
+
+    char last = m_directory[m_directory.size() - 1];
+
+    if (last == '/' || last == '\\')
+        return m_directory + name;
+
+    return m_directory + "/" + name;
+}
+
+int ParseCache::parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+{
+    std::string path = entryPath(source, options);
+
+    if (load(path, source, options & ~ResultIndependentOptions, out)) {
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return out.report.error.code;
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+
+    int result = snowcrash::parse(source, options, out);
+    FormatWarnings(out.report, source);
+    store(path, source, options & ~ResultIndependentOptions, out);
+
+    return result;
+}
+
+bool ParseCache::load(const std::string& path,
+    const mdp::ByteBuffer& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out) const
+{
+    std::ifstream entry(path.c_str(), std::ios::binary | std::ios::ate);
+
+    if (!entry.is_open())
+        return false;
+
+    std::streamoff size = entry.tellg();
+    std::string header = EntryHeader(source, options, m_version);
+
+    if (size < static_cast<std::streamoff>(header.size() + source.size()))
+        return false;
+
+    entry.seekg(0);
+
+    // Compare the header and the source data before reading the result
+    mdp::ByteBuffer buffer(header.size(), '\0');
+
+    if (!entry.read(&buffer[0], buffer.size()) || buffer != header)
+        return false;
+
+    if (!source.empty()) {
+        buffer.resize(source.size());
+
+        if (!entry.read(&buffer[0], buffer.size()) || buffer != source)
+            return false;
+    }
+
+    buffer.resize(static_cast<size_t>(size) - header.size() - source.size());
+
+    if (!buffer.empty() && !entry.read(&buffer[0], buffer.size()))
+        return false;
+
+    return DeserializeParseResult(buffer, out);
+}
+
+void ParseCache::store(const std::string& path,
+    const mdp::ByteBuffer& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& result)
+{
+    mdp::ByteBuffer data = EntryHeader(source, options, m_version);
+    data.append(source);
+    SerializeParseResult(result, data);
+
+    // Unique name of the temporary file among threads and processes
+    std::stringstream ss;
+    ss << path << "." << std::hash<std::thread::id>()(std::this_thread::get_id()) << "."
+       << std::chrono::steady_clock::now().time_since_epoch().count() << "."
+       << m_writes.fetch_add(1, std::memory_order_relaxed) << ".tmp";
+
+    std::string temporaryPath = ss.str();
+
+    {
+        std::ofstream entry(temporaryPath.c_str(), std::ios::binary | std::ios::trunc);
+
+        if (!entry.is_open())
+            return;
+
+        if (!entry.write(data.data(), data.size())) {
+            entry.close();
+            std::remove(temporaryPath.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(temporaryPath.c_str(), path.c_str()) == 0)
+        return;
+
+    // Renaming does not replace an existing file on Windows
+    std::remove(path.c_str());
+
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+        std::remove(temporaryPath.c_str());
+}
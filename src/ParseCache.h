@@ -0,0 +1,103 @@
+//
+//  ParseCache.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARSECACHE_H
+#define SNOWCRASH_PARSECACHE_H
+
+#include <atomic>
+#include <string>
+#include "snowcrash.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  Version of the parser output stored in the cache, bump whenever a
+     *  change of the parser changes its AST, source map or report.
+     *
+     *  1   Initial version
+     *  2   Whitespace-only lines of headers sections are skipped. Also
+     *      covers keyword sections recognized only within their parent
+     *      section and warnings formatted once parsed, which changed the
+     *      output without a bump of their own.
+     */
+    const unsigned int ParseCacheParserVersion = 2;
+
+    /**
+     *  \brief  Persistent cache of parse results
+     *
+     *  Results are stored in a directory, one file per source data and
+     *  options, keyed by a hash of both. An entry holds the source data it
+     *  was parsed from, a hit is only returned for the very same source
+     *  data, options, serialization format and parser version. Any other
+     *  entry, e.g. written by an older parser, is parsed again and replaced.
+     *
+     *  Entries are written to a temporary file first and renamed, a cache
+     *  can be shared by threads and processes.
+     */
+    class ParseCache
+    {
+    public:
+        /**
+         *  \param directory    Existing directory to store the entries in.
+         *  \param version      Version of the application, entries of other versions are not used.
+         */
+        explicit ParseCache(const std::string& directory, const std::string& version = std::string());
+
+        /**
+         *  \brief Parse the source data, or load the result of a previous parse.
+         *
+         *  Gives the same result as `parse()`, except that the warnings are
+         *  always formatted. Failing to read or write an entry is not an
+         *  error, the source data are parsed instead.
+         *
+         *  \param source       A textual source data to be parsed.
+         *  \param options      Parser options. Use 0 for no additional options.
+         *  \param out          Output buffer to store parsing result into.
+         *  \return Error status code. Zero represents success, non-zero a failure.
+         */
+        int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+
+        /** \return Path of the entry of the source data and options */
+        std::string entryPath(const mdp::ByteBuffer& source, BlueprintParserOptions options) const;
+
+        /** \return Number of parses served from the cache */
+        size_t hits() const
+        {
+            return m_hits.load(std::memory_order_relaxed);
+        }
+
+        /** \return Number of parses not found in the cache */
+        size_t misses() const
+        {
+            return m_misses.load(std::memory_order_relaxed);
+        }
+
+    private:
+        const std::string m_directory;
+        const std::string m_version;
+        std::atomic<size_t> m_hits;
+        std::atomic<size_t> m_misses;
+        std::atomic<size_t> m_writes;
+
+        bool load(const std::string& path,
+            const mdp::ByteBuffer& source,
+            BlueprintParserOptions options,
+            const ParseResultRef<Blueprint>& out) const;
+
+        void store(const std::string& path,
+            const mdp::ByteBuffer& source,
+            BlueprintParserOptions options,
+            const ParseResultRef<Blueprint>& result);
+
+        ParseCache(const ParseCache&);
+        ParseCache& operator=(const ParseCache&);
+    };
+}
+
+#endif
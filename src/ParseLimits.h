@@ -0,0 +1,195 @@
+//
+//  ParseLimits.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARSELIMITS_H
+#define SNOWCRASH_PARSELIMITS_H
+
+#include <atomic>
+#include <chrono>
+#include "SourceAnnotation.h"
+
+namespace snowcrash
+{
+
+    /** Parsing cancelled error message */
+    const char* const ParsingCancelledMessage = "parsing has been cancelled";
+
+    /** Parsing deadline exceeded error message */
+    const char* const DeadlineExceededMessage = "parsing has exceeded its deadline";
+
+    /** Memory budget exceeded error message */
+    const char* const MemoryBudgetExceededMessage = "parsing has exceeded its memory budget";
+
+    /**
+     *  \brief Token to cancel parsing from another thread
+     *
+     *  A token can be shared by any number of parses, cancelling the
+     *  token cancels all of them.
+     */
+    class CancellationToken
+    {
+    public:
+        CancellationToken() : m_cancelled(false) {}
+
+        /** Cancel the parses using the token */
+        void cancel()
+        {
+            m_cancelled.store(true, std::memory_order_relaxed);
+        }
+
+        /** \return True if cancelled */
+        bool isCancelled() const
+        {
+            return m_cancelled.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<bool> m_cancelled;
+
+        CancellationToken(const CancellationToken&);
+        CancellationToken& operator=(const CancellationToken&);
+    };
+
+    /** Point in time a parse is aborted at */
+    typedef std::chrono::steady_clock::time_point ParseDeadline;
+
+    /**
+     *  \brief Limits of a parse
+     *
+     *  The deadline and the cancellation are checked cooperatively, before
+     *  every nested section, after every Markdown block and while resolving
+     *  lazy references. A parse exceeding them is aborted with
+     *  `CancelledError`, a parse exceeding its memory budget with
+     *  `MemoryBudgetError`. The report keeps the warnings found so far.
+     *
+     *  Warnings past the warning limit are dropped, suppressed warnings are
+     *  not reported at all. Neither of them is ever formatted.
+     */
+    struct ParseLimits {
+
+        ParseLimits()
+            : deadline(ParseDeadline::max())
+            , cancellationToken(NULL)
+            , memoryBudget(0)
+            , warningLimit(0)
+            , suppressedWarnings(0)
+        {
+        }
+
+        /** Deadline of the parse, `ParseDeadline::max()` for none */
+        ParseDeadline deadline;
+
+        /** Token to cancel the parse, NULL for none */
+        const CancellationToken* cancellationToken;
+
+        /** Bytes the parse may use as accounted by `ParseMemory`, 0 for no budget */
+        size_t memoryBudget;
+
+        /** Maximum number of warnings reported, the first ones in the order they are reported, 0 for no limit */
+        size_t warningLimit;
+
+        /** Codes of the warnings not to be reported */
+        WarningMask suppressedWarnings;
+
+        /** \return True if a deadline or a cancellation token is set */
+        bool isLimited() const
+        {
+            return deadline != ParseDeadline::max() || cancellationToken != NULL;
+        }
+
+        /** \return True if the parse is cancelled or past its deadline */
+        bool isExceeded() const
+        {
+            return (cancellationToken && cancellationToken->isCancelled())
+                || (deadline != ParseDeadline::max() && std::chrono::steady_clock::now() >= deadline);
+        }
+    };
+
+    /**
+     *  \brief  Abort parsing if the limits are exceeded
+     *  \throw  Error with `CancelledError` code
+     */
+    inline void CheckParseLimits(const ParseLimits& limits)
+    {
+        if (limits.cancellationToken && limits.cancellationToken->isCancelled())
+            throw Error(ParsingCancelledMessage, CancelledError);
+
+        if (limits.deadline != ParseDeadline::max() && std::chrono::steady_clock::now() >= limits.deadline)
+            throw Error(DeadlineExceededMessage, CancelledError);
+    }
+
+    /**
+     *  \brief Memory used by a parse
+     *
+     *  Bytes are estimated where the big allocations are made: the Markdown
+     *  AST once parsed, the character index, every parsed section and its
+     *  source map, and the source data copied into the AST. Charged by the
+     *  workers of a parse concurrently.
+     */
+    class ParseMemory
+    {
+    public:
+        explicit ParseMemory(size_t budget = 0) : m_budget(budget), m_current(0), m_peak(0) {}
+
+        /**
+         *  \brief Account allocated bytes
+         *  \throw Error with `MemoryBudgetError` code if over the budget
+         */
+        void charge(size_t bytes)
+        {
+            size_t current = m_current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            size_t peak = m_peak.load(std::memory_order_relaxed);
+
+            while (current > peak && !m_peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+            }
+
+            if (m_budget && current > m_budget)
+                throw Error(MemoryBudgetExceededMessage, MemoryBudgetError);
+        }
+
+        /** Account freed bytes */
+        void release(size_t bytes)
+        {
+            m_current.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        /** \return Bytes in use */
+        size_t current() const
+        {
+            return m_current.load(std::memory_order_relaxed);
+        }
+
+        /** \return Most bytes in use so far */
+        size_t peak() const
+        {
+            return m_peak.load(std::memory_order_relaxed);
+        }
+
+    private:
+        const size_t m_budget;
+        std::atomic<size_t> m_current;
+        std::atomic<size_t> m_peak;
+
+        ParseMemory(const ParseMemory&);
+        ParseMemory& operator=(const ParseMemory&);
+    };
+
+    /** Statistics of a parse, in bytes as estimated by `ParseMemory` */
+    struct ParseStatistics {
+
+        ParseStatistics() : peakMemory(0), finalMemory(0) {}
+
+        /** Most memory used while parsing */
+        size_t peakMemory;
+
+        /** Memory held by the parse result, the AST, its source map and the report */
+        size_t finalMemory;
+    };
+}
+
+#endif
@@ -69,10 +69,11 @@ namespace snowcrash
             if (out.node.name.empty()
                 && (pd.sectionContext() == ResponseSectionType || pd.sectionContext() == ResponseBodySectionType)) {
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(
-                    "missing response HTTP status code, assuming 'Response 200'", EmptyDefinitionWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    EmptyDefinitionWarning,
+                    node->sourceMap,
+                    "missing response HTTP status code, assuming 'Response 200'");
                 out.node.name = "200";
             }
 
@@ -115,14 +116,12 @@ namespace snowcrash
 
             if (!out.node.reference.id.empty()) {
                 // WARN: ignoring extraneous content after model reference
-                std::stringstream ss;
-
-                ss << "ignoring extraneous content after model reference";
-                ss << ", expected model reference only e.g. '[" << out.node.reference.id << "][]'";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    IgnoringWarning,
+                    node->sourceMap,
+                    "ignoring extraneous content after model reference, expected model reference only e.g. '[%s][]'",
+                    out.node.reference.id);
             } else {
 
                 if (!out.node.body.empty() || node->type != mdp::ParagraphMarkdownNodeType
@@ -165,12 +164,11 @@ namespace snowcrash
                 case ParametersSectionType: {
                     if (pd.parentSectionContext() != RequestSectionType) {
                         // WARN: Only request section can have parameters section
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                        out.report.warnings.push_back(
-                            Warning("ignoring parameters section in a non request payload section",
-                                IgnoringWarning,
-                                sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            IgnoringWarning,
+                            node->sourceMap,
+                            "ignoring parameters section in a non request payload section");
 
                         return ++MarkdownNodeIterator(node);
                     }
@@ -182,12 +180,11 @@ namespace snowcrash
                 case BodySectionType: {
                     if (!out.node.body.empty()) {
                         // WARN: Multiple body section
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                        out.report.warnings.push_back(
-                            Warning("ignoring additional 'body' content, it is already defined",
-                                RedefinitionWarning,
-                                sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            RedefinitionWarning,
+                            node->sourceMap,
+                            "ignoring additional 'body' content, it is already defined");
                     }
 
                     ParseResultRef<Asset> asset(out.report, out.node.body, out.sourceMap.body);
@@ -197,12 +194,11 @@ namespace snowcrash
                 case SchemaSectionType: {
                     if (!out.node.schema.empty()) {
                         // WARN: Multiple schema section
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                        out.report.warnings.push_back(
-                            Warning("ignoring additional 'schema' content, it is already defined",
-                                RedefinitionWarning,
-                                sourceMap));
+                        ReportWarning(out.report,
+                            pd,
+                            RedefinitionWarning,
+                            node->sourceMap,
+                            "ignoring additional 'schema' content, it is already defined");
                     }
 
                     ParseResultRef<Asset> asset(out.report, out.node.schema, out.sourceMap.schema);
@@ -294,29 +290,36 @@ namespace snowcrash
 
             SectionType nestedType = UndefinedSectionType;
 
+            // Only confirm the keyword sections the node might match
+            KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+            if (candidates == NoKeywordCandidate) {
+                return UndefinedSectionType;
+            }
+
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = CandidateSectionType<Headers>(node, candidates, HeadersKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if asset section
-            nestedType = SectionProcessor<Asset>::sectionType(node);
+            nestedType = CandidateSectionType<Asset>(node, candidates, AssetKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if attributes section
-            nestedType = SectionProcessor<Attributes>::sectionType(node);
+            nestedType = CandidateSectionType<Attributes>(node, candidates, AttributesKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = CandidateSectionType<Parameters>(node, candidates, ParametersKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -436,32 +439,35 @@ namespace snowcrash
 
                 if (!target.empty()) {
                     // WARN: unable to parse payload signature
-                    std::stringstream ss;
-                    ss << "unable to parse " << SectionName(pd.sectionContext()) << " signature, expected ";
+                    const char* expected;
 
                     switch (pd.sectionContext()) {
                         case RequestSectionType:
                         case RequestBodySectionType:
-                            ss << "'request [<identifier>] [(<media type>)]'";
+                            expected = "'request [<identifier>] [(<media type>)]'";
                             break;
 
                         case ResponseBodySectionType:
                         case ResponseSectionType:
-                            ss << "'response [<HTTP status code>] [(<media type>)]'";
+                            expected = "'response [<HTTP status code>] [(<media type>)]'";
                             break;
 
                         case ModelSectionType:
                         case ModelBodySectionType:
-                            ss << "'model [(<media type>)]'";
+                            expected = "'model [(<media type>)]'";
                             break;
 
                         default:
                             return false;
                     }
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), FormattingWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        FormattingWarning,
+                        node->sourceMap,
+                        "unable to parse %s signature, expected %s",
+                        SectionName(pd.sectionContext()),
+                        expected);
 
                     return false;
                 }
@@ -553,9 +559,12 @@ namespace snowcrash
         {
 
             SourceMap<ResourceModel> modelSM;
-            ResourceModel model = pd.modelTable.find(out.node.reference.id)->second;
+            const ResourceModel& model = pd.modelTable.find(out.node.reference.id)->second;
+
+            if (!pd.validateOnly()) {
+                out.node.description = model.description;
+            }
 
-            out.node.description = model.description;
             out.node.parameters = model.parameters;
 
             HeaderIterator modelContentTypeIt = std::find_if(model.headers.begin(),
@@ -568,14 +577,13 @@ namespace snowcrash
             if (isPayloadContentType && isModelContentType) {
 
                 // WARN: Ignoring payload content-type, when referencing a model with headers
-                std::stringstream ss;
-
-                ss << "ignoring additional " << SectionName(pd.sectionContext()) << " header(s), ";
-                ss << "specify this header(s) in the referenced model definition instead";
-
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(
-                    out.node.reference.meta.node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    IgnoringWarning,
+                    out.node.reference.meta.node->sourceMap,
+                    "ignoring additional %s header(s), "
+                    "specify this header(s) in the referenced model definition instead",
+                    SectionName(pd.sectionContext()));
             }
 
             if (isPayloadContentType && !isModelContentType) {
@@ -645,20 +653,33 @@ namespace snowcrash
                 if (warnEmptyBody) {
 
                     // WARN: empty body
-                    std::stringstream ss;
-                    ss << "empty " << SectionName(RequestSectionType) << " " << SectionName(BodySectionType);
+                    std::string request = SectionName(RequestSectionType);
+                    std::string body = SectionName(BodySectionType);
 
                     if (!contentLength.empty()) {
-                        ss << ", expected " << SectionName(BodySectionType) << " for '" << contentLength
-                           << "' Content-Length";
+                        ReportWarning(out.report,
+                            pd,
+                            EmptyDefinitionWarning,
+                            node->sourceMap,
+                            "empty %s %s, expected %s for '%s' Content-Length",
+                            request,
+                            body,
+                            body,
+                            contentLength);
                     } else if (!transferEncoding.empty()) {
-                        ss << ", expected " << SectionName(BodySectionType) << " for '" << transferEncoding
-                           << "' Transfer-Encoding";
+                        ReportWarning(out.report,
+                            pd,
+                            EmptyDefinitionWarning,
+                            node->sourceMap,
+                            "empty %s %s, expected %s for '%s' Transfer-Encoding",
+                            request,
+                            body,
+                            body,
+                            transferEncoding);
+                    } else {
+                        ReportWarning(
+                            out.report, pd, EmptyDefinitionWarning, node->sourceMap, "empty %s %s", request, body);
                     }
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
                 }
             }
         }
@@ -685,12 +706,13 @@ namespace snowcrash
                 && out.node.reference.meta.state != Reference::StatePending) {
 
                 // WARN: not empty body
-                std::stringstream ss;
-                ss << "the " << code << " response MUST NOT include a " << SectionName(BodySectionType);
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    EmptyDefinitionWarning,
+                    node->sourceMap,
+                    "the %s response MUST NOT include a %s",
+                    code,
+                    SectionName(BodySectionType));
             }
         }
 
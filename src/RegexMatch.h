@@ -29,6 +29,22 @@ namespace snowcrash
     // returns true if target string matches given expression, false otherwise
     bool RegexCapture(
         const std::string& target, const std::string& expression, CaptureGroups& captureGroups, size_t groupSize = 8);
+
+    // Statistics of the process-wide compiled regex cache
+    struct RegexCacheStatistics {
+        size_t hits;   // lookups served from the cache
+        size_t misses; // lookups that had to compile the expression
+        size_t size;   // number of compiled expressions in the cache
+
+        RegexCacheStatistics() : hits(0), misses(0), size(0) {}
+    };
+
+    // Returns current statistics of the compiled regex cache
+    // Expressions are compiled once per process and shared across threads
+    RegexCacheStatistics GetRegexCacheStatistics();
+
+    // Releases all compiled expressions and resets the statistics
+    void ClearRegexCache();
 }
 
 #endif
@@ -47,13 +47,12 @@ namespace snowcrash
                 TrimString(out.node.str);
             } else {
                 // WARN: Relation identifier contains illegal characters
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(
-                    Warning("relation identifier contains illegal characters (only lower case letters, numbers, '-' "
-                            "and '.' allowed)",
-                        FormattingWarning,
-                        sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    FormattingWarning,
+                    node->sourceMap,
+                    "relation identifier contains illegal characters (only lower case letters, numbers, '-' "
+                    "and '.' allowed)");
             }
 
             if (pd.exportSourceMap() && !out.node.str.empty()) {
@@ -66,18 +66,23 @@ namespace snowcrash
             const ParseResultRef<ResourceGroup>& out)
         {
 
+            // Descriptions are not checked
+            if (pd.validateOnly()) {
+                return ++MarkdownNodeIterator(node);
+            }
+
             // Check for a description child element
             if (out.node.content.elements().empty()
                 || (!out.node.content.elements().empty()
                        && out.node.content.elements().back().element != Element::CopyElement)) {
 
                 Element description(Element::CopyElement);
-                out.node.content.elements().push_back(description);
+                out.node.content.elements().push_back(std::move(description));
 
                 if (pd.exportSourceMap()) {
 
                     SourceMap<Element> descriptionSM(Element::CopyElement);
-                    out.sourceMap.content.elements().collection.push_back(descriptionSM);
+                    out.sourceMap.content.elements().collection.push_back(std::move(descriptionSM));
                 }
             }
 
@@ -85,7 +90,7 @@ namespace snowcrash
                 TwoNewLines(out.node.content.elements().back().content.copy);
             }
 
-            mdp::ByteBuffer content = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+            mdp::ByteBuffer content = MapSourceData(node->sourceMap, pd);
             TrimString(content);
 
             if (pd.exportSourceMap() && !content.empty()) {
@@ -110,36 +115,31 @@ namespace snowcrash
                 IntermediateParseResult<Resource> resource(out.report);
                 cur = ResourceParser::parse(node, siblings, pd, resource);
 
-                bool duplicate = SectionProcessor<Resource>::isResourceDuplicate(
-                    out.node.content.elements(), resource.node.uriTemplate);
-                bool globalDuplicate;
-
-                if (!duplicate) {
-                    globalDuplicate = isResourceDuplicate(pd.blueprint, resource.node.uriTemplate);
-                }
-
-                if (duplicate || globalDuplicate) {
+                // Resources of this group are indexed as well
+                if (pd.blueprintIndex.isResourceDuplicate(resource.node.uriTemplate)) {
 
                     // WARN: Duplicate resource
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(
-                        Warning("the resource '" + resource.node.uriTemplate + "' is already defined",
-                            DuplicateWarning,
-                            sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        DuplicateWarning,
+                        node->sourceMap,
+                        "the resource '%s' is already defined",
+                        resource.node.uriTemplate);
                 }
 
+                pd.blueprintIndex.addResource(resource.node.uriTemplate);
+
                 Element resourceElement(Element::ResourceElement);
-                resourceElement.content.resource = resource.node;
+                resourceElement.content.resource = std::move(resource.node);
 
-                out.node.content.elements().push_back(resourceElement);
+                out.node.content.elements().push_back(std::move(resourceElement));
 
                 if (pd.exportSourceMap()) {
 
                     SourceMap<Element> resourceElementSM(Element::ResourceElement);
-                    resourceElementSM.content.resource = resource.sourceMap;
+                    resourceElementSM.content.resource = std::move(resource.sourceMap);
 
-                    out.sourceMap.content.elements().collection.push_back(resourceElementSM);
+                    out.sourceMap.content.elements().collection.push_back(std::move(resourceElementSM));
                 }
             }
 
@@ -159,16 +159,16 @@ namespace snowcrash
                 mdp::ByteBuffer method, name, uriTemplate;
 
                 SectionProcessor<Action>::actionHTTPMethodAndName(node, method, name, uriTemplate);
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
 
                 // WARN: Unexpected action
-                std::stringstream ss;
-                ss << "unexpected action '" << method << "', to define multiple actions for the '"
-                   << lastResource(out.node.content.elements()).uriTemplate;
-                ss << "' resource omit the HTTP method in its definition, e.g. '# /resource'";
-
-                out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    IgnoringWarning,
+                    node->sourceMap,
+                    "unexpected action '%s', to define multiple actions for the '%s' resource omit the HTTP method in "
+                    "its definition, e.g. '# /resource'",
+                    method,
+                    lastResource(out.node.content.elements()).uriTemplate);
 
                 return ++MarkdownNodeIterator(node);
             }
@@ -209,8 +209,10 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
+            KeywordCandidates candidates = SectionKeywordCandidates(node);
+
             // Return ResourceSectionType or UndefinedSectionType
-            return SectionProcessor<Resource>::sectionType(node);
+            return CandidateSectionType<Resource>(node, candidates, ResourceKeywordCandidate);
         }
 
         static SectionTypes upperSectionTypes()
@@ -240,29 +242,6 @@ namespace snowcrash
             return SectionProcessorBase<ResourceGroup>::isUnexpectedNode(node, sectionType);
         }
 
-        /**
-         * \brief Given a blueprint, Check if a resource already exists with the given uri template
-         *
-         * \param blueprint The blueprint which is formed until now
-         * \param uri The resource uri template to be checked
-         */
-        static bool isResourceDuplicate(const Blueprint& blueprint, const URITemplate& uri)
-        {
-
-            for (Elements::const_iterator it = blueprint.content.elements().begin();
-                 it != blueprint.content.elements().end();
-                 ++it) {
-
-                if (it->element == Element::CategoryElement
-                    && SectionProcessor<Resource>::isResourceDuplicate(it->content.elements(), uri)) {
-
-                    return true;
-                }
-            }
-
-            return false;
-        }
-
         /**
          * \brief Given list of elements, return true if none of them is a resource element
          *
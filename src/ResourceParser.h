@@ -117,15 +117,15 @@ namespace snowcrash
 
                     if (!out.node.name.empty()) {
 
-                        if (SectionProcessor<DataStructureGroup>::isNamedTypeDuplicate(pd.blueprint, out.node.name)) {
+                        if (pd.blueprintIndex.isNamedTypeDuplicate(out.node.name)) {
 
                             // WARN: duplicate named type
-                            std::stringstream ss;
-                            ss << "named type with name '" << out.node.name << "' already exists";
-
-                            mdp::CharactersRangeSet sourceMap
-                                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                            out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                            ReportWarning(out.report,
+                                pd,
+                                DuplicateWarning,
+                                node->sourceMap,
+                                "named type with name '%s' already exists",
+                                out.node.name);
 
                             // Remove the attributes data from the AST since we are ignoring this
                             out.node.attributes = mson::NamedType();
@@ -218,22 +218,29 @@ namespace snowcrash
 
             SectionType nestedType = UndefinedSectionType;
 
+            // Only confirm the keyword sections the node might match
+            KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+            if (candidates == NoKeywordCandidate) {
+                return UndefinedSectionType;
+            }
+
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = CandidateSectionType<Parameters>(node, candidates, ParametersKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = CandidateSectionType<Headers>(node, candidates, HeadersKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if model section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = CandidateSectionType<Payload>(node, candidates, PayloadKeywordCandidate);
 
             if (nestedType == ModelSectionType || nestedType == ModelBodySectionType) {
 
@@ -241,14 +248,14 @@ namespace snowcrash
             }
 
             // Check if attributes section
-            nestedType = SectionProcessor<Attributes>::sectionType(node);
+            nestedType = CandidateSectionType<Attributes>(node, candidates, AttributesKeywordCandidate);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if action section
-            nestedType = SectionProcessor<Action>::sectionType(node);
+            nestedType = CandidateSectionType<Action>(node, candidates, ActionKeywordCandidate);
 
             if (nestedType == ActionSectionType) {
 
@@ -272,17 +279,18 @@ namespace snowcrash
             const MarkdownNodeIterator& node, SectionParserData& pd, const ParseResultRef<Resource>& out)
         {
 
-            if (!out.node.uriTemplate.empty()) {
+            // The URI template is parsed for the warnings only
+            if (!out.node.uriTemplate.empty() && !pd.isWarningSuppressed(URIWarning)) {
 
-                URITemplateParser uriTemplateParser;
                 ParsedURITemplate parsedResult;
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                URITemplateWarnings warnings;
+
+                URITemplateParser::parse(out.node.uriTemplate, parsedResult, warnings);
 
-                uriTemplateParser.parse(out.node.uriTemplate, sourceMap, parsedResult);
+                for (URITemplateWarnings::const_iterator it = warnings.begin(); it != warnings.end(); ++it) {
 
-                if (!parsedResult.report.warnings.empty()) {
-                    out.report += parsedResult.report;
+                    // WARN: URI template
+                    ReportWarning(out.report, pd, URIWarning, node->sourceMap, it->format, it->expression);
                 }
             }
 
@@ -338,11 +346,11 @@ namespace snowcrash
             IntermediateParseResult<Action> action(out.report);
             MarkdownNodeIterator cur = ActionParser::parse(node, siblings, pd, action);
 
-            out.node.actions.push_back(action.node);
+            out.node.actions.push_back(std::move(action.node));
             layout = RedirectSectionLayout;
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.actions.collection.push_back(action.sourceMap);
+                out.sourceMap.actions.collection.push_back(std::move(action.sourceMap));
                 out.sourceMap.uriTemplate.sourceMap = node->sourceMap;
             }
 
@@ -364,13 +372,13 @@ namespace snowcrash
             if (duplicate != out.node.actions.end()) {
 
                 // WARN: duplicate method
-                std::stringstream ss;
-                ss << "action with method '" << action.node.method << "' already defined for resource '";
-                ss << out.node.uriTemplate << "'";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    DuplicateWarning,
+                    node->sourceMap,
+                    "action with method '%s' already defined for resource '%s'",
+                    action.node.method,
+                    out.node.uriTemplate);
             }
 
             ActionIterator relationDuplicate
@@ -379,23 +387,23 @@ namespace snowcrash
             if (relationDuplicate != out.node.actions.end()) {
 
                 // WARN: duplicate relation identifier
-                std::stringstream ss;
-                ss << "relation identifier '" << action.node.relation.str << "' already defined for resource '"
-                   << out.node.uriTemplate << "'";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
+                ReportWarning(out.report,
+                    pd,
+                    DuplicateWarning,
+                    node->sourceMap,
+                    "relation identifier '%s' already defined for resource '%s'",
+                    action.node.relation.str,
+                    out.node.uriTemplate);
             }
 
             if (!action.node.parameters.empty() && action.node.uriTemplate.empty()) {
                 checkParametersEligibility<Resource>(node, pd, action.node.parameters, out);
             }
 
-            out.node.actions.push_back(action.node);
+            out.node.actions.push_back(std::move(action.node));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.actions.collection.push_back(action.sourceMap);
+                out.sourceMap.actions.collection.push_back(std::move(action.sourceMap));
             }
 
             return cur;
@@ -442,20 +450,24 @@ namespace snowcrash
             if (!out.node.model.name.empty()) {
 
                 // WARN: Model already defined
-                std::stringstream ss;
-                ss << "overshadowing previous model definition for '";
-
                 if (!out.node.name.empty()) {
-                    ss << out.node.name << "(" << out.node.uriTemplate << ")";
+                    ReportWarning(out.report,
+                        pd,
+                        DuplicateWarning,
+                        node->sourceMap,
+                        "overshadowing previous model definition for '%s(%s)' resource, a resource can be represented "
+                        "by a single model only",
+                        out.node.name,
+                        out.node.uriTemplate);
                 } else {
-                    ss << out.node.uriTemplate;
+                    ReportWarning(out.report,
+                        pd,
+                        DuplicateWarning,
+                        node->sourceMap,
+                        "overshadowing previous model definition for '%s' resource, a resource can be represented by "
+                        "a single model only",
+                        out.node.uriTemplate);
                 }
-
-                ss << "' resource, a resource can be represented by a single model only";
-
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
             }
 
             if (model.node.name.empty()) {
@@ -507,26 +519,6 @@ namespace snowcrash
 
             return cur;
         }
-
-        /**
-         * \brief Given a list of elements, Check if a resource already exists with the given uri template
-         *
-         * \param elements Collection of elements
-         * \param uri The resource uri template to be checked
-         */
-        static bool isResourceDuplicate(const Elements& elements, const URITemplate& uri)
-        {
-
-            for (Elements::const_iterator it = elements.begin(); it != elements.end(); ++it) {
-
-                if (it->element == Element::ResourceElement && it->content.resource.uriTemplate == uri) {
-
-                    return true;
-                }
-            }
-
-            return false;
-        }
     };
 
     /** Resource Section Parser */
@@ -11,6 +11,7 @@
 
 #include <stdexcept>
 #include "SignatureSectionProcessor.h"
+#include "Instrumentation.h"
 
 namespace snowcrash
 {
@@ -34,6 +35,9 @@ namespace snowcrash
             SectionParserData& pd,
             const ParseResultRef<T>& out)
         {
+            SNOWCRASH_INSTRUMENT_STAGE(SectionParserStageName(typeid(T)));
+
+            pd.chargeMemory(sizeof(T) + (pd.exportSourceMap() ? sizeof(SourceMap<T>) : 0));
 
             SectionLayout layout = DefaultSectionLayout;
             MarkdownNodeIterator cur = Adapter::startingNode(node, pd);
@@ -99,15 +103,37 @@ namespace snowcrash
             const ParseResultRef<T>& out)
         {
 
+            MarkdownNodeIterator cur = node;
+
+            SectionProcessor<T>::preprocessNestedSections(node, collection, pd, out);
+
+            if (SectionProcessor<T>::parseNestedSectionsInParallel(node, collection, pd, out, cur))
+                return cur;
+
+            return parseNestedSectionRange(node, collection.end(), collection, pd, out);
+        }
+
+        /**
+         *  \brief  Parse nested sections starting before the \a last node
+         *  \return Iterator to the first unparsed block, can be past \a last
+         *          if a section started before \a last spans over it
+         */
+        static MarkdownNodeIterator parseNestedSectionRange(const MarkdownNodeIterator& node,
+            const MarkdownNodes::const_iterator& last,
+            const MarkdownNodes& collection,
+            SectionParserData& pd,
+            const ParseResultRef<T>& out)
+        {
+
             MarkdownNodeIterator cur = node;
             MarkdownNodeIterator lastCur = cur;
 
             SectionType lastSectionType = UndefinedSectionType;
 
-            SectionProcessor<T>::preprocessNestedSections(node, collection, pd, out);
-
             // Nested sections
-            while (cur != collection.end()) {
+            while (cur != collection.end() && cur < last) {
+
+                CheckParseLimits(pd.limits);
 
                 lastCur = cur;
                 SectionType nestedType = SectionProcessor<T>::nestedSectionType(cur);
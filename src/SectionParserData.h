@@ -10,8 +10,14 @@
 #define SNOWCRASH_SECTIONPARSERDATA_H
 
 #include "ModelTable.h"
+#include "BlueprintIndex.h"
+#include "BlueprintSegmentCache.h"
 #include "BlueprintSourcemap.h"
+#include "BlueprintVisitor.h"
+#include "Instrumentation.h"
+#include "ParseLimits.h"
 #include "Section.h"
+#include "StringUtility.h"
 
 namespace snowcrash
 {
@@ -25,7 +31,10 @@ namespace snowcrash
     {
         RenderDescriptionsOption = (1 << 0),   /// < Render Markdown in description.
         RequireBlueprintNameOption = (1 << 1), /// < Treat missing blueprint name as error
-        ExportSourcemapOption = (1 << 2)       /// < Export source maps AST
+        ExportSourcemapOption = (1 << 2),      /// < Export source maps AST
+        ParallelParsingOption = (1 << 3),      /// < Parse top-level groups on multiple threads
+        ValidateOnlyOption = (1 << 4),         /// < Only report errors and warnings, the AST is incomplete
+        DeferWarningsOption = (1 << 5)         /// < Keep the warnings unformatted, see `FormatWarnings()`
     };
 
     typedef unsigned int BlueprintParserOptions;
@@ -36,25 +45,74 @@ namespace snowcrash
      *  State of the parser.
      */
     struct SectionParserData {
-        SectionParserData(BlueprintParserOptions opts, const mdp::ByteBuffer& src, const Blueprint& bp)
-            : options(opts), sourceData(src), blueprint(bp)
+        SectionParserData(BlueprintParserOptions opts, const StringView& src, const Blueprint& bp)
+            : options(opts)
+            , namedTypeBaseTable(m_namedTypeBaseTable)
+            , namedTypeInheritanceTable(m_namedTypeInheritanceTable)
+            , sourceData(src)
+            , sourceCharacterIndex(m_sourceCharacterIndex)
+            , blueprint(bp)
+            , blueprintIndex(bp)
+            , segmentCache(NULL)
+            , memory(NULL)
+            , visitor(NULL)
+            , deferWarnings(false)
+            , addedDependencies(NULL)
+            , m_sharedNamedTypeDependencyGraph(NULL)
         {
         }
 
+        /**
+         *  \brief Parser data of a worker parsing a part of the blueprint
+         *
+         *  Shares the named type tables and the character index of \a parent,
+         *  which are only read while parsing, \a parent has to have the index
+         *  built and has to outlive the worker. The named type dependency
+         *  graph is shared until the worker modifies it, see
+         *  `modifiableNamedTypeDependencyGraph()`. The model tables and the
+         *  sections context are copied. The segment cache, the blueprint
+         *  index, the visitor and the added dependencies are not shared.
+         */
+        SectionParserData(const SectionParserData& parent, const Blueprint& bp)
+            : options(parent.options)
+            , namedTypeBaseTable(parent.namedTypeBaseTable)
+            , namedTypeInheritanceTable(parent.namedTypeInheritanceTable)
+            , namedTypeContext(parent.namedTypeContext)
+            , modelTable(parent.modelTable)
+            , modelSourceMapTable(parent.modelSourceMapTable)
+            , sourceData(parent.sourceData)
+            , sourceCharacterIndex(parent.sourceCharacterIndex)
+            , blueprint(bp)
+            , blueprintIndex(bp)
+            , sectionsContext(parent.sectionsContext)
+            , segmentCache(NULL)
+            , limits(parent.limits)
+            , memory(parent.memory)
+            , visitor(NULL)
+            , deferWarnings(parent.deferWarnings)
+            , addedDependencies(NULL)
+            , m_sharedNamedTypeDependencyGraph(&parent.namedTypeDependencyGraph())
+        {
+        }
+
+    private:
+        /** Named type tables and character index, unless shared with a parent */
+        mson::NamedTypeBaseTable m_namedTypeBaseTable;
+        mson::NamedTypeInheritanceTable m_namedTypeInheritanceTable;
+        mdp::ByteBufferCharacterIndex m_sourceCharacterIndex;
+
+    public:
         /** Parser Options */
         BlueprintParserOptions options;
 
         /** Named Types */
         std::vector<mson::NamedType> msonTypesTable;
 
-        /** Table of named types and resolved base types */
-        mson::NamedTypeBaseTable namedTypeBaseTable;
+        /** Table of named types and resolved base types, shared with the workers */
+        mson::NamedTypeBaseTable& namedTypeBaseTable;
 
-        /** Table mapping named type to sub types */
-        mson::NamedTypeInheritanceTable namedTypeInheritanceTable;
-
-        /** Table mapping named types to their dependent named types */
-        mson::NamedTypeDependencyTable namedTypeDependencyTable;
+        /** Table mapping named type to sub types, shared with the workers */
+        mson::NamedTypeInheritanceTable& namedTypeInheritanceTable;
 
         /** Variable to store the current named type */
         mson::Literal namedTypeContext;
@@ -65,19 +123,40 @@ namespace snowcrash
         /** Model Table Sourcemap */
         ModelSourceMapTable modelSourceMapTable;
 
-        /** Source Data */
-        const mdp::ByteBuffer& sourceData;
+        /** Source Data, not owned and not necessarily NUL terminated */
+        const StringView sourceData;
 
-        /** Source - map of bytes to character position - performance optimization */
-        mdp::ByteBufferCharacterIndex sourceCharacterIndex;
+        /** Source - map of bytes to character position - performance optimization, shared with the workers */
+        mdp::ByteBufferCharacterIndex& sourceCharacterIndex;
 
         /** AST being parsed **/
         const Blueprint& blueprint;
 
+        /** Index of the names defined by the AST being parsed */
+        BlueprintIndex blueprintIndex;
+
         /** Sections Context */
         typedef std::vector<SectionType> SectionsStack;
         SectionsStack sectionsContext;
 
+        /** Segments of a previous parse to be reused, NULL if none */
+        BlueprintSegmentCache* segmentCache;
+
+        /** Limits of the parse, shared with the workers */
+        ParseLimits limits;
+
+        /** Memory used by the parse, shared with the workers, NULL if not accounted */
+        ParseMemory* memory;
+
+        /** Visitor of the parsed groups, NULL if the whole AST is kept */
+        BlueprintVisitor* visitor;
+
+        /** True if warnings are reported unformatted, to be formatted once the parse is done */
+        bool deferWarnings;
+
+        /** Dependencies added to the named type dependency graph while parsing, recorded unless NULL */
+        mson::NamedTypeDependencies* addedDependencies;
+
         /** \returns Actual Section Context */
         SectionType sectionContext() const
         {
@@ -98,17 +177,76 @@ namespace snowcrash
                 return sectionsContext[size - 2];
         }
 
-        /** \returns True if exporting source maps */
+        /** \returns True if exporting source maps, source maps are never exported when only validating */
         bool exportSourceMap() const
         {
-            return options & ExportSourcemapOption;
+            return (options & ExportSourcemapOption) && !(options & ValidateOnlyOption);
+        }
+
+        /** \returns True if only the report is parsed, parts of the AST not checked are skipped */
+        bool validateOnly() const
+        {
+            return (options & ValidateOnlyOption) != 0;
+        }
+
+        /** \returns True if warnings of the code are not to be reported */
+        bool isWarningSuppressed(WarningCode code) const
+        {
+            return (limits.suppressedWarnings & WarningCodeMask(code)) != 0;
+        }
+
+        /** Account allocated bytes if the memory is accounted */
+        void chargeMemory(size_t bytes) const
+        {
+            if (memory)
+                memory->charge(bytes);
+        }
+
+        /** \returns Table mapping named types to their dependent named types */
+        const mson::NamedTypeDependencyGraph& namedTypeDependencyGraph() const
+        {
+            return m_sharedNamedTypeDependencyGraph ? *m_sharedNamedTypeDependencyGraph : m_namedTypeDependencyGraph;
+        }
+
+        /** \returns Table mapping named types to their dependent named types to be modified, copied if shared */
+        mson::NamedTypeDependencyGraph& modifiableNamedTypeDependencyGraph()
+        {
+            if (m_sharedNamedTypeDependencyGraph) {
+                m_namedTypeDependencyGraph = *m_sharedNamedTypeDependencyGraph;
+                m_sharedNamedTypeDependencyGraph = NULL;
+                chargeMemory(m_namedTypeDependencyGraph.allocatedMemory());
+            }
+
+            return m_namedTypeDependencyGraph;
+        }
+
+        /** \returns True if the table mapping named types to their dependent named types is shared with a parent */
+        bool isNamedTypeDependencyGraphShared() const
+        {
+            return m_sharedNamedTypeDependencyGraph != NULL;
         }
 
     private:
+        /** Table mapping named types to their dependent named types, unless shared */
+        mson::NamedTypeDependencyGraph m_namedTypeDependencyGraph;
+
+        /** Table of the parent until modified, NULL if not shared */
+        const mson::NamedTypeDependencyGraph* m_sharedNamedTypeDependencyGraph;
+
         SectionParserData();
         SectionParserData(const SectionParserData&);
         SectionParserData& operator=(const SectionParserData&);
     };
+
+    /** \return Source data of the ranges, copied */
+    inline mdp::ByteBuffer MapSourceData(const mdp::BytesRangeSet& rangeSet, const SectionParserData& pd)
+    {
+        mdp::ByteBuffer data = mdp::MapBytesRangeSet(rangeSet, pd.sourceData.data(), pd.sourceData.length());
+        SNOWCRASH_INSTRUMENT_COUNT(BytesCopiedCounter, data.size());
+        pd.chargeMemory(data.size());
+
+        return data;
+    }
 }
 
 #endif
@@ -12,6 +12,7 @@
 #include "SectionParserData.h"
 #include "SourceAnnotation.h"
 #include "Signature.h"
+#include "WarningUtility.h"
 
 // Use the following macro whenever a section doesn't have description
 #define NO_SECTION_DESCRIPTION(T)                                                                                      \
@@ -157,11 +158,24 @@ namespace snowcrash
             const ParseResultRef<T>& out)
         {
 
+            // Descriptions are not checked
+            if (pd.validateOnly()) {
+                return ++MarkdownNodeIterator(node);
+            }
+
+            return appendDescription(node, pd, out);
+        }
+
+        /** Append section description Markdown node to the description */
+        static MarkdownNodeIterator appendDescription(
+            const MarkdownNodeIterator& node, SectionParserData& pd, const ParseResultRef<T>& out)
+        {
+
             if (!out.node.description.empty()) {
                 TwoNewLines(out.node.description);
             }
 
-            mdp::ByteBuffer content = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+            mdp::ByteBuffer content = MapSourceData(node->sourceMap, pd);
 
             if (pd.exportSourceMap() && !content.empty()) {
                 out.sourceMap.description.sourceMap.append(node->sourceMap);
@@ -194,6 +208,27 @@ namespace snowcrash
         {
         }
 
+        /**
+         *  \brief Parse all the nested sections in parallel
+         *  \param node     First nested section node
+         *  \param siblings Siblings of the node being processed
+         *  \param pd       Section parser state
+         *  \param out      Processed output
+         *  \param cur      Iterator to the first unparsed block on success
+         *  \return True if parsed, false to parse the nested sections sequentially
+         *
+         *  Only used by BlueprintParser for now
+         */
+        static bool parseNestedSectionsInParallel(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<T>& out,
+            MarkdownNodeIterator& cur)
+        {
+
+            return false;
+        }
+
         /**
          *  \brief Process nested sections Markdown node(s)
          *  \param node     Node to process
@@ -220,19 +255,17 @@ namespace snowcrash
         {
 
             // WARN: Ignoring unexpected node
-            std::stringstream ss;
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-
             if (node->type == mdp::HeaderMarkdownNodeType) {
-                ss << "unexpected header block, expected a group, resource or an action definition";
-                ss << ", e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>'";
+                ReportWarning(out.report,
+                    pd,
+                    IgnoringWarning,
+                    node->sourceMap,
+                    "unexpected header block, expected a group, resource or an action definition"
+                    ", e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>'");
             } else {
-                ss << "ignoring unrecognized block";
+                ReportWarning(out.report, pd, IgnoringWarning, node->sourceMap, "ignoring unrecognized block");
             }
 
-            out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
-
             return ++MarkdownNodeIterator(node);
         }
 
@@ -312,6 +345,23 @@ namespace snowcrash
     template <typename T>
     struct SectionProcessor : public SectionProcessorBase<T> {
     };
+
+    /**
+     *  \brief  Recognize a keyword section if it is among the candidates
+     *  \param  node        Node to recognize
+     *  \param  candidates  Candidates of the node, see `SectionKeywordCandidates()`
+     *  \param  candidate   Candidate flag of the section
+     *  \return %SectionType of the node or UndefinedSectionType
+     */
+    template <typename T>
+    inline SectionType CandidateSectionType(
+        const MarkdownNodeIterator& node, KeywordCandidates candidates, KeywordCandidate candidate)
+    {
+        if (!(candidates & candidate))
+            return UndefinedSectionType;
+
+        return SectionProcessor<T>::sectionType(node);
+    }
 }
 
 #endif
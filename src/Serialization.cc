@@ -0,0 +1,575 @@
+//
+//  Serialization.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdint>
+#include "Serialization.h"
+
+using namespace snowcrash;
+
+namespace
+{
+    /** Thrown when reading truncated or corrupt data */
+    struct CorruptDataError {
+    };
+
+    /** Archive appending values to a buffer */
+    class BinaryWriter
+    {
+    public:
+        static const bool IsReading = false;
+
+        explicit BinaryWriter(mdp::ByteBuffer& data) : m_data(data) {}
+
+        template <typename N>
+        void number(N& value)
+        {
+            uint64_t bits = static_cast<uint64_t>(value);
+
+            while (bits >= 0x80) {
+                m_data.push_back(static_cast<char>((bits & 0x7F) | 0x80));
+                bits >>= 7;
+            }
+
+            m_data.push_back(static_cast<char>(bits));
+        }
+
+        void string(std::string& value)
+        {
+            size_t size = value.size();
+            number(size);
+            m_data.append(value);
+        }
+
+        /** Write the size of a collection, \return The size */
+        size_t count(size_t size)
+        {
+            number(size);
+            return size;
+        }
+
+    private:
+        mdp::ByteBuffer& m_data;
+    };
+
+    /** Archive reading values written by `BinaryWriter` */
+    class BinaryReader
+    {
+    public:
+        static const bool IsReading = true;
+
+        explicit BinaryReader(const mdp::ByteBuffer& data) : m_position(data.data()), m_end(data.data() + data.size())
+        {
+        }
+
+        template <typename N>
+        void number(N& value)
+        {
+            value = static_cast<N>(read());
+        }
+
+        void string(std::string& value)
+        {
+            size_t size = count(0);
+            value.assign(m_position, size);
+            m_position += size;
+        }
+
+        /** Read the size of a collection, \return The size */
+        size_t count(size_t)
+        {
+            uint64_t size = read();
+
+            // Every item takes a byte at least
+            if (size > static_cast<uint64_t>(m_end - m_position))
+                throw CorruptDataError();
+
+            return static_cast<size_t>(size);
+        }
+
+        /** \return True if all the data are read */
+        bool atEnd() const
+        {
+            return m_position == m_end;
+        }
+
+    private:
+        const char* m_position;
+        const char* const m_end;
+
+        uint64_t read()
+        {
+            uint64_t value = 0;
+
+            for (unsigned int shift = 0;; shift += 7) {
+
+                if (m_position == m_end || shift > 63)
+                    throw CorruptDataError();
+
+                unsigned char byte = static_cast<unsigned char>(*m_position++);
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+                if (!(byte & 0x80))
+                    return value;
+            }
+        }
+    };
+
+    /**
+     *  \brief  Serialization of a parse result with an archive
+     *
+     *  The same code writes and reads the data, an archive either writes
+     *  the values to a buffer or reads them from it into the structures.
+     */
+    template <typename Archive>
+    class ParseResultSerializer
+    {
+    public:
+        explicit ParseResultSerializer(Archive& archive) : m_archive(archive) {}
+
+        void serialize(std::string& value)
+        {
+            m_archive.string(value);
+        }
+
+        template <typename T>
+        void serialize(std::vector<T>& values)
+        {
+            size_t size = m_archive.count(values.size());
+
+            if (Archive::IsReading)
+                values.resize(size);
+
+            for (typename std::vector<T>::iterator it = values.begin(); it != values.end(); ++it)
+                serialize(*it);
+        }
+
+        template <typename T1, typename T2>
+        void serialize(std::pair<T1, T2>& pair)
+        {
+            serialize(pair.first);
+            serialize(pair.second);
+        }
+
+        void serialize(mdp::Range& range)
+        {
+            m_archive.number(range.location);
+            m_archive.number(range.length);
+        }
+
+        void serialize(SourceAnnotation& annotation)
+        {
+            serialize(annotation.location);
+            m_archive.number(annotation.code);
+            serialize(annotation.message);
+        }
+
+        void serialize(Report& report)
+        {
+            serialize(report.error);
+            serialize(report.warnings);
+        }
+
+        /* MSON AST */
+
+        void serialize(mson::Value& value)
+        {
+            serialize(value.literal);
+            m_archive.number(value.variable);
+        }
+
+        void serialize(mson::Symbol& symbol)
+        {
+            serialize(symbol.literal);
+            m_archive.number(symbol.variable);
+        }
+
+        void serialize(mson::TypeName& typeName)
+        {
+            m_archive.number(typeName.base);
+            serialize(typeName.symbol);
+        }
+
+        void serialize(mson::TypeSpecification& typeSpecification)
+        {
+            serialize(typeSpecification.name);
+            serialize(typeSpecification.nestedTypes);
+        }
+
+        void serialize(mson::TypeDefinition& typeDefinition)
+        {
+            m_archive.number(typeDefinition.baseType);
+            serialize(typeDefinition.typeSpecification);
+            m_archive.number(typeDefinition.attributes);
+        }
+
+        void serialize(mson::ValueDefinition& valueDefinition)
+        {
+            serialize(valueDefinition.values);
+            serialize(valueDefinition.typeDefinition);
+        }
+
+        void serialize(mson::TypeSection& typeSection)
+        {
+            m_archive.number(typeSection.baseType);
+            m_archive.number(typeSection.klass);
+            serialize(typeSection.content.description);
+            serialize(typeSection.content.value);
+            serializeElements(typeSection.content);
+        }
+
+        void serialize(mson::NamedType& namedType)
+        {
+            serialize(namedType.name);
+            serialize(namedType.typeDefinition);
+            serialize(namedType.sections);
+        }
+
+        void serialize(mson::ValueMember& valueMember)
+        {
+            serialize(valueMember.description);
+            serialize(valueMember.valueDefinition);
+            serialize(valueMember.sections);
+        }
+
+        void serialize(mson::PropertyName& propertyName)
+        {
+            serialize(propertyName.literal);
+            serialize(propertyName.variable);
+        }
+
+        void serialize(mson::PropertyMember& propertyMember)
+        {
+            serialize(static_cast<mson::ValueMember&>(propertyMember));
+            serialize(propertyMember.name);
+        }
+
+        void serialize(mson::Element& element)
+        {
+            m_archive.number(element.klass);
+
+            // Only the content of the class is written
+            bool undefined = element.klass == mson::Element::UndefinedClass;
+
+            if (undefined || element.klass == mson::Element::PropertyClass)
+                serialize(element.content.property);
+
+            if (undefined || element.klass == mson::Element::ValueClass)
+                serialize(element.content.value);
+
+            if (undefined || element.klass == mson::Element::MixinClass)
+                serialize(element.content.mixin);
+
+            serializeElements(element.content);
+        }
+
+        /* Blueprint AST */
+
+        void serialize(Parameter& parameter)
+        {
+            serialize(parameter.name);
+            serialize(parameter.description);
+            serialize(parameter.type);
+            m_archive.number(parameter.use);
+            serialize(parameter.defaultValue);
+            serialize(parameter.exampleValue);
+            serialize(parameter.values);
+        }
+
+        void serialize(Reference& reference)
+        {
+            serialize(reference.id);
+
+            // The type is not initialized unless there is a reference
+            if (!reference.id.empty())
+                m_archive.number(reference.type);
+
+            m_archive.number(reference.meta.state);
+        }
+
+        void serialize(Payload& payload)
+        {
+            serialize(payload.name);
+            serialize(payload.description);
+            serialize(payload.parameters);
+            serialize(payload.headers);
+            serialize(payload.attributes);
+            serialize(payload.body);
+            serialize(payload.schema);
+            serialize(payload.reference);
+        }
+
+        void serialize(TransactionExample& example)
+        {
+            serialize(example.name);
+            serialize(example.description);
+            serialize(example.requests);
+            serialize(example.responses);
+        }
+
+        void serialize(Action& action)
+        {
+            serialize(action.method);
+            serialize(action.name);
+            serialize(action.description);
+            serialize(action.parameters);
+            serialize(action.attributes);
+            serialize(action.uriTemplate);
+            serialize(action.relation.str);
+            serialize(action.headers);
+            serialize(action.examples);
+        }
+
+        void serialize(Resource& resource)
+        {
+            serialize(resource.uriTemplate);
+            serialize(resource.name);
+            serialize(resource.description);
+            serialize(resource.model);
+            serialize(resource.attributes);
+            serialize(resource.parameters);
+            serialize(resource.headers);
+            serialize(resource.actions);
+        }
+
+        void serialize(Element& element)
+        {
+            m_archive.number(element.element);
+            serialize(element.attributes.name);
+            serialize(element.content.copy);
+
+            // Only the content of the class is written
+            bool undefined = element.element == Element::UndefinedElement;
+
+            if (undefined || element.element == Element::ResourceElement)
+                serialize(element.content.resource);
+
+            if (undefined || element.element == Element::DataStructureElement)
+                serialize(element.content.dataStructure);
+
+            serializeElements(element.content);
+
+            if (undefined || element.element == Element::CategoryElement)
+                m_archive.number(element.category);
+        }
+
+        void serialize(Blueprint& blueprint)
+        {
+            serialize(static_cast<Element&>(blueprint));
+            serialize(blueprint.metadata);
+            serialize(blueprint.name);
+            serialize(blueprint.description);
+        }
+
+        /* Source maps */
+
+        void serialize(SourceMapBase& sourceMap)
+        {
+            serialize(sourceMap.sourceMap);
+        }
+
+        template <typename T>
+        void serialize(SourceMap<std::vector<T> >& sourceMap)
+        {
+            serialize(sourceMap.collection);
+        }
+
+        void serialize(SourceMap<mson::TypeSection>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.description);
+            serialize(sourceMap.value);
+            serializeElements(sourceMap);
+        }
+
+        void serialize(SourceMap<mson::NamedType>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.name);
+            serialize(sourceMap.typeDefinition);
+            serialize(sourceMap.sections);
+        }
+
+        void serialize(SourceMap<mson::ValueMember>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.description);
+            serialize(sourceMap.valueDefinition);
+            serialize(sourceMap.sections);
+        }
+
+        void serialize(SourceMap<mson::PropertyMember>& sourceMap)
+        {
+            serialize(static_cast<SourceMap<mson::ValueMember>&>(sourceMap));
+            serialize(sourceMap.name);
+        }
+
+        void serialize(SourceMap<mson::Element>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.property);
+            serialize(sourceMap.value);
+            serialize(sourceMap.mixin);
+            serializeElements(sourceMap);
+        }
+
+        void serialize(SourceMap<Parameter>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.name);
+            serialize(sourceMap.description);
+            serialize(sourceMap.type);
+            serialize(sourceMap.use);
+            serialize(sourceMap.defaultValue);
+            serialize(sourceMap.exampleValue);
+            serialize(sourceMap.values);
+        }
+
+        void serialize(SourceMap<Payload>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.name);
+            serialize(sourceMap.description);
+            serialize(sourceMap.parameters);
+            serialize(sourceMap.headers);
+            serialize(sourceMap.attributes);
+            serialize(sourceMap.body);
+            serialize(sourceMap.schema);
+            serialize(sourceMap.reference);
+        }
+
+        void serialize(SourceMap<TransactionExample>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.name);
+            serialize(sourceMap.description);
+            serialize(sourceMap.requests);
+            serialize(sourceMap.responses);
+        }
+
+        void serialize(SourceMap<Action>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.method);
+            serialize(sourceMap.name);
+            serialize(sourceMap.description);
+            serialize(sourceMap.parameters);
+            serialize(sourceMap.attributes);
+            serialize(sourceMap.uriTemplate);
+            serialize(sourceMap.relation);
+            serialize(sourceMap.headers);
+            serialize(sourceMap.examples);
+        }
+
+        void serialize(SourceMap<Resource>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            serialize(sourceMap.uriTemplate);
+            serialize(sourceMap.name);
+            serialize(sourceMap.description);
+            serialize(sourceMap.model);
+            serialize(sourceMap.attributes);
+            serialize(sourceMap.parameters);
+            serialize(sourceMap.headers);
+            serialize(sourceMap.actions);
+        }
+
+        void serialize(SourceMap<Element>& sourceMap)
+        {
+            serialize(static_cast<SourceMapBase&>(sourceMap));
+            m_archive.number(sourceMap.element);
+            serialize(sourceMap.attributes.name);
+            serialize(sourceMap.content.copy);
+
+            bool undefined = sourceMap.element == Element::UndefinedElement;
+
+            if (undefined || sourceMap.element == Element::ResourceElement)
+                serialize(sourceMap.content.resource);
+
+            if (undefined || sourceMap.element == Element::DataStructureElement)
+                serialize(sourceMap.content.dataStructure);
+
+            serializeElements(sourceMap.content);
+
+            if (undefined || sourceMap.element == Element::CategoryElement)
+                m_archive.number(sourceMap.category);
+        }
+
+        void serialize(SourceMap<Blueprint>& sourceMap)
+        {
+            serialize(static_cast<SourceMap<Element>&>(sourceMap));
+            serialize(sourceMap.name);
+            serialize(sourceMap.metadata);
+            serialize(sourceMap.description);
+        }
+
+    private:
+        Archive& m_archive;
+
+        template <typename T>
+        static const std::vector<T>& items(const std::vector<T>& values)
+        {
+            return values;
+        }
+
+        template <typename T>
+        static const std::vector<SourceMap<T> >& items(const SourceMap<std::vector<T> >& sourceMap)
+        {
+            return sourceMap.collection;
+        }
+
+        /**
+         *  Serialize the elements of a content allocating them on the first
+         *  modification, they are only touched when there are some.
+         */
+        template <typename Content>
+        void serializeElements(Content& content)
+        {
+            bool hasElements = !items(static_cast<const Content&>(content).elements()).empty();
+            m_archive.number(hasElements);
+
+            if (hasElements)
+                serialize(content.elements());
+        }
+    };
+}
+
+void snowcrash::SerializeParseResult(const ParseResultRef<Blueprint>& result, mdp::ByteBuffer& data)
+{
+    BinaryWriter writer(data);
+    ParseResultSerializer<BinaryWriter> serializer(writer);
+
+    serializer.serialize(result.report);
+    serializer.serialize(result.node);
+    serializer.serialize(result.sourceMap);
+}
+
+bool snowcrash::DeserializeParseResult(const mdp::ByteBuffer& data, const ParseResultRef<Blueprint>& out)
+{
+    out.report = Report();
+    out.node = Blueprint();
+    out.sourceMap = SourceMap<Blueprint>();
+
+    BinaryReader reader(data);
+    ParseResultSerializer<BinaryReader> serializer(reader);
+
+    try {
+        serializer.serialize(out.report);
+        serializer.serialize(out.node);
+        serializer.serialize(out.sourceMap);
+
+        if (reader.atEnd())
+            return true;
+    } catch (const CorruptDataError&) {
+    }
+
+    out.report = Report();
+    out.node = Blueprint();
+    out.sourceMap = SourceMap<Blueprint>();
+
+    return false;
+}
@@ -0,0 +1,48 @@
+//
+//  Serialization.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SERIALIZATION_H
+#define SNOWCRASH_SERIALIZATION_H
+
+#include "BlueprintSourcemap.h"
+#include "SectionProcessor.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  Version of the binary serialization format, bump whenever the
+     *  serialized structures or their encoding change.
+     */
+    const unsigned int SerializationFormatVersion = 2;
+
+    /**
+     *  \brief  Serialize a parse result into a compact binary form
+     *
+     *  Numbers are written as variable-length integers and strings and
+     *  collections are prefixed with their length. The AST, its source map
+     *  and the report are written entirely, resolved references keep their
+     *  resolution state but not their Markdown node. Deferred warnings have
+     *  to be formatted first, see `FormatWarnings()`.
+     *
+     *  \param result   Parse result to serialize.
+     *  \param data     Buffer to append the serialized result to.
+     */
+    void SerializeParseResult(const ParseResultRef<Blueprint>& result, mdp::ByteBuffer& data);
+
+    /**
+     *  \brief  Deserialize a parse result written by `SerializeParseResult()`
+     *
+     *  \param data     Serialized parse result of the current format version.
+     *  \param out      Parse result to be filled in.
+     *  \return True on success, false if the data are truncated or corrupt.
+     */
+    bool DeserializeParseResult(const mdp::ByteBuffer& data, const ParseResultRef<Blueprint>& out);
+}
+
+#endif
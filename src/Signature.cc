@@ -20,8 +20,232 @@
 
 using namespace snowcrash;
 
-#define TYPECHECK(T)                                                                                                   \
-    if ((type = SectionProcessor<T>::sectionType(node)) != UndefinedSectionType) {                                     \
+namespace
+{
+    /** Sections whose signature is a list item */
+    const KeywordCandidates ListItemKeywordCandidates = TypeSectionKeywordCandidate | MixinKeywordCandidate
+        | OneOfKeywordCandidate | HeadersKeywordCandidate | AssetKeywordCandidate | AttributesKeywordCandidate
+        | PayloadKeywordCandidate | ValuesKeywordCandidate | ParametersKeywordCandidate | RelationKeywordCandidate;
+
+    /** Sections whose signature is a header */
+    const KeywordCandidates HeaderKeywordCandidates = TypeSectionKeywordCandidate | ResourceKeywordCandidate
+        | ActionKeywordCandidate | ResourceGroupKeywordCandidate | DataStructureGroupKeywordCandidate;
+
+    /** Maximum length of a keyword we need to compare */
+    const size_t MaxKeywordLength = 16;
+
+    /** A leading word of a signature, lower-cased */
+    struct Keyword {
+        char text[MaxKeywordLength];
+        size_t length;
+
+        /** \return True if the word is \a keyword */
+        bool is(const char* keyword) const
+        {
+            size_t i = 0;
+
+            for (; i < length && keyword[i] != '\0'; ++i) {
+                if (text[i] != keyword[i])
+                    return false;
+            }
+
+            return i == length && keyword[i] == '\0';
+        }
+
+        /** \return True if the word starts with \a keyword */
+        bool startsWith(const char* keyword) const
+        {
+            for (size_t i = 0; keyword[i] != '\0'; ++i) {
+                if (i >= length || text[i] != keyword[i])
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    /** \return True if \a c is an ASCII letter */
+    inline bool isKeywordCharacter(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    /** \return True if the word is one of the HTTP_REQUEST_METHOD alternatives */
+    bool isHTTPRequestMethod(const Keyword& word)
+    {
+        static const char* const methods[] = { "get", "post", "put", "delete", "options", "patch", "proppatch",
+            "lock", "unlock", "copy", "move", "mkcol", "head", "link", "unlink", "connect" };
+
+        for (size_t i = 0; i < sizeof(methods) / sizeof(methods[0]); ++i) {
+            if (word.is(methods[i]))
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     *  \brief  Classify the leading word of a signature
+     *
+     *  Keywords are compared case-insensitively, which is less strict than
+     *  the section regexes. A returned candidate therefore still has to be
+     *  confirmed by its section processor.
+     */
+    KeywordCandidates classifyKeyword(const Keyword& word)
+    {
+        if (word.length == 0)
+            return NoKeywordCandidate;
+
+        switch (word.text[0]) {
+            case 'a':
+                if (word.is("attribute") || word.is("attributes"))
+                    return AttributesKeywordCandidate;
+                break;
+
+            case 'b':
+                if (word.is("body"))
+                    return AssetKeywordCandidate;
+                break;
+
+            case 'd':
+                if (word.is("default"))
+                    return TypeSectionKeywordCandidate;
+                if (word.is("data"))
+                    return DataStructureGroupKeywordCandidate;
+                break;
+
+            case 'g':
+                if (word.is("group"))
+                    return ResourceGroupKeywordCandidate;
+                break;
+
+            case 'h':
+                if (word.is("header") || word.is("headers"))
+                    return HeadersKeywordCandidate;
+                break;
+
+            case 'i':
+                if (word.is("items"))
+                    return TypeSectionKeywordCandidate;
+                if (word.is("include"))
+                    return MixinKeywordCandidate;
+                break;
+
+            case 'm':
+                if (word.is("members"))
+                    return TypeSectionKeywordCandidate;
+                break;
+
+            case 'o':
+                if (word.is("one"))
+                    return OneOfKeywordCandidate;
+                break;
+
+            case 'p':
+                if (word.is("properties"))
+                    return TypeSectionKeywordCandidate;
+                if (word.is("parameter") || word.is("parameters"))
+                    return ParametersKeywordCandidate;
+                break;
+
+            case 'r':
+                // Request and response regexes are not anchored at the end
+                if (word.startsWith("request") || word.startsWith("response"))
+                    return PayloadKeywordCandidate;
+                if (word.is("relation"))
+                    return RelationKeywordCandidate;
+                break;
+
+            case 's':
+                if (word.is("sample"))
+                    return TypeSectionKeywordCandidate;
+                if (word.is("schema"))
+                    return AssetKeywordCandidate;
+                break;
+
+            case 'v':
+                if (word.is("values"))
+                    return ValuesKeywordCandidate;
+                break;
+
+            default:
+                break;
+        }
+
+        return NoKeywordCandidate;
+    }
+}
+
+/*
+ *  Scans the signature once, reading its leading word and noting the
+ *  characters which can introduce a signature with an arbitrary leading
+ *  word (named resources, actions and models).
+ */
+KeywordCandidates snowcrash::SectionKeywordCandidates(const mdp::MarkdownNodeIterator& node)
+{
+    KeywordCandidates mask = NoKeywordCandidate;
+    const mdp::ByteBuffer* subject = NULL;
+
+    if (node->type == mdp::HeaderMarkdownNodeType) {
+        mask = HeaderKeywordCandidates;
+        subject = &node->text;
+    } else if (node->type == mdp::ListItemMarkdownNodeType && !node->children().empty()) {
+        mask = ListItemKeywordCandidates;
+        subject = &node->children().front().text;
+    }
+
+    if (!subject || subject->empty())
+        return NoKeywordCandidate;
+
+    mdp::ByteBuffer::const_iterator it = subject->begin();
+    const mdp::ByteBuffer::const_iterator end = subject->end();
+
+    // Section processors trim the signature, including any leading new lines
+    while (it != end && snowcrash::isSpace(*it))
+        ++it;
+
+    if (it == end)
+        return NoKeywordCandidate;
+
+    const mdp::ByteBuffer::const_iterator begin = it;
+    const bool leadingSlash = (*it == '/');
+
+    Keyword word;
+    word.length = 0;
+
+    for (; it != end && isKeywordCharacter(*it); ++it) {
+        if (word.length < MaxKeywordLength)
+            word.text[word.length] = static_cast<char>(::tolower(*it));
+        ++word.length;
+    }
+
+    // A word longer than any keyword is recognized by its prefix only
+    if (word.length > MaxKeywordLength)
+        word.length = MaxKeywordLength;
+
+    KeywordCandidates candidates = classifyKeyword(word);
+
+    if (mask == HeaderKeywordCandidates) {
+
+        // Resource and action signatures, possibly named e.g. `Note [/notes]`
+        if (leadingSlash || isHTTPRequestMethod(word) || subject->find('[') != mdp::ByteBuffer::npos)
+            candidates |= ResourceKeywordCandidate | ActionKeywordCandidate;
+    } else {
+
+        // Named model signature e.g. `+ Note Model`, on the first line only
+        for (mdp::ByteBuffer::const_iterator line = begin; line != end && *line != '\n'; ++line) {
+            if (*line == 'o' && (end - line) >= 4 && line[1] == 'd' && line[2] == 'e' && line[3] == 'l') {
+                candidates |= PayloadKeywordCandidate;
+                break;
+            }
+        }
+    }
+
+    return candidates & mask;
+}
+
+#define TYPECHECK(T, C)                                                                                                \
+    if ((candidates & C) && (type = SectionProcessor<T>::sectionType(node)) != UndefinedSectionType) {                \
         return type;                                                                                                   \
     }
 
@@ -30,16 +254,22 @@ SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator&
     // Note: Every-keyword defined section should be listed here...
     SectionType type = UndefinedSectionType;
 
-    TYPECHECK(mson::TypeSection)
-    TYPECHECK(mson::Mixin)
-    TYPECHECK(mson::OneOf)
-    TYPECHECK(Headers)
-    TYPECHECK(Asset)
-    TYPECHECK(Attributes)
-    TYPECHECK(Payload)
-    TYPECHECK(Values)
-    TYPECHECK(Parameters)
-    TYPECHECK(Relation)
+    // Only run the section recognizers which can possibly match
+    KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+    if (candidates == NoKeywordCandidate)
+        return type;
+
+    TYPECHECK(mson::TypeSection, TypeSectionKeywordCandidate)
+    TYPECHECK(mson::Mixin, MixinKeywordCandidate)
+    TYPECHECK(mson::OneOf, OneOfKeywordCandidate)
+    TYPECHECK(Headers, HeadersKeywordCandidate)
+    TYPECHECK(Asset, AssetKeywordCandidate)
+    TYPECHECK(Attributes, AttributesKeywordCandidate)
+    TYPECHECK(Payload, PayloadKeywordCandidate)
+    TYPECHECK(Values, ValuesKeywordCandidate)
+    TYPECHECK(Parameters, ParametersKeywordCandidate)
+    TYPECHECK(Relation, RelationKeywordCandidate)
 
     /*
      *  NOTE: Order is important. Resource MUST preceed the Action.
@@ -47,10 +277,10 @@ SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator&
      *  This is because an HTTP Request Method + URI is recognized as both %ActionSectionType and %ResourceSectionType.
      *  This is not optimal and should be addressed in the future.
      */
-    TYPECHECK(Resource)
-    TYPECHECK(Action)
-    TYPECHECK(ResourceGroup)
-    TYPECHECK(DataStructureGroup)
+    TYPECHECK(Resource, ResourceKeywordCandidate)
+    TYPECHECK(Action, ActionKeywordCandidate)
+    TYPECHECK(ResourceGroup, ResourceGroupKeywordCandidate)
+    TYPECHECK(DataStructureGroup, DataStructureGroupKeywordCandidate)
 
     return type;
 }
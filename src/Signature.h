@@ -22,6 +22,39 @@ namespace snowcrash
      */
     extern SectionType SectionKeywordSignature(const mdp::MarkdownNodeIterator& node);
 
+    /**
+     *  \brief Keyword section candidates
+     *
+     *  One flag per section processor recognizing a keyword signature.
+     */
+    enum KeywordCandidate
+    {
+        NoKeywordCandidate = 0,
+        TypeSectionKeywordCandidate = 1 << 0,
+        MixinKeywordCandidate = 1 << 1,
+        OneOfKeywordCandidate = 1 << 2,
+        HeadersKeywordCandidate = 1 << 3,
+        AssetKeywordCandidate = 1 << 4,
+        AttributesKeywordCandidate = 1 << 5,
+        PayloadKeywordCandidate = 1 << 6,
+        ValuesKeywordCandidate = 1 << 7,
+        ParametersKeywordCandidate = 1 << 8,
+        RelationKeywordCandidate = 1 << 9,
+        ResourceKeywordCandidate = 1 << 10,
+        ActionKeywordCandidate = 1 << 11,
+        ResourceGroupKeywordCandidate = 1 << 12,
+        DataStructureGroupKeywordCandidate = 1 << 13
+    };
+
+    typedef unsigned int KeywordCandidates;
+
+    /**
+     *  \brief Find sections whose keyword signature might match a node
+     *  \param node     A Markdown AST node to check.
+     *  \return Superset of the sections whose SectionProcessor<T>::sectionType() recognizes the node
+     */
+    extern KeywordCandidates SectionKeywordCandidates(const mdp::MarkdownNodeIterator& node);
+
     /**
      *  \brief Recognize the type of section given the first line from a code block
      *  \param subject  The first line that needs to be recognized
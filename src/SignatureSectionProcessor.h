@@ -20,6 +20,12 @@ namespace scpl
 
     const char EscapeCharacter = '`';
 
+    /** \return True if the character escapes a part of an identifier, `*` and `_` are Markdown emphasis */
+    inline bool IsIdentifierEscapeCharacter(char c)
+    {
+        return c == '*' || c == '_' || c == EscapeCharacter;
+    }
+
     /**
      * \brief Signature Section Processor Base
      *
@@ -79,12 +85,13 @@ namespace scpl
         {
 
             Signature signature;
-            mdp::ByteBuffer subject = subjectOrig;
+            snowcrash::StringView subject = subjectOrig;
 
             if (subject.empty()) {
 
-                subject = snowcrash::GetFirstLine(node->text, signature.remainingContent);
-                snowcrash::TrimString(subject);
+                snowcrash::StringView remainingContent;
+                subject = snowcrash::TrimStringView(snowcrash::GetFirstLineView(node->text, remainingContent));
+                signature.remainingContent.assign(remainingContent.data(), remainingContent.length());
             }
 
             if (traits.identifierTrait && !subject.empty()) {
@@ -94,51 +101,43 @@ namespace scpl
                 if (signature.identifier.empty()) {
 
                     // WARN: Empty identifier
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    report.warnings.push_back(
-                        snowcrash::Warning("no identifier specified", snowcrash::EmptyDefinitionWarning, sourceMap));
+                    snowcrash::ReportWarning(
+                        report, pd, snowcrash::EmptyDefinitionWarning, node->sourceMap, "no identifier specified");
                 }
             }
 
             // Make sure values exist
             if (traits.valuesTrait && !subject.empty() && subject[0] != Delimiters::AttributesBeginDelimiter) {
 
-                // When subject starts with values, add a ':' for easier processing
-                if (!traits.identifierTrait) {
-                    subject = traits.delimiters.valuesDelimiter + subject;
-                }
+                // Without an identifier the subject starts with values
+                if (!traits.identifierTrait || subject[0] == traits.delimiters.valuesDelimiter) {
 
-                if (subject[0] == traits.delimiters.valuesDelimiter) {
+                    // Remove leading delimiter
+                    if (traits.identifierTrait) {
+                        subject = subject.substr(1);
+                    }
 
                     parseSignatureValues(traits, report, subject, signature);
 
                     if (signature.values.empty()) {
 
                         // WARN: Empty values
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                        report.warnings.push_back(
-                            snowcrash::Warning("no value(s) specified", snowcrash::EmptyDefinitionWarning, sourceMap));
+                        snowcrash::ReportWarning(
+                            report, pd, snowcrash::EmptyDefinitionWarning, node->sourceMap, "no value(s) specified");
                     }
                 }
             }
 
             if (traits.attributesTrait && !subject.empty()
-                && subject.substr(0, traits.delimiters.contentDelimiter.length())
-                    != traits.delimiters.contentDelimiter) {
+                && !subject.startsWith(traits.delimiters.contentDelimiter)) {
 
                 parseSignatureAttributes(report, subject, signature);
             }
 
-            if (traits.contentTrait && !subject.empty()
-                && subject.substr(0, traits.delimiters.contentDelimiter.length())
-                    == traits.delimiters.contentDelimiter) {
+            if (traits.contentTrait && !subject.empty() && subject.startsWith(traits.delimiters.contentDelimiter)) {
 
-                subject = subject.substr(traits.delimiters.contentDelimiter.length());
-                snowcrash::TrimString(subject);
-
-                signature.content = subject;
+                subject = snowcrash::TrimStringView(subject.substr(traits.delimiters.contentDelimiter.length()));
+                signature.content = subject.str();
             }
 
             return signature;
@@ -172,14 +171,13 @@ namespace scpl
          *                (which will be stripped of the parsed characters)
          * \param out Signature data structure
          */
-        static void parseSignatureIdentifier(
-            const SignatureTraits& traits, snowcrash::Report& report, mdp::ByteBuffer& subject, Signature& out)
+        static void parseSignatureIdentifier(const SignatureTraits& traits,
+            snowcrash::Report& report,
+            snowcrash::StringView& subject,
+            Signature& out)
         {
 
-            snowcrash::TrimString(subject);
-
-            // `*` and `_` are markdown characters for emphasis
-            std::string escapeCharacters = "*_`";
+            subject = snowcrash::TrimStringView(subject);
 
             size_t i = 0;
             mdp::ByteBuffer identifier;
@@ -187,13 +185,13 @@ namespace scpl
             // Traverse over the string
             while (i < subject.length()) {
 
-                if (escapeCharacters.find(subject[i]) != std::string::npos) {
+                if (IsIdentifierEscapeCharacter(subject[i])) {
 
                     // If escaped string, retrieve it and strip it from the subject
-                    mdp::ByteBuffer escapedString = snowcrash::RetrieveEscaped(subject, i);
+                    snowcrash::StringView escapedString = snowcrash::RetrieveEscapedView(subject, i);
 
                     if (!escapedString.empty()) {
-                        identifier += escapedString;
+                        identifier.append(escapedString.data(), escapedString.length());
                         i = 0;
                     } else {
                         identifier += subject[i];
@@ -201,9 +199,7 @@ namespace scpl
                     }
                 } else if ((traits.valuesTrait && subject[i] == traits.delimiters.valuesDelimiter)
                     || (traits.attributesTrait && subject[i] == Delimiters::AttributesBeginDelimiter)
-                    || (traits.contentTrait
-                           && subject.substr(i, traits.delimiters.contentDelimiter.length())
-                               == traits.delimiters.contentDelimiter)) {
+                    || (traits.contentTrait && subject.substr(i).startsWith(traits.delimiters.contentDelimiter))) {
 
                     // If identifier ends, strip it from the subject
                     subject = subject.substr(i);
@@ -220,15 +216,15 @@ namespace scpl
             snowcrash::TrimString(identifier);
 
             if (!identifier.empty()) {
-                out.identifier = identifier;
+                out.identifier.swap(identifier);
             }
 
             // If the subject ended with the identifier, strip it from the subject
             if (i == subject.length()) {
-                subject = "";
+                subject = subject.substr(i);
             }
 
-            snowcrash::TrimString(subject);
+            subject = snowcrash::TrimStringView(subject);
         };
 
         /**
@@ -236,22 +232,22 @@ namespace scpl
          *
          * \param traits Signature traits of the section signature
          * \param report Parse Report
-         * \param subject String that needs to be parsed
+         * \param subject String that needs to be parsed, following the values delimiter
          *                (which will be stripped of the parsed characters)
          * \param out Signature data structure
          */
-        static void parseSignatureValues(
-            const SignatureTraits& traits, snowcrash::Report& report, mdp::ByteBuffer& subject, Signature& out)
+        static void parseSignatureValues(const SignatureTraits& traits,
+            snowcrash::Report& report,
+            snowcrash::StringView& subject,
+            Signature& out)
         {
 
-            // Remove leading delimiter
-            subject = subject.substr(1);
-            snowcrash::TrimString(subject);
+            subject = snowcrash::TrimStringView(subject);
 
             size_t i = 0;
             mdp::ByteBuffer value;
 
-            out.value = subject;
+            snowcrash::StringView values = subject;
 
             // Traverse over the string
             while (i < subject.length()) {
@@ -259,10 +255,10 @@ namespace scpl
                 if (subject[i] == EscapeCharacter) {
 
                     // If escaped string, retrieve it and strip it from subject
-                    mdp::ByteBuffer escapedString = snowcrash::RetrieveEscaped(subject, i);
+                    snowcrash::StringView escapedString = snowcrash::RetrieveEscapedView(subject, i);
 
                     if (!escapedString.empty()) {
-                        value += escapedString;
+                        value.append(escapedString.data(), escapedString.length());
                         i = 0;
                     } else {
                         value += subject[i];
@@ -271,18 +267,15 @@ namespace scpl
                 } else if (subject[i] == Delimiters::ValueDelimiter) {
 
                     // If found value delimiter, add the value and strip it from subject
-                    subject = subject.substr(i + 1);
-                    snowcrash::TrimString(subject);
+                    subject = snowcrash::TrimStringView(subject.substr(i + 1));
 
-                    snowcrash::TrimString(value);
-                    out.values.push_back(snowcrash::StripBackticks(value));
+                    snowcrash::StringView trimmedValue = snowcrash::TrimStringView(value);
+                    out.values.push_back(snowcrash::StripBackticksView(trimmedValue).str());
 
-                    value = "";
+                    value.clear();
                     i = 0;
                 } else if ((traits.attributesTrait && subject[i] == Delimiters::AttributesBeginDelimiter)
-                    || (traits.contentTrait
-                           && subject.substr(i, traits.delimiters.contentDelimiter.length())
-                               == traits.delimiters.contentDelimiter)) {
+                    || (traits.contentTrait && subject.substr(i).startsWith(traits.delimiters.contentDelimiter))) {
 
                     // If values section ends, strip it from subject
                     subject = subject.substr(i);
@@ -304,16 +297,14 @@ namespace scpl
 
             // If the subject ended with the values, strip the last value from the subject
             if (i == subject.length()) {
-                subject = "";
+                subject = subject.substr(i);
             }
 
-            snowcrash::TrimString(subject);
+            subject = snowcrash::TrimStringView(subject);
 
             // Fill signature value with the string which was stripped from subject
-            out.value = out.value.substr(0, out.value.length() - subject.length());
-
-            snowcrash::TrimString(out.value);
-            out.value = snowcrash::StripBackticks(out.value);
+            values = snowcrash::TrimStringView(values.substr(0, values.length() - subject.length()));
+            out.value = snowcrash::StripBackticksView(values).str();
         };
 
         /**
@@ -324,10 +315,10 @@ namespace scpl
          *                (which will be stripped of the parsed characters)
          * \param out Signature data structure
          */
-        static void parseSignatureAttributes(snowcrash::Report& report, mdp::ByteBuffer& subject, Signature& out)
+        static void parseSignatureAttributes(snowcrash::Report& report, snowcrash::StringView& subject, Signature& out)
         {
 
-            if (subject[0] != Delimiters::AttributesBeginDelimiter) {
+            if (subject.empty() || subject[0] != Delimiters::AttributesBeginDelimiter) {
                 return;
             }
 
@@ -341,13 +332,13 @@ namespace scpl
                 size_t length = attribute.size();
 
                 // If the last char is not an attribute delimiter, attributes are finished
-                if (attribute[length - 1] != Delimiters::AttributeDelimiter) {
+                if (length == 0 || attribute[length - 1] != Delimiters::AttributeDelimiter) {
                     attributesNotFinished = false;
                 } else {
-                    attribute = attribute.substr(0, length - 1);
+                    attribute.erase(length - 1);
 
-                    // For easier processing
-                    subject = Delimiters::AttributesBeginDelimiter + subject;
+                    // Continue from the attribute delimiter as if it began the attributes
+                    subject = snowcrash::StringView(subject.data() - 1, subject.length() + 1);
                 }
 
                 snowcrash::TrimString(attribute);
@@ -357,7 +348,7 @@ namespace scpl
                 }
             };
 
-            snowcrash::TrimString(subject);
+            subject = snowcrash::TrimStringView(subject);
         };
 
         /**
@@ -372,7 +363,7 @@ namespace scpl
          *
          * \return String inside the given brackets. If not splitting by comma, append the brackets too
          */
-        static mdp::ByteBuffer matchBrackets(mdp::ByteBuffer& subject,
+        static mdp::ByteBuffer matchBrackets(snowcrash::StringView& subject,
             size_t begin,
             const char endBracket,
             const bool splitByAttribute = false,
@@ -392,10 +383,10 @@ namespace scpl
                 if (subject[i] == EscapeCharacter) {
 
                     // If escaped string, retrieve it and strip it from subject
-                    mdp::ByteBuffer escapedString = snowcrash::RetrieveEscaped(subject, i);
+                    snowcrash::StringView escapedString = snowcrash::RetrieveEscapedView(subject, i);
 
                     if (!escapedString.empty()) {
-                        returnString += escapedString;
+                        returnString.append(escapedString.data(), escapedString.length());
                         i = 0;
                     } else {
                         returnString += subject[i];
@@ -434,11 +425,28 @@ namespace scpl
             }
 
             if (i == subject.length() && clearAtEnd) {
-                subject.clear();
+                subject = subject.substr(i);
             }
 
             return returnString;
         }
+
+        /**
+         * \brief Find the matching bracket, copying equivalent of `matchBrackets()` on a view
+         */
+        static mdp::ByteBuffer matchBrackets(mdp::ByteBuffer& subject,
+            size_t begin,
+            const char endBracket,
+            const bool splitByAttribute = false,
+            const bool clearAtEnd = false)
+        {
+            snowcrash::StringView view(subject);
+            mdp::ByteBuffer returnString = matchBrackets(view, begin, endBracket, splitByAttribute, clearAtEnd);
+
+            subject.erase(0, view.data() - subject.data());
+
+            return returnString;
+        }
     };
 }
 
@@ -34,7 +34,7 @@ namespace snowcrash
          *
          *  Creates an empty annotation with the default annotation code.
          */
-        SourceAnnotation() : code(OK)
+        SourceAnnotation() : code(OK), messageFormat(NULL)
         {
         }
 
@@ -48,6 +48,9 @@ namespace snowcrash
             this->message = rhs.message;
             this->code = rhs.code;
             this->location = rhs.location;
+            this->messageFormat = rhs.messageFormat;
+            this->messageArguments = rhs.messageArguments;
+            this->byteLocation = rhs.byteLocation;
         }
 
         /**
@@ -63,6 +66,7 @@ namespace snowcrash
 
             this->message = message;
             this->code = code;
+            this->messageFormat = NULL;
 
             this->location.clear();
             if (!location.empty())
@@ -83,9 +87,18 @@ namespace snowcrash
             this->message = rhs.message;
             this->code = rhs.code;
             this->location = rhs.location;
+            this->messageFormat = rhs.messageFormat;
+            this->messageArguments = rhs.messageArguments;
+            this->byteLocation = rhs.byteLocation;
             return *this;
         }
 
+        /** \return True if the message and the location are not formatted yet */
+        bool isDeferred() const
+        {
+            return messageFormat != NULL;
+        }
+
         /** The location of this annotation within the source data buffer. */
         mdp::CharactersRangeSet location;
 
@@ -94,6 +107,20 @@ namespace snowcrash
 
         /** A annotation message. */
         std::string message;
+
+        /**
+         *  Format of the message of a deferred annotation, NULL if formatted.
+         *  While set, `message` and `location` are empty, the annotation is
+         *  described by `messageArguments` and `byteLocation` until it is
+         *  formatted by `FormatWarnings()`.
+         */
+        const char* messageFormat;
+
+        /** Arguments of the format of a deferred annotation, empty if formatted */
+        std::string messageArguments;
+
+        /** The location of a deferred annotation in bytes, empty if formatted */
+        mdp::BytesRangeSet byteLocation;
     };
 
     /**
@@ -110,7 +137,9 @@ namespace snowcrash
         ApplicationError = 1,
         BusinessError = 2,
         ModelError = 3,
-        MSONError = 4
+        MSONError = 4,
+        CancelledError = 5,   /// < Parsing cancelled or past its deadline, see `ParseLimits`
+        MemoryBudgetError = 6 /// < Parsing exceeded its memory budget, see `ParseLimits`
     };
 
     /**
@@ -139,6 +168,15 @@ namespace snowcrash
         HTTPWarning = 13
     };
 
+    /** Set of warning codes, e.g. `WarningCodeMask(IndentationWarning) | WarningCodeMask(DuplicateWarning)` */
+    typedef unsigned int WarningMask;
+
+    /** \return Set of warning codes with the code only */
+    inline WarningMask WarningCodeMask(WarningCode code)
+    {
+        return 1u << code;
+    }
+
     /**
      *  A set of warning source annotations.
      */
@@ -0,0 +1,248 @@
+//
+//  SourceMapUtility.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SOURCEMAPUTILITY_H
+#define SNOWCRASH_SOURCEMAPUTILITY_H
+
+#include <cstddef>
+#include "BlueprintSourcemap.h"
+#include "SourceAnnotation.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief  Move all the ranges of a range set by an offset
+     *
+     *  Used when the source data preceding the ranges has been edited.
+     */
+    template <typename T>
+    inline void ShiftRangeSet(mdp::RangeSet<T>& rangeSet, std::ptrdiff_t offset)
+    {
+        for (typename mdp::RangeSet<T>::iterator it = rangeSet.begin(); it != rangeSet.end(); ++it) {
+            it->location += offset;
+        }
+    }
+
+    /** Move a source map and all its nested source maps by an offset in bytes */
+    inline void ShiftSourceMap(SourceMapBase& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Values>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<MetadataCollection>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Parameter>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Parameters>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Payload>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Requests>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<TransactionExample>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<TransactionExamples>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Action>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Actions>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Resource>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Element>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<Elements>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::TypeNames>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::TypeSection>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::TypeSections>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::NamedType>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::ValueMember>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::PropertyMember>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::Element>& sourceMap, std::ptrdiff_t offset);
+    inline void ShiftSourceMap(SourceMap<mson::Elements>& sourceMap, std::ptrdiff_t offset);
+
+    /** Move every source map of a collection */
+    template <typename T>
+    inline void ShiftSourceMapCollection(typename Collection<SourceMap<T> >::type& collection, std::ptrdiff_t offset)
+    {
+        for (typename Collection<SourceMap<T> >::iterator it = collection.begin(); it != collection.end(); ++it) {
+            ShiftSourceMap(*it, offset);
+        }
+    }
+
+    inline void ShiftSourceMap(SourceMapBase& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Values>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<Value>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<MetadataCollection>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<Metadata>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Parameter>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.name, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.type, offset);
+        ShiftSourceMap(sourceMap.use, offset);
+        ShiftSourceMap(sourceMap.defaultValue, offset);
+        ShiftSourceMap(sourceMap.exampleValue, offset);
+        ShiftSourceMap(sourceMap.values, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Parameters>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<Parameter>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Payload>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.name, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.parameters, offset);
+        ShiftSourceMap(sourceMap.headers, offset);
+        ShiftSourceMap(sourceMap.attributes, offset);
+        ShiftSourceMap(sourceMap.body, offset);
+        ShiftSourceMap(sourceMap.schema, offset);
+        ShiftSourceMap(sourceMap.reference, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Requests>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<Request>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<TransactionExample>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.name, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.requests, offset);
+        ShiftSourceMap(sourceMap.responses, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<TransactionExamples>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<TransactionExample>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Action>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.method, offset);
+        ShiftSourceMap(sourceMap.name, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.parameters, offset);
+        ShiftSourceMap(sourceMap.attributes, offset);
+        ShiftSourceMap(sourceMap.uriTemplate, offset);
+        ShiftSourceMap(sourceMap.relation, offset);
+        ShiftSourceMap(sourceMap.headers, offset);
+        ShiftSourceMap(sourceMap.examples, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Actions>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<Action>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Resource>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.uriTemplate, offset);
+        ShiftSourceMap(sourceMap.name, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.model, offset);
+        ShiftSourceMap(sourceMap.attributes, offset);
+        ShiftSourceMap(sourceMap.parameters, offset);
+        ShiftSourceMap(sourceMap.headers, offset);
+        ShiftSourceMap(sourceMap.actions, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Element>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.attributes.name, offset);
+        ShiftSourceMap(sourceMap.content.copy, offset);
+        ShiftSourceMap(sourceMap.content.resource, offset);
+        ShiftSourceMap(sourceMap.content.dataStructure, offset);
+        ShiftSourceMap(sourceMap.content.elements(), offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<Elements>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<Element>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::TypeNames>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<mson::TypeName>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::TypeSection>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.value, offset);
+        ShiftSourceMap(sourceMap.elements(), offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::TypeSections>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<mson::TypeSection>(sourceMap.collection, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::NamedType>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.name, offset);
+        ShiftSourceMap(sourceMap.typeDefinition, offset);
+        ShiftSourceMap(sourceMap.sections, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::ValueMember>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.description, offset);
+        ShiftSourceMap(sourceMap.valueDefinition, offset);
+        ShiftSourceMap(sourceMap.sections, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::PropertyMember>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMap(static_cast<SourceMap<mson::ValueMember>&>(sourceMap), offset);
+        ShiftSourceMap(sourceMap.name, offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::Element>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftRangeSet(sourceMap.sourceMap, offset);
+        ShiftSourceMap(sourceMap.property, offset);
+        ShiftSourceMap(sourceMap.value, offset);
+        ShiftSourceMap(sourceMap.mixin, offset);
+
+        // One Of shares the collection with elements
+        ShiftSourceMap(sourceMap.elements(), offset);
+    }
+
+    inline void ShiftSourceMap(SourceMap<mson::Elements>& sourceMap, std::ptrdiff_t offset)
+    {
+        ShiftSourceMapCollection<mson::Element>(sourceMap.collection, offset);
+    }
+
+    /**
+     *  \brief Move locations of all the annotations of a report
+     *  \param offset      Offset in characters
+     *  \param byteOffset  Offset in bytes, of the deferred warnings
+     */
+    inline void ShiftReport(Report& report, std::ptrdiff_t offset, std::ptrdiff_t byteOffset)
+    {
+        ShiftRangeSet(report.error.location, offset);
+
+        for (Warnings::iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
+            ShiftRangeSet(it->location, offset);
+            ShiftRangeSet(it->byteLocation, byteOffset);
+        }
+    }
+}
+
+#endif
@@ -32,6 +32,121 @@ namespace snowcrash
         return false;
     }
 
+    /**
+     *  \brief  Non-owning view of a range of characters
+     *
+     *  Lets the string helpers work on a part of a string without copying
+     *  it. The viewed characters must outlive the view and must not change.
+     */
+    class StringView
+    {
+    public:
+        static const size_t npos = std::string::npos;
+
+        StringView() : m_data(""), m_length(0) {}
+
+        StringView(const std::string& s) : m_data(s.data()), m_length(s.length()) {}
+
+        StringView(const char* data, size_t length) : m_data(data), m_length(length) {}
+
+        const char* data() const
+        {
+            return m_data;
+        }
+
+        size_t length() const
+        {
+            return m_length;
+        }
+
+        bool empty() const
+        {
+            return m_length == 0;
+        }
+
+        const char* begin() const
+        {
+            return m_data;
+        }
+
+        const char* end() const
+        {
+            return m_data + m_length;
+        }
+
+        char operator[](size_t i) const
+        {
+            return m_data[i];
+        }
+
+        /** \return View of at most \a n characters from \a pos, empty at the end if \a pos is past it */
+        StringView substr(size_t pos, size_t n = npos) const
+        {
+            if (pos > m_length)
+                pos = m_length;
+
+            return StringView(m_data + pos, std::min(n, m_length - pos));
+        }
+
+        /** \return Position of the first \a c from \a pos, `npos` if not found */
+        size_t find(char c, size_t pos = 0) const
+        {
+            for (; pos < m_length; ++pos)
+                if (m_data[pos] == c)
+                    return pos;
+
+            return npos;
+        }
+
+        /** \return Position of the first \a s from \a pos, `npos` if not found */
+        size_t find(const StringView& s, size_t pos = 0) const
+        {
+            const char* it = std::search(begin() + std::min(pos, m_length), end(), s.begin(), s.end());
+            return it == end() ? (s.empty() && pos <= m_length ? pos : npos) : it - m_data;
+        }
+
+        /** \return True if the view starts with \a prefix */
+        bool startsWith(const StringView& prefix) const
+        {
+            return prefix.m_length <= m_length && std::equal(prefix.begin(), prefix.end(), m_data);
+        }
+
+        /** \return Copy of the viewed characters */
+        std::string str() const
+        {
+            return std::string(m_data, m_length);
+        }
+
+        bool operator==(const StringView& rhs) const
+        {
+            return m_length == rhs.m_length && std::equal(begin(), end(), rhs.begin());
+        }
+
+        bool operator!=(const StringView& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        const char* m_data;
+        size_t m_length;
+    };
+
+    /** \return View without the leading and trailing spaces */
+    inline StringView TrimStringView(const StringView& s)
+    {
+        const char* begin = s.begin();
+        const char* end = s.end();
+
+        while (begin != end && isSpace(*begin))
+            ++begin;
+
+        while (end != begin && isSpace(*(end - 1)))
+            --end;
+
+        return StringView(begin, end - begin);
+    }
+
     // Trim string from start
     inline std::string& TrimStringStart(std::string& s)
     {
@@ -49,7 +164,13 @@ namespace snowcrash
     // Trim both ends of string
     inline std::string& TrimString(std::string& s)
     {
-        return TrimStringStart(TrimStringEnd(s));
+        StringView trimmed = TrimStringView(s);
+        size_t begin = trimmed.begin() - s.data();
+
+        s.erase(begin + trimmed.length());
+        s.erase(0, begin);
+
+        return s;
     }
 
     // <position form begin, length of string>
@@ -126,15 +247,47 @@ namespace snowcrash
      */
     inline std::string ReplaceString(const std::string& s, const std::string& find, const std::string& replace)
     {
-        size_t pos = 0;
-        std::string target(s);
-        while ((pos = target.find(find, pos)) != std::string::npos) {
-            target.replace(pos, find.length(), replace);
-            pos += replace.length();
+        size_t pos = s.find(find);
+
+        if (pos == std::string::npos || find.empty())
+            return s;
+
+        // Copy the unchanged parts once instead of shifting the rest on every replacement
+        std::string target;
+        target.reserve(s.length());
+
+        size_t last = 0;
+
+        for (; pos != std::string::npos; pos = s.find(find, last)) {
+            target.append(s, last, pos - last);
+            target.append(replace);
+            last = pos + find.length();
         }
+
+        target.append(s, last, std::string::npos);
         return target;
     }
 
+    /**
+     *  \brief  Extract the first line from a string without copying it.
+     *
+     *  \param  s   Subject of the extraction
+     *  \param  r   Remaining content after the extraction, empty if there is a single line
+     *  \return First line from the subject string
+     */
+    inline StringView GetFirstLineView(const StringView& s, StringView& r)
+    {
+        size_t pos = s.find('\n');
+
+        if (pos == StringView::npos) {
+            r = s.substr(s.length());
+            return s;
+        }
+
+        r = s.substr(pos + 1);
+        return s.substr(0, pos);
+    }
+
     /**
      *  \brief  Extract the first line from a string.
      *
@@ -144,12 +297,14 @@ namespace snowcrash
      */
     inline std::string GetFirstLine(const std::string& s, std::string& r)
     {
-        std::vector<std::string> elem = SplitOnFirst(s, '\n');
-        if (elem.empty())
-            return std::string();
-        if (elem.size() > 1)
-            r = elem.back();
-        return elem.front();
+        StringView remaining;
+        StringView line = GetFirstLineView(s, remaining);
+        std::string first = line.str();
+
+        if (line.length() < s.length())
+            r.assign(remaining.data(), remaining.length());
+
+        return first;
     }
 
     /**
@@ -231,22 +386,24 @@ namespace snowcrash
      *
      * \example (begin = 1, subject = "a```b```cd") ----> (return = "```b```", subject = "cd")
      */
-    inline std::string RetrieveEscaped(std::string& subject, size_t begin = 0, const bool stripEscapeChars = false)
+    inline StringView RetrieveEscapedView(StringView& subject, size_t begin = 0, const bool stripEscapeChars = false)
     {
+        if (begin >= subject.length())
+            return StringView();
 
         size_t levels = 0;
         const char escapeChar = subject[begin];
 
         // Get the level of the backticks
-        while (subject[levels + begin] == escapeChar) {
+        while (levels + begin < subject.length() && subject[levels + begin] == escapeChar) {
             levels++;
         }
 
-        std::string borderChars = subject.substr(begin, levels);
+        StringView borderChars = subject.substr(begin, levels);
         size_t end = subject.substr(levels + begin).find(borderChars);
 
-        if (end == std::string::npos) {
-            return "";
+        if (end == StringView::npos) {
+            return StringView();
         }
 
         if (stripEscapeChars) {
@@ -256,12 +413,28 @@ namespace snowcrash
             end = end + (2 * levels) + begin;
         }
 
-        std::string escapedString = subject.substr(begin, end - begin);
+        StringView escapedString = subject.substr(begin, end - begin);
         subject = subject.substr(end);
 
         return escapedString;
     }
 
+    /**
+     * \brief Retrieve the string enclosed by the given matching escaping characters
+     *
+     *        Copying equivalent of `RetrieveEscapedView()`, the subject is stripped
+     *        of the escaped string and the characters before it.
+     */
+    inline std::string RetrieveEscaped(std::string& subject, size_t begin = 0, const bool stripEscapeChars = false)
+    {
+        StringView view(subject);
+        std::string escapedString = RetrieveEscapedView(view, begin, stripEscapeChars).str();
+
+        subject.erase(0, view.data() - subject.data());
+
+        return escapedString;
+    }
+
     /**
      * \brief Strip the enclosing backticks and return the string in the middle.
      *
@@ -271,22 +444,35 @@ namespace snowcrash
      *
      * \return Substring that has been stripped of enclosing backticks
      */
-    inline std::string StripBackticks(std::string& subject)
+    inline StringView StripBackticksView(StringView& subject)
     {
 
         // Check if first and last chars are backticks
-        if (subject[0] != '`' || subject[subject.length() - 1] != '`') {
+        if (subject.empty() || subject[0] != '`' || subject[subject.length() - 1] != '`') {
 
             return subject;
         }
 
-        std::string escapedString = RetrieveEscaped(subject, 0, true);
+        StringView escapedString = RetrieveEscapedView(subject, 0, true);
 
         if (escapedString.empty()) {
             return subject;
         }
 
-        TrimString(escapedString);
+        return TrimStringView(escapedString);
+    }
+
+    /**
+     * \brief Strip the enclosing backticks and return the string in the middle.
+     *
+     *        Copying equivalent of `StripBackticksView()`.
+     */
+    inline std::string StripBackticks(std::string& subject)
+    {
+        StringView view(subject);
+        std::string escapedString = StripBackticksView(view).str();
+
+        subject.erase(0, view.data() - subject.data());
 
         return escapedString;
     }
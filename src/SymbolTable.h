@@ -0,0 +1,72 @@
+//
+//  SymbolTable.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SYMBOLTABLE_H
+#define SNOWCRASH_SYMBOLTABLE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace snowcrash
+{
+
+    /** Dense ID of an interned symbol, IDs are assigned from zero */
+    typedef size_t SymbolID;
+
+    /** ID of a symbol which is not interned */
+    const SymbolID UndefinedSymbolID = static_cast<SymbolID>(-1);
+
+    /**
+     *  \brief Interned symbols, e.g. names of named types
+     *
+     *  Maps every symbol to a dense ID so tables of symbols can be kept
+     *  in vectors indexed by the ID and compared without comparing strings.
+     */
+    class SymbolTable
+    {
+    public:
+        /** \return ID of the symbol, interned if not yet */
+        SymbolID intern(const std::string& symbol)
+        {
+            std::pair<std::unordered_map<std::string, SymbolID>::iterator, bool> result
+                = m_ids.insert(std::make_pair(symbol, m_symbols.size()));
+
+            if (result.second) {
+                m_symbols.push_back(symbol);
+            }
+
+            return result.first->second;
+        }
+
+        /** \return ID of the symbol, `UndefinedSymbolID` if not interned */
+        SymbolID find(const std::string& symbol) const
+        {
+            std::unordered_map<std::string, SymbolID>::const_iterator it = m_ids.find(symbol);
+            return (it == m_ids.end()) ? UndefinedSymbolID : it->second;
+        }
+
+        /** \return Symbol of the ID */
+        const std::string& symbol(SymbolID id) const
+        {
+            return m_symbols[id];
+        }
+
+        /** \return Number of interned symbols */
+        size_t size() const
+        {
+            return m_symbols.size();
+        }
+
+    private:
+        std::unordered_map<std::string, SymbolID> m_ids;
+        std::vector<std::string> m_symbols;
+    };
+}
+
+#endif
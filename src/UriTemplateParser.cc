@@ -8,6 +8,7 @@
 #include <iomanip>
 #include "UriTemplateParser.h"
 #include "RegexMatch.h"
+#include "WarningUtility.h"
 
 using namespace snowcrash;
 
@@ -124,6 +125,22 @@ static ClassifiedExpression ClassifyExpression(const Expression& expression)
 
 void URITemplateParser::parse(
     const URITemplate& uri, const mdp::CharactersRangeSet& sourceBlock, ParsedURITemplate& result)
+{
+    URITemplateWarnings warnings;
+
+    parse(uri, result, warnings);
+
+    for (URITemplateWarnings::const_iterator it = warnings.begin(); it != warnings.end(); ++it) {
+
+        std::string arguments;
+        AppendWarningArgument(arguments, it->expression);
+
+        result.report.warnings.push_back(
+            Warning(FormatWarningMessage(it->format, arguments), URIWarning, sourceBlock));
+    }
+}
+
+void URITemplateParser::parse(const URITemplate& uri, ParsedURITemplate& result, URITemplateWarnings& warnings)
 {
     CaptureGroups groups;
     Expressions expressions;
@@ -138,22 +155,18 @@ void URITemplateParser::parse(
         result.path = groups[4];
 
         if (HasMismatchedCurlyBrackets(result.path)) {
-            result.report.warnings.push_back(
-                Warning("The URI template contains mismatched expression brackets", URIWarning, sourceBlock));
+            warnings.push_back(URITemplateWarning("The URI template contains mismatched expression brackets"));
             return;
         }
 
         if (HasNestedCurlyBrackets(result.path)) {
-            result.report.warnings.push_back(
-                Warning("The URI template contains nested expression brackets", URIWarning, sourceBlock));
+            warnings.push_back(URITemplateWarning("The URI template contains nested expression brackets"));
             return;
         }
 
         if (PathContainsSquareBrackets(result.path)) {
-            result.report.warnings.push_back(Warning(
-                "The URI template contains square brackets, please percent encode square brackets as %5B and %5D",
-                URIWarning,
-                sourceBlock));
+            warnings.push_back(URITemplateWarning(
+                "The URI template contains square brackets, please percent encode square brackets as %%5B and %%5D"));
         }
 
         expressions = GetUriTemplateExpressions(result.path);
@@ -168,44 +181,39 @@ void URITemplateParser::parse(
                 bool hasIllegalCharacters = false;
 
                 if (classifiedExpression.ContainsSpaces()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression
-                       << "\" contains spaces. Allowed characters for expressions are A-Z a-z 0-9 _ and percent "
-                          "encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+                    warnings.push_back(URITemplateWarning(
+                        "URI template expression \"%s\" contains spaces. Allowed characters for expressions are "
+                        "A-Z a-z 0-9 _ and percent encoded characters",
+                        classifiedExpression.innerExpression));
                     hasIllegalCharacters = true;
                 }
 
                 if (classifiedExpression.ContainsHyphens()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression
-                       << "\" contains hyphens. Allowed characters for expressions are A-Z a-z 0-9 _ and percent "
-                          "encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+                    warnings.push_back(URITemplateWarning(
+                        "URI template expression \"%s\" contains hyphens. Allowed characters for expressions are "
+                        "A-Z a-z 0-9 _ and percent encoded characters",
+                        classifiedExpression.innerExpression));
                     hasIllegalCharacters = true;
                 }
 
                 if (classifiedExpression.ContainsAssignment()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression
-                       << "\" contains assignment. Allowed characters for expressions are A-Z a-z 0-9 _ and percent "
-                          "encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+                    warnings.push_back(URITemplateWarning(
+                        "URI template expression \"%s\" contains assignment. Allowed characters for expressions are "
+                        "A-Z a-z 0-9 _ and percent encoded characters",
+                        classifiedExpression.innerExpression));
                     hasIllegalCharacters = true;
                 }
 
                 if (!hasIllegalCharacters) {
                     if (classifiedExpression.IsInvalidExpressionName()) {
-                        std::stringstream ss;
-                        ss << "URI template expression \"" << classifiedExpression.innerExpression
-                           << "\" contains invalid characters. Allowed characters for expressions are A-Z a-z 0-9 _ "
-                              "and percent encoded characters";
-                        result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+                        warnings.push_back(URITemplateWarning(
+                            "URI template expression \"%s\" contains invalid characters. Allowed characters for "
+                            "expressions are A-Z a-z 0-9 _ and percent encoded characters",
+                            classifiedExpression.innerExpression));
                     }
                 }
             } else {
-                result.report.warnings.push_back(
-                    Warning(classifiedExpression.unsupportedWarningText, URIWarning, sourceBlock));
+                warnings.push_back(URITemplateWarning(classifiedExpression.unsupportedWarningText));
             }
             currentExpression++;
         }
@@ -31,6 +31,28 @@ namespace snowcrash
         Report report;
     };
 
+    /**
+    *  \brief Warning of a URI template, to be formatted by `FormatWarningMessage()`.
+    */
+    struct URITemplateWarning {
+
+        URITemplateWarning(const char* format_, const std::string& expression_ = std::string())
+            : format(format_), expression(expression_)
+        {
+        }
+
+        /** Message with `%s` in place of the expression, a string constant */
+        const char* format;
+
+        /** Expression the warning is about, empty if none */
+        std::string expression;
+    };
+
+    /**
+    *  \brief collection of URI template warnings.
+    */
+    typedef std::vector<URITemplateWarning> URITemplateWarnings;
+
     /**
     *  \brief URI template expression.
     */
@@ -62,7 +84,8 @@ namespace snowcrash
             innerExpression = expression;
         }
 
-        std::string unsupportedWarningText;
+        /** Message of the warning of an unsupported expression, a string constant */
+        const char* unsupportedWarningText;
 
         snowcrash::Expression innerExpression;
 
@@ -275,6 +298,18 @@ namespace snowcrash
         */
         static void parse(
             const URITemplate& uri, const mdp::CharactersRangeSet& sourceBlock, ParsedURITemplate& result);
+
+        /**
+        *  \brief Parse the URI template, keeping message formats and arguments of the warnings
+        *
+        *  The warnings are not added to the report of \a result, they are to
+        *  be reported by the caller, e.g. by `ReportWarning()`.
+        *
+        *  \param uri        A uri to be parsed.
+        *  \param result     Parsed URI template, its report gets an error only.
+        *  \param warnings   Warnings of the URI template to be appended to.
+        */
+        static void parse(const URITemplate& uri, ParsedURITemplate& result, URITemplateWarnings& warnings);
     };
 }
 
@@ -53,13 +53,13 @@ namespace snowcrash
                     TrimString(content);
 
                     // WARN: Ignoring the unexpected param value
-                    std::stringstream ss;
-                    ss << "ignoring the '" << content << "' element";
-                    ss << ", expected '`" << content << "`'";
-
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
-                    out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
+                    ReportWarning(out.report,
+                        pd,
+                        IgnoringWarning,
+                        node->sourceMap,
+                        "ignoring the '%s' element, expected '`%s`'",
+                        content,
+                        content);
                 }
 
                 return ++MarkdownNodeIterator(node);
@@ -0,0 +1,171 @@
+//
+//  WarningUtility.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_WARNINGUTILITY_H
+#define SNOWCRASH_WARNINGUTILITY_H
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "SectionParserData.h"
+
+namespace snowcrash
+{
+
+    /** Append an argument of a warning message, prefixed by its length */
+    inline void AppendWarningArgument(std::string& arguments, const char* data, size_t length)
+    {
+        arguments.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        arguments.append(data, length);
+    }
+
+    inline void AppendWarningArgument(std::string& arguments, const std::string& argument)
+    {
+        AppendWarningArgument(arguments, argument.data(), argument.length());
+    }
+
+    inline void AppendWarningArgument(std::string& arguments, const char* argument)
+    {
+        AppendWarningArgument(arguments, argument, std::strlen(argument));
+    }
+
+    inline void AppendWarningArgument(std::string& arguments, char argument)
+    {
+        AppendWarningArgument(arguments, &argument, 1);
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value>::type AppendWarningArgument(
+        std::string& arguments, T argument)
+    {
+        AppendWarningArgument(arguments, std::to_string(argument));
+    }
+
+    inline void AppendWarningArguments(std::string&)
+    {
+    }
+
+    template <typename T, typename... Arguments>
+    inline void AppendWarningArguments(std::string& arguments, const T& argument, const Arguments&... rest)
+    {
+        AppendWarningArgument(arguments, argument);
+        AppendWarningArguments(arguments, rest...);
+    }
+
+    /**
+     *  \brief  Format a warning message
+     *  \param  format      Message with `%s` in place of every argument and `%%` in place of `%`
+     *  \param  arguments   Arguments as appended by `AppendWarningArguments()`
+     *  \return The message
+     */
+    inline std::string FormatWarningMessage(const char* format, const std::string& arguments)
+    {
+        std::string message;
+        size_t position = 0;
+
+        for (const char* c = format; *c; ++c) {
+
+            if (*c != '%' || (c[1] != 's' && c[1] != '%')) {
+                message += *c;
+                continue;
+            }
+
+            ++c;
+
+            if (*c == '%') {
+                message += '%';
+                continue;
+            }
+
+            size_t length = 0;
+
+            if (position + sizeof(length) > arguments.length())
+                continue;
+
+            std::memcpy(&length, arguments.data() + position, sizeof(length));
+            position += sizeof(length);
+
+            message.append(arguments, position, length);
+            position += length;
+        }
+
+        return message;
+    }
+
+    /** Format the message and the location of a deferred warning */
+    inline void FormatWarning(Warning& warning, const mdp::ByteBufferCharacterIndex& index)
+    {
+        if (!warning.isDeferred())
+            return;
+
+        warning.message = FormatWarningMessage(warning.messageFormat, warning.messageArguments);
+        warning.location = mdp::BytesRangeSetToCharactersRangeSet(warning.byteLocation, index);
+        warning.messageFormat = NULL;
+        warning.messageArguments.clear();
+        warning.byteLocation.clear();
+    }
+
+    /** Format all the deferred warnings of a report */
+    inline void FormatWarnings(Report& report, const mdp::ByteBufferCharacterIndex& index)
+    {
+        for (Warnings::iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
+            FormatWarning(*it, index);
+        }
+    }
+
+    /**
+     *  \brief Report a warning unless its code is suppressed or the report is full
+     *
+     *  A report holding `ParseLimits::warningLimit` warnings is full, later
+     *  warnings would be dropped once parsed anyway.
+     *
+     *  The warning is formatted right away unless the parser defers the
+     *  warnings, the format, the arguments and the location in bytes are
+     *  kept then. The format has to be a string constant, it is not copied.
+     *
+     *  \param report       Report to append the warning to
+     *  \param pd           Parser data
+     *  \param code         Warning code
+     *  \param sourceMap    Location of the warning in bytes
+     *  \param format       Message with `%s` in place of every argument and `%%` in place of `%`
+     *  \param arguments    Arguments of the message, strings, characters or integers
+     */
+    template <typename... Arguments>
+    inline void ReportWarning(Report& report,
+        const SectionParserData& pd,
+        WarningCode code,
+        const mdp::BytesRangeSet& sourceMap,
+        const char* format,
+        const Arguments&... arguments)
+    {
+        if (pd.isWarningSuppressed(code))
+            return;
+
+        if (pd.limits.warningLimit && report.warnings.size() >= pd.limits.warningLimit)
+            return;
+
+        report.warnings.push_back(Warning());
+
+        Warning& warning = report.warnings.back();
+        warning.code = code;
+
+        std::string messageArguments;
+        AppendWarningArguments(messageArguments, arguments...);
+
+        if (pd.deferWarnings) {
+            warning.messageFormat = format;
+            warning.messageArguments.swap(messageArguments);
+            warning.byteLocation.assign(sourceMap.begin(), sourceMap.end());
+        } else {
+            warning.message = FormatWarningMessage(format, messageArguments);
+            warning.location = mdp::BytesRangeSetToCharactersRangeSet(sourceMap, pd.sourceCharacterIndex);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,98 @@
+//
+//  WorkerPool.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "WorkerPool.h"
+
+using namespace snowcrash;
+
+namespace
+{
+    /** Tasks shared by the workers of a single `RunTasks()` call */
+    class TaskQueue
+    {
+    public:
+        TaskQueue(size_t taskCount, const WorkerTask& task) : m_taskCount(taskCount), m_task(task), m_next(0) {}
+
+        /** Run tasks until there are none left */
+        void work()
+        {
+            for (size_t i = m_next++; i < m_taskCount; i = m_next++) {
+
+                try {
+                    m_task(i);
+                } catch (...) {
+
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    if (!m_exception)
+                        m_exception = std::current_exception();
+
+                    // Do not start any other task
+                    m_next = m_taskCount;
+                }
+            }
+        }
+
+        /** Rethrow the first exception thrown by a task, if any */
+        void rethrow()
+        {
+            if (m_exception)
+                std::rethrow_exception(m_exception);
+        }
+
+    private:
+        const size_t m_taskCount;
+        const WorkerTask& m_task;
+        std::atomic<size_t> m_next;
+
+        std::mutex m_mutex;
+        std::exception_ptr m_exception;
+    };
+}
+
+size_t snowcrash::DefaultWorkerCount()
+{
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void snowcrash::RunTasks(size_t taskCount, size_t workerCount, const WorkerTask& task)
+{
+    if (workerCount == 0)
+        workerCount = DefaultWorkerCount();
+
+    workerCount = std::min(workerCount, taskCount);
+
+    TaskQueue queue(taskCount, task);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    // The calling thread is one of the workers
+    for (size_t i = 1; i < workerCount; ++i) {
+
+        try {
+            workers.push_back(std::thread(&TaskQueue::work, &queue));
+        } catch (const std::system_error&) {
+            // Continue with the workers started so far
+            break;
+        }
+    }
+
+    queue.work();
+
+    for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+        it->join();
+
+    queue.rethrow();
+}
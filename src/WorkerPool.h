@@ -0,0 +1,41 @@
+//
+//  WorkerPool.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_WORKERPOOL_H
+#define SNOWCRASH_WORKERPOOL_H
+
+#include <cstddef>
+#include <functional>
+
+namespace snowcrash
+{
+
+    /** Task run by `RunTasks()`, receives index of the task */
+    typedef std::function<void(size_t)> WorkerTask;
+
+    /** \return Number of hardware threads, at least one */
+    size_t DefaultWorkerCount();
+
+    /**
+     *  \brief  Run tasks on a pool of worker threads
+     *
+     *  Calls `task(i)` for every `i` in `[0, taskCount)`. Tasks are picked
+     *  in order by up to `workerCount` workers, the calling thread being one
+     *  of them. With a single worker all tasks run on the calling thread.
+     *
+     *  Returns once all the tasks are finished. If any task throws, the
+     *  remaining tasks are not started and the first exception is rethrown.
+     *
+     *  \param taskCount    Number of tasks to run
+     *  \param workerCount  Maximum number of workers, 0 for `DefaultWorkerCount()`
+     *  \param task         Task to run
+     */
+    void RunTasks(size_t taskCount, size_t workerCount, const WorkerTask& task);
+}
+
+#endif
@@ -0,0 +1,66 @@
+//
+//  MappedFile.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include "../MappedFile.h"
+
+using namespace snowcrash;
+
+MappedFile::MappedFile(const std::string& path) : m_data(""), m_length(0), m_open(false)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        m_error = std::strerror(errno);
+        return;
+    }
+
+    struct stat status;
+
+    if (::fstat(fd, &status) != 0) {
+        m_error = std::strerror(errno);
+        ::close(fd);
+        return;
+    }
+
+    if (!S_ISREG(status.st_mode)) {
+        m_error = "not a regular file";
+        ::close(fd);
+        return;
+    }
+
+    // Zero bytes cannot be mapped, an empty file has no data
+    if (status.st_size > 0) {
+
+        void* data = ::mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED) {
+            m_error = std::strerror(errno);
+            ::close(fd);
+            return;
+        }
+
+        m_data = static_cast<const char*>(data);
+        m_length = status.st_size;
+    }
+
+    // The mapping stays valid once the file is closed
+    ::close(fd);
+    m_open = true;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_length)
+        ::munmap(const_cast<char*>(m_data), m_length);
+}
@@ -8,38 +8,119 @@
 
 #include <regex.h>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include "../RegexMatch.h"
+#include "../Instrumentation.h"
+
+namespace
+{
+    /**
+     *  \brief  Compiled POSIX regular expression
+     *
+     *  Owns the `regex_t` and releases it on destruction. An expression
+     *  that failed to compile is kept in the cache as well (with `compiled`
+     *  set to false) so it is not recompiled on every call.
+     */
+    struct CompiledRegex {
+        regex_t regex;
+        bool compiled;
+
+        CompiledRegex(const std::string& expression, int flags)
+        {
+            compiled = (::regcomp(&regex, expression.c_str(), flags) == 0);
+        }
+
+        ~CompiledRegex()
+        {
+            if (compiled)
+                ::regfree(&regex);
+        }
+
+        CompiledRegex(const CompiledRegex&) = delete;
+        CompiledRegex& operator=(const CompiledRegex&) = delete;
+    };
+
+    typedef std::shared_ptr<CompiledRegex> CompiledRegexRef;
+    typedef std::unordered_map<std::string, CompiledRegexRef> CompiledRegexMap;
+
+    /**
+     *  \brief  Process-wide cache of compiled expressions
+     *
+     *  Expressions are compiled separately for matching (`REG_NOSUB`) and
+     *  for capturing. `regexec()` on a shared `regex_t` is thread-safe,
+     *  only the lookup is serialized.
+     */
+    class RegexCache
+    {
+    public:
+        CompiledRegexRef get(const std::string& expression, bool capture)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            CompiledRegexMap& map = capture ? m_capture : m_match;
+            CompiledRegexMap::const_iterator it = map.find(expression);
+
+            if (it != map.end()) {
+                ++m_statistics.hits;
+                return it->second;
+            }
+
+            ++m_statistics.misses;
+
+            int flags = capture ? REG_EXTENDED : (REG_EXTENDED | REG_NOSUB);
+            CompiledRegexRef regex = std::make_shared<CompiledRegex>(expression, flags);
+            map.insert(std::make_pair(expression, regex));
+
+            return regex;
+        }
+
+        snowcrash::RegexCacheStatistics statistics()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            snowcrash::RegexCacheStatistics result = m_statistics;
+            result.size = m_match.size() + m_capture.size();
+
+            return result;
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // Expressions being evaluated right now are kept alive by their owners
+            m_match.clear();
+            m_capture.clear();
+            m_statistics = snowcrash::RegexCacheStatistics();
+        }
+
+    private:
+        std::mutex m_mutex;
+        CompiledRegexMap m_match;
+        CompiledRegexMap m_capture;
+        snowcrash::RegexCacheStatistics m_statistics;
+    };
+
+    RegexCache regexCache;
+}
 
-// FIXME: Migrate to C++11.
-// Naive implementation of regex matching using POSIX regex
 bool snowcrash::RegexMatch(const std::string& target, const std::string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
-    regex_t regex;
-    int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED | REG_NOSUB);
-    if (reti) {
+    SNOWCRASH_INSTRUMENT_COUNT(RegexEvaluationsCounter, 1);
+
+    CompiledRegexRef regex = regexCache.get(expression, false);
+    if (!regex->compiled) {
         // Unable to compile regex
         return false;
     }
 
     // Execute regular expression
-    reti = ::regexec(&regex, target.c_str(), 0, NULL, 0);
-    if (!reti) {
-        ::regfree(&regex);
-        return true;
-    } else if (reti == REG_NOMATCH) {
-        ::regfree(&regex);
-        return false;
-    } else {
-        char msgbuf[1024];
-        regerror(reti, &regex, msgbuf, sizeof(msgbuf));
-        ::regfree(&regex);
-        return false;
-    }
-
-    return false;
+    return ::regexec(&regex->regex, target.c_str(), 0, NULL, 0) == 0;
 }
 
 std::string snowcrash::RegexCaptureFirst(const std::string& target, const std::string& expression)
@@ -57,37 +138,43 @@ bool snowcrash::RegexCapture(
     if (target.empty() || expression.empty())
         return false;
 
+    SNOWCRASH_INSTRUMENT_COUNT(RegexEvaluationsCounter, 1);
+
     captureGroups.clear();
 
     try {
-        regex_t regex;
-        int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED);
-        if (reti)
+        CompiledRegexRef regex = regexCache.get(expression, true);
+        if (!regex->compiled)
             return false;
 
-        regmatch_t* pmatch = ::new regmatch_t[groupSize];
-        ::memset(pmatch, 0, sizeof(regmatch_t) * groupSize);
+        std::vector<regmatch_t> pmatch(groupSize);
+        ::memset(pmatch.data(), 0, sizeof(regmatch_t) * groupSize);
 
-        reti = ::regexec(&regex, target.c_str(), groupSize, pmatch, 0);
-        if (!reti) {
-            ::regfree(&regex);
+        if (::regexec(&regex->regex, target.c_str(), groupSize, pmatch.data(), 0))
+            return false;
 
-            for (size_t i = 0; i < groupSize; ++i) {
-                if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
-                    captureGroups.push_back(std::string());
-                else
-                    captureGroups.push_back(std::string(target, pmatch[i].rm_so, pmatch[i].rm_eo - pmatch[i].rm_so));
-            }
+        captureGroups.reserve(groupSize);
 
-            delete[] pmatch;
-            return true;
-        } else {
-            ::regfree(&regex);
-            delete[] pmatch;
-            return false;
+        for (size_t i = 0; i < groupSize; ++i) {
+            if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
+                captureGroups.push_back(std::string());
+            else
+                captureGroups.push_back(std::string(target, pmatch[i].rm_so, pmatch[i].rm_eo - pmatch[i].rm_so));
         }
+
+        return true;
     } catch (...) {
     }
 
     return false;
 }
+
+snowcrash::RegexCacheStatistics snowcrash::GetRegexCacheStatistics()
+{
+    return regexCache.statistics();
+}
+
+void snowcrash::ClearRegexCache()
+{
+    regexCache.clear();
+}
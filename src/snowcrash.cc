@@ -8,6 +8,12 @@
 
 #include "snowcrash.h"
 #include "BlueprintParser.h"
+#include "Instrumentation.h"
+#include "MappedFile.h"
+#include "SourceMapUtility.h"
+#include "UTF8.h"
+#include "WarningUtility.h"
+#include "WorkerPool.h"
 
 const int snowcrash::SourceAnnotation::OK = 0;
 
@@ -15,60 +21,402 @@ using namespace snowcrash;
 
 /**
  *  \brief  Check source for unsupported character \t & \r
+ *  \param location     Byte offset of the data to be checked
+ *  \param length       Number of bytes to be checked, the rest of the source data is known to pass
  *  \return True if passed (not found), false otherwise
  */
-static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
+static bool CheckSource(const StringView& source, size_t location, size_t length, Report& report)
 {
+    SNOWCRASH_INSTRUMENT_STAGE("CheckSource");
 
-    std::string::size_type pos = source.find("\t");
+    const void* found = ::memchr(source.data() + location, '\t', length);
 
-    if (pos != std::string::npos) {
+    if (found) {
 
         mdp::BytesRangeSet rangeSet;
-        rangeSet.push_back(mdp::BytesRange(pos, 1));
+        rangeSet.push_back(mdp::BytesRange(static_cast<const char*>(found) - source.data(), 1));
         report.error = Error("the use of tab(s) '\\t' in source data isn't currently supported, please contact makers",
             BusinessError,
-            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, source));
+            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, source.data(), source.length()));
         return false;
     }
 
-    pos = source.find("\r");
+    found = ::memchr(source.data() + location, '\r', length);
 
-    if (pos != std::string::npos) {
+    if (found) {
 
         mdp::BytesRangeSet rangeSet;
-        rangeSet.push_back(mdp::BytesRange(pos, 1));
+        rangeSet.push_back(mdp::BytesRange(static_cast<const char*>(found) - source.data(), 1));
         report.error = Error(
             "the use of carriage return(s) '\\r' in source data isn't currently supported, please contact makers",
             BusinessError,
-            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, source));
+            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, source.data(), source.length()));
         return false;
     }
 
     return true;
 }
 
-int snowcrash::parse(
-    const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+/** \return Estimated bytes allocated by a Markdown node and all its children */
+static size_t MarkdownNodeMemory(const mdp::MarkdownNode& node)
+{
+    size_t bytes = node.text.capacity() + node.sourceMap.capacity() * sizeof(mdp::BytesRange)
+        + node.children().capacity() * sizeof(mdp::MarkdownNode);
+
+    for (mdp::MarkdownNodes::const_iterator it = node.children().begin(); it != node.children().end(); ++it) {
+        bytes += MarkdownNodeMemory(*it);
+    }
+
+    return bytes;
+}
+
+/** \return Estimated bytes allocated by the character index of the source data */
+static size_t CharacterIndexMemory(const StringView& source)
+{
+    return (source.length() / mdp::ByteBufferCharacterIndex::BlockSize + 1) * sizeof(size_t);
+}
+
+/** \return Estimated bytes allocated by a report */
+static size_t ReportMemory(const Report& report)
+{
+    size_t bytes = report.error.message.capacity() + report.error.location.capacity() * sizeof(mdp::CharactersRange)
+        + report.warnings.capacity() * sizeof(Warning);
+
+    for (Warnings::const_iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
+        bytes += it->message.capacity() + it->location.capacity() * sizeof(mdp::CharactersRange)
+            + it->messageArguments.capacity() + it->byteLocation.capacity() * sizeof(mdp::BytesRange);
+    }
+
+    return bytes;
+}
+
+/** Move a Markdown node and all its children by an offset in bytes */
+static void ShiftMarkdownNode(mdp::MarkdownNode& node, std::ptrdiff_t offset)
+{
+    ShiftRangeSet(node.sourceMap, offset);
+
+    for (mdp::MarkdownNodes::iterator it = node.children().begin(); it != node.children().end(); ++it) {
+        ShiftMarkdownNode(*it, offset);
+    }
+}
+
+/** \return True if the node, moved by an offset in bytes, is a top-level ATX header, e.g. `# Group` */
+static bool IsMarkdownBlockBoundary(const mdp::MarkdownNode& node, const mdp::ByteBuffer& source, std::ptrdiff_t offset)
+{
+    if (node.type != mdp::HeaderMarkdownNodeType || node.sourceMap.empty())
+        return false;
+
+    size_t location = node.sourceMap.front().location + offset;
+    return location < source.length() && source[location] == '#';
+}
+
+/** \return Offset of the byte following the line at given offset */
+static size_t LineEnd(const mdp::ByteBuffer& source, size_t location)
+{
+    size_t pos = source.find('\n', location);
+    return (pos == mdp::ByteBuffer::npos) ? source.length() : pos + 1;
+}
+
+/**
+ *  \brief  Check whether a text might open or close an HTML block
+ *
+ *  Sundown looks for the end of an HTML block in the rest of the source
+ *  data, the block can span over top-level headers. Any line starting
+ *  with a tag or a comment, and any closing tag or comment end counts.
+ */
+static bool MayDelimitHTMLBlock(const mdp::ByteBuffer& text)
+{
+    if (text.find("</") != mdp::ByteBuffer::npos || text.find("-->") != mdp::ByteBuffer::npos)
+        return true;
+
+    for (size_t pos = 0; pos < text.length(); pos = LineEnd(text, pos)) {
+
+        size_t start = text.find_first_not_of(" \t", pos);
+
+        if (start != mdp::ByteBuffer::npos && text[start] == '<')
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ *  \brief  Parse Markdown around an edit of the source data again
+ *
+ *  Sundown parses the text following a top-level ATX header line the same
+ *  way no matter what precedes the line, unless an HTML block spans over
+ *  the line. Nodes from the last such header whose line is not edited up
+ *  to the first such header after the edit are parsed again, together with
+ *  the line of the latter header to verify it still starts a block. Nodes
+ *  following the edit are moved. Text which might open or close an HTML
+ *  block is always parsed from scratch.
+ *
+ *  \param edit     Edit of the source data
+ *  \param state    State with the edited source data and the AST before the edit, AST updated
+ *  \return False if the AST has to be parsed from scratch
+ */
+static bool ReparseMarkdown(const SourceEdit& edit, ParseState& state)
+{
+    mdp::MarkdownNodes& nodes = state.markdownAST.children();
+    const mdp::ByteBuffer& source = state.source;
+
+    if (state.markdownAST.type != mdp::RootMarkdownNodeType || nodes.empty() || source.empty())
+        return false;
+
+    size_t editEnd = edit.location + edit.length;
+    std::ptrdiff_t offset = edit.text.length() - edit.length;
+
+    // Last block boundary preceding the edit
+    mdp::MarkdownNodes::iterator first = nodes.end();
+    mdp::MarkdownNodes::iterator it = nodes.begin();
+
+    for (; it != nodes.end() && !it->sourceMap.empty() && it->sourceMap.front().location <= edit.location; ++it) {
+
+        // The line is not edited, the source data up to the edit is the same
+        if (source.find('\n', it->sourceMap.front().location) < edit.location
+            && IsMarkdownBlockBoundary(*it, source, 0)) {
+            first = it;
+        }
+    }
+
+    if (first == nodes.end())
+        return false;
+
+    // First block boundary following the edit
+    mdp::MarkdownNodes::iterator last = first + 1;
+
+    while (last != nodes.end()
+        && !(!last->sourceMap.empty() && last->sourceMap.front().location >= editEnd
+               && IsMarkdownBlockBoundary(*last, source, offset))) {
+        ++last;
+    }
+
+    size_t begin = first->sourceMap.front().location;
+    size_t end = (last == nodes.end()) ? source.length() : last->sourceMap.front().location + offset;
+
+    if (begin > end || end > source.length())
+        return false;
+
+    mdp::ByteBuffer text = source.substr(begin, end - begin);
+
+    if (last != nodes.end())
+        text.append(source, end, LineEnd(source, end) - end);
+
+    // An HTML block might start within the text and end after it or the other way round
+    if (MayDelimitHTMLBlock(text))
+        return false;
+
+    mdp::MarkdownParser markdownParser;
+    mdp::MarkdownNode ast;
+    markdownParser.parse(text, ast);
+
+    mdp::MarkdownNodes& reparsed = ast.children();
+
+    if (reparsed.empty() || reparsed.front().type != mdp::HeaderMarkdownNodeType || reparsed.front().sourceMap.empty()
+        || reparsed.front().sourceMap.front().location != 0) {
+        return false;
+    }
+
+    if (last != nodes.end()) {
+
+        // The header following the edit has to remain a top-level header
+        const mdp::MarkdownNode& header = reparsed.back();
+
+        if (reparsed.size() < 2 || header.type != mdp::HeaderMarkdownNodeType || header.sourceMap.empty()
+            || header.sourceMap.front().location != end - begin || header.text != last->text) {
+            return false;
+        }
+
+        reparsed.pop_back();
+    }
+
+    for (it = reparsed.begin(); it != reparsed.end(); ++it) {
+        ShiftMarkdownNode(*it, begin);
+        it->setParent(&state.markdownAST);
+    }
+
+    for (it = last; it != nodes.end(); ++it) {
+        ShiftMarkdownNode(*it, offset);
+    }
+
+    size_t index = first - nodes.begin();
+    nodes.erase(first, last);
+    nodes.insert(
+        nodes.begin() + index, std::make_move_iterator(reparsed.begin()), std::make_move_iterator(reparsed.end()));
+
+    state.markdownAST.sourceMap.clear();
+    state.markdownAST.sourceMap.push_back(mdp::BytesRange(0, source.length()));
+
+    return true;
+}
+
+/**
+ *  \brief  Take over elements of the previous result to the segment cache
+ *
+ *  Elements of the cached segments are moved to the blueprint once parsed,
+ *  the result of the previous parse is expected to hold them. The cached
+ *  segments are dropped if it does not, and the result is reset.
+ */
+static void TakeOverElements(ParseState& state, const ParseResultRef<Blueprint>& out)
+{
+    BlueprintSegmentCache& cache = state.segmentCache;
+    Elements& elements = out.node.content.elements();
+    Collection<SourceMap<Element> >::type& elementSourceMaps = out.sourceMap.content.elements().collection;
+
+    bool exportSourceMap = (state.options & ExportSourcemapOption) != 0;
+
+    if (cache.segments.empty()
+        || elements.size() != cache.segments.back().elementIndex + cache.segments.back().elementCount
+        || (exportSourceMap && elementSourceMaps.size() != elements.size())) {
+        cache.segments.clear();
+    } else {
+        cache.elements.swap(elements);
+
+        if (exportSourceMap)
+            cache.elementSourceMaps.swap(elementSourceMaps);
+    }
+
+    out.node = Blueprint();
+    out.sourceMap = SourceMap<Blueprint>();
+    out.report = Report();
+}
+
+/**
+ *  \brief  Update cached segments after an edit of the source data
+ *
+ *  Segments touched by the edit are dropped, segments following the edit
+ *  are moved along with their elements.
+ *
+ *  \param characterOffset  Difference in the number of characters made by the edit
+ */
+static void ShiftSegmentCache(const SourceEdit& edit, std::ptrdiff_t characterOffset, ParseState& state)
 {
+    BlueprintSegmentCache& cache = state.segmentCache;
+    BlueprintSegmentResults& segments = cache.segments;
+
+    size_t editEnd = edit.location + edit.length;
+    std::ptrdiff_t offset = edit.text.length() - edit.length;
+
+    BlueprintSegmentResults::iterator kept = segments.begin();
+
+    for (BlueprintSegmentResults::iterator it = segments.begin(); it != segments.end(); ++it) {
+
+        if (it->location >= editEnd) {
+
+            it->location += offset;
+
+            for (size_t i = it->elementIndex;
+                 i < it->elementIndex + it->elementCount && i < cache.elementSourceMaps.size();
+                 ++i) {
+                ShiftSourceMap(cache.elementSourceMaps[i], offset);
+            }
+
+            ShiftReport(it->report, characterOffset, offset);
+
+            for (ModelSourceMapTable::iterator modelIt = it->modelSourceMapTable.begin();
+                 modelIt != it->modelSourceMapTable.end();
+                 ++modelIt) {
+                ShiftSourceMap(modelIt->second, offset);
+            }
+        } else if (it->location + it->length > edit.location) {
+            continue;
+        }
+
+        if (kept != it)
+            *kept = std::move(*it);
+
+        ++kept;
+    }
+
+    segments.erase(kept, segments.end());
+}
+
+/**
+ *  \brief  Parse the source data into a blueprint
+ *
+ *  \param markdownAST      Markdown AST of the source data, parsed unless \a edit is set
+ *  \param edit             Edit of the previous source data the AST is parsed again around, NULL if none
+ *  \param segmentCache     Segments of a previous parse, NULL if none
+ *  \param limits           Limits of the parse
+ *  \param statistics       Statistics of the parse to be filled in, NULL if not needed
+ *  \param visitor          Visitor of the parsed groups, NULL if the whole AST is kept
+ */
+static int ParseSource(const StringView& source,
+    BlueprintParserOptions options,
+    mdp::MarkdownNode& markdownAST,
+    const SourceEdit* edit,
+    BlueprintSegmentCache* segmentCache,
+    const ParseLimits& limits,
+    ParseStatistics* statistics,
+    BlueprintVisitor* visitor,
+    const ParseResultRef<Blueprint>& out)
+{
+    SNOWCRASH_INSTRUMENT_STAGE("ParseSource");
+
+    // Memory is accounted only if needed
+    ParseMemory memory(limits.memoryBudget);
+    bool accountMemory = limits.memoryBudget || statistics;
+    size_t releasedMemory = 0;
+
+    // Warnings are formatted once parsed, only those reported
+    SectionParserData pd(options, source, out.node);
+    pd.segmentCache = segmentCache;
+    pd.limits = limits;
+    pd.deferWarnings = true;
+    pd.visitor = visitor;
+
     try {
 
-        // Sanity Check
-        if (!CheckSource(source, out.report))
+        // Sanity Check, the previous source data passed it except for the edit
+        size_t checkedLocation = edit ? edit->location : 0;
+        size_t checkedLength = edit ? edit->text.length() : source.length();
+
+        if (!CheckSource(source, checkedLocation, checkedLength, out.report)) {
+
+            markdownAST = mdp::MarkdownNode();
+
+            if (segmentCache)
+                *segmentCache = BlueprintSegmentCache();
+
             return out.report.error.code;
+        }
 
         // Do nothing if blueprint is empty
-        if (source.empty())
+        if (source.empty()) {
+            markdownAST = mdp::MarkdownNode();
             return out.report.error.code;
+        }
 
         // Parse Markdown
-        mdp::MarkdownParser markdownParser;
-        mdp::MarkdownNode markdownAST;
-        markdownParser.parse(source, markdownAST);
+        if (!edit) {
+
+            SNOWCRASH_INSTRUMENT_STAGE("MarkdownParser::parse");
+
+            mdp::MarkdownParser markdownParser;
+            mdp::MarkdownNode ast;
+
+            if (limits.isLimited()) {
+                markdownParser.parse(
+                    source.data(), source.length(), ast, [&limits]() { return limits.isExceeded(); });
+                CheckParseLimits(limits);
+            } else {
+                markdownParser.parse(source.data(), source.length(), ast);
+            }
+
+            markdownAST = std::move(ast);
+        }
+
+        {
+            SNOWCRASH_INSTRUMENT_STAGE("BuildCharacterIndex");
+            mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source.data(), source.length());
+        }
 
-        // Build SectionParserData
-        SectionParserData pd(options, source, out.node);
-        mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+        // The Markdown AST and the character index are freed once parsed
+        if (accountMemory) {
+            releasedMemory = MarkdownNodeMemory(markdownAST) + CharacterIndexMemory(source);
+            memory.charge(releasedMemory);
+            pd.memory = &memory;
+        }
 
         // Parse Blueprint
         BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
@@ -83,5 +431,196 @@ int snowcrash::parse(
         out.report.error = Error("parser exception has occurred", ApplicationError);
     }
 
+    if (limits.warningLimit && out.report.warnings.size() > limits.warningLimit) {
+        out.report.warnings.erase(out.report.warnings.begin() + limits.warningLimit, out.report.warnings.end());
+    }
+
+    if (segmentCache) {
+
+        // Elements of the segments not merged are dropped
+        segmentCache->elements.clear();
+        segmentCache->elementSourceMaps.clear();
+    }
+
+    if (!(options & DeferWarningsOption)) {
+        FormatWarnings(out.report, pd.sourceCharacterIndex);
+
+        // Warnings of the reused segments need not be formatted again
+        for (size_t i = 0; segmentCache && i < segmentCache->segments.size(); ++i) {
+            FormatWarnings(segmentCache->segments[i].report, pd.sourceCharacterIndex);
+        }
+    }
+
+    SNOWCRASH_INSTRUMENT_COUNT(WarningsCounter, out.report.warnings.size());
+
+    if (statistics) {
+        statistics->peakMemory = memory.peak();
+        statistics->finalMemory = memory.current() - releasedMemory + ReportMemory(out.report);
+    }
+
     return out.report.error.code;
 }
+
+void snowcrash::FormatWarnings(Report& report, const mdp::ByteBuffer& source)
+{
+    FormatWarnings(report, source.data(), source.length());
+}
+
+void snowcrash::FormatWarnings(Report& report, const char* source, size_t length)
+{
+    Warnings::const_iterator it = report.warnings.begin();
+
+    while (it != report.warnings.end() && !it->isDeferred()) {
+        ++it;
+    }
+
+    if (it == report.warnings.end())
+        return;
+
+    mdp::ByteBufferCharacterIndex index;
+    mdp::BuildCharacterIndex(index, source, length);
+
+    FormatWarnings(report, index);
+}
+
+int snowcrash::parse(
+    const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+{
+    mdp::MarkdownNode markdownAST;
+    return ParseSource(source, options, markdownAST, NULL, NULL, ParseLimits(), NULL, NULL, out);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    const ParseLimits& limits,
+    ParseStatistics* statistics)
+{
+    mdp::MarkdownNode markdownAST;
+    return ParseSource(source, options, markdownAST, NULL, NULL, limits, statistics, NULL, out);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    BlueprintVisitor& visitor,
+    const ParseLimits& limits,
+    ParseStatistics* statistics)
+{
+    mdp::MarkdownNode markdownAST;
+    return ParseSource(source, options, markdownAST, NULL, NULL, limits, statistics, &visitor, out);
+}
+
+int snowcrash::parse(const char* source,
+    size_t length,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    const ParseLimits& limits,
+    ParseStatistics* statistics)
+{
+    mdp::MarkdownNode markdownAST;
+    StringView sourceView = source ? StringView(source, length) : StringView();
+
+    return ParseSource(sourceView, options, markdownAST, NULL, NULL, limits, statistics, NULL, out);
+}
+
+int snowcrash::parseFile(const std::string& path,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    const ParseLimits& limits,
+    ParseStatistics* statistics)
+{
+    MappedFile file(path);
+
+    if (!file.isOpen()) {
+        out.report.error = Error("unable to open file '" + path + "': " + file.error(), ApplicationError);
+        return out.report.error.code;
+    }
+
+    // The file is unmapped once parsed, the warnings cannot be formatted later
+    return parse(file.data(), file.length(), options & ~DeferWarningsOption, out, limits, statistics);
+}
+
+int snowcrash::parseBatch(const std::vector<mdp::ByteBuffer>& sources,
+    BlueprintParserOptions options,
+    ParseResults& out,
+    size_t threadCount)
+{
+    out.clear();
+    out.resize(sources.size());
+
+    if (threadCount == 0)
+        threadCount = DefaultWorkerCount();
+
+    // Documents are parsed in parallel instead of their groups
+    if (threadCount > 1 && sources.size() > 1)
+        options &= ~ParallelParsingOption;
+
+    // Parsing shares no mutable state, every task writes its own result only
+    RunTasks(sources.size(), threadCount, [&](size_t i) {
+        ParseResultRef<Blueprint> result(out[i]);
+        parse(sources[i], options, result);
+    });
+
+    for (ParseResults::const_iterator it = out.begin(); it != out.end(); ++it) {
+
+        if (it->report.error.code != Error::OK)
+            return it->report.error.code;
+    }
+
+    return Error::OK;
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    ParseState& state)
+{
+    state.options = options;
+    state.source = source;
+    state.segmentCache = BlueprintSegmentCache();
+
+    return ParseSource(
+        state.source, options, state.markdownAST, NULL, &state.segmentCache, ParseLimits(), NULL, NULL, out);
+}
+
+int snowcrash::reparse(const SourceEdit& edit, ParseState& state, const ParseResultRef<Blueprint>& out)
+{
+    if (edit.location > state.source.length() || edit.length > state.source.length() - edit.location) {
+        out.report.error = Error("edit is out of the source data", ApplicationError);
+        return out.report.error.code;
+    }
+
+    // Characters are counted as in `mdp::ByteBufferCharacterIndex`
+    std::ptrdiff_t characterOffset = mdp::CountUTF8Characters(edit.text.data(), edit.text.length())
+        - mdp::CountUTF8Characters(state.source.data() + edit.location, edit.length);
+
+    TakeOverElements(state, out);
+
+    state.source.replace(edit.location, edit.length, edit.text);
+
+    bool markdownParsed = false;
+
+    try {
+        markdownParsed = ReparseMarkdown(edit, state);
+    } catch (...) {
+        // Parsed from scratch
+    }
+
+    // Cached segments refer to nodes of the AST, they cannot outlive it
+    if (markdownParsed) {
+        ShiftSegmentCache(edit, characterOffset, state);
+    } else {
+        state.segmentCache = BlueprintSegmentCache();
+    }
+
+    return ParseSource(state.source,
+        state.options,
+        state.markdownAST,
+        markdownParsed ? &edit : NULL,
+        &state.segmentCache,
+        ParseLimits(),
+        NULL,
+        NULL,
+        out);
+}
@@ -9,9 +9,12 @@
 #ifndef SNOWCRASH_H
 #define SNOWCRASH_H
 
+#include <vector>
 #include "BlueprintSourcemap.h"
+#include "BlueprintVisitor.h"
 #include "SourceAnnotation.h"
 #include "SectionParser.h"
+#include "BlueprintSegmentCache.h"
 
 /**
  *  API Blueprint Parser Interface
@@ -32,12 +35,220 @@ namespace snowcrash
     /**
      *  \brief Parse the source data into a blueprint abstract source tree (AST).
      *
+     *  With `ValidateOnlyOption` the report is the same as of a full parse,
+     *  the AST and its source map are incomplete and should not be used.
+     *
      *  \param source       A textual source data to be parsed.
      *  \param options      Parser options. Use 0 for no additional options.
      *  \param out          Output buffer to store parsing result into.
      *  \return Error status code. Zero represents success, non-zero a failure.
      */
     int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Parse the source data within limits, e.g. a deadline.
+     *
+     *  Parses as `parse()` unless the parse is cancelled, exceeds its
+     *  deadline or its memory budget. The parse is then aborted with
+     *  `CancelledError` or `MemoryBudgetError`, the report keeps the
+     *  warnings found so far and the AST is incomplete.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param limits       Deadline, cancellation token and memory budget of the parse.
+     *  \param statistics   Memory used by the parse to be filled in, NULL if not needed.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        const ParseLimits& limits,
+        ParseStatistics* statistics = NULL);
+
+    /**
+     *  \brief Parse the source data, delivering the parsed groups to a visitor.
+     *
+     *  Reports the same as `parse()`. Instead of keeping the whole AST in
+     *  memory, every top-level group is delivered to the visitor once it is
+     *  parsed and then dropped, see `BlueprintVisitor`. The AST keeps the
+     *  metadata, the API name and description and the groups, without their
+     *  content. With `ParallelParsingOption` the groups are delivered only
+     *  once all of them are parsed.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param visitor      Visitor of the parsed groups.
+     *  \param limits       Deadline, cancellation token and memory budget of the parse.
+     *  \param statistics   Memory used by the parse to be filled in, NULL if not needed.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        BlueprintVisitor& visitor,
+        const ParseLimits& limits = ParseLimits(),
+        ParseStatistics* statistics = NULL);
+
+    /**
+     *  \brief Parse source data in place, e.g. a memory-mapped file.
+     *
+     *  Parses as `parse()` without copying the source data into a byte
+     *  buffer. The data need not be NUL terminated, they have to be kept
+     *  only for the parse and for `FormatWarnings()` of deferred warnings.
+     *
+     *  \param source       Source data to be parsed, NULL if there are none.
+     *  \param length       Number of bytes of the source data.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param limits       Deadline, cancellation token and memory budget of the parse.
+     *  \param statistics   Memory used by the parse to be filled in, NULL if not needed.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const char* source,
+        size_t length,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        const ParseLimits& limits = ParseLimits(),
+        ParseStatistics* statistics = NULL);
+
+    /**
+     *  \brief Parse a file, mapping it into memory instead of reading it.
+     *
+     *  Parses as `parse()` the content of the file, which is mapped only
+     *  for the parse. The warnings are therefore always formatted, even
+     *  with `DeferWarningsOption`. A file that cannot be mapped is
+     *  reported as `ApplicationError`.
+     *
+     *  \param path         Path of the file to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param limits       Deadline, cancellation token and memory budget of the parse.
+     *  \param statistics   Memory used by the parse to be filled in, NULL if not needed.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parseFile(const std::string& path,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        const ParseLimits& limits = ParseLimits(),
+        ParseStatistics* statistics = NULL);
+
+    /**
+     *  \brief Format the deferred warnings of a report.
+     *
+     *  A parse with `DeferWarningsOption` keeps the warnings as they were
+     *  found: code, message format, arguments and location in bytes. Their
+     *  messages and locations in characters are formatted here, on demand.
+     *  Formatted warnings are left untouched.
+     *
+     *  \param report       Report of a parse of the source data.
+     *  \param source       Source data parsed.
+     */
+    void FormatWarnings(Report& report, const mdp::ByteBuffer& source);
+    void FormatWarnings(Report& report, const char* source, size_t length);
+
+    /** Collection of parse results, e.g. of a batch */
+    typedef std::vector<ParseResult<Blueprint> > ParseResults;
+
+    /**
+     *  \brief Parse a batch of source data concurrently.
+     *
+     *  Every source data is parsed exactly as by `parse()`, the documents
+     *  are distributed among a pool of threads. With more than one thread
+     *  `ParallelParsingOption` is ignored, documents are parsed in parallel
+     *  instead of their groups.
+     *
+     *  \param sources      Source data to be parsed.
+     *  \param options      Parser options for every source data. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing results into, in the order of the source data.
+     *  \param threadCount  Maximum number of threads parsing, 0 for one per hardware thread.
+     *  \return Error status code of the first source data failing, zero if all of them succeed.
+     */
+    int parseBatch(const std::vector<mdp::ByteBuffer>& sources,
+        BlueprintParserOptions options,
+        ParseResults& out,
+        size_t threadCount = 0);
+
+    /**
+     *  \brief Edit of the source data
+     *
+     *  Replaces `length` bytes at byte offset `location` with `text`.
+     */
+    struct SourceEdit {
+
+        SourceEdit(size_t location_ = 0, size_t length_ = 0, const mdp::ByteBuffer& text_ = mdp::ByteBuffer())
+            : location(location_), length(length_), text(text_)
+        {
+        }
+
+        /** Byte offset of the edit */
+        size_t location;
+
+        /** Number of bytes replaced */
+        size_t length;
+
+        /** Replacement text */
+        mdp::ByteBuffer text;
+    };
+
+    /**
+     *  \brief State of a parser kept between parses of an edited source data
+     *
+     *  Filled in by `parse()`, updated by every `reparse()`. Holds the source
+     *  data, its Markdown AST and what the parsed top-level groups define and
+     *  refer to. The groups themselves are kept in the result of the parse.
+     */
+    struct ParseState {
+
+        ParseState() : options(0) {}
+
+        /** Parser options */
+        BlueprintParserOptions options;
+
+        /** Source data as of the last parse */
+        mdp::ByteBuffer source;
+
+        /** Markdown AST of the source data */
+        mdp::MarkdownNode markdownAST;
+
+        /** Parsed top-level groups */
+        BlueprintSegmentCache segmentCache;
+    };
+
+    /**
+     *  \brief Parse the source data, keeping the state of the parser for `reparse()`.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param state        State of the parser to be filled in.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        ParseState& state);
+
+    /**
+     *  \brief Parse the source data of a previous parse after an edit.
+     *
+     *  Gives the same result as parsing the edited source data from scratch
+     *  with the options of the previous parse. Markdown is parsed again only
+     *  around the edit and top-level groups not touched by the edit are
+     *  reused as long as their named types and models are not affected.
+     *
+     *  The groups are reused from \a out, which is expected to hold the
+     *  result of the previous parse. They are moved, not copied, so that an
+     *  edit costs about the same no matter the size of the source data. Any
+     *  other result is replaced, all the groups are parsed again then.
+     *
+     *  \param edit         Edit of the source data of the previous parse.
+     *  \param state        State of the parser from `parse()` or `reparse()`, updated.
+     *  \param out          Result of the previous parse, replaced with the parsing result.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int reparse(const SourceEdit& edit, ParseState& state, const ParseResultRef<Blueprint>& out);
 }
 
 #endif
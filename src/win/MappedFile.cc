@@ -0,0 +1,77 @@
+//
+//  MappedFile.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <sstream>
+#include "../MappedFile.h"
+
+using namespace snowcrash;
+
+/** \return Message of the last Windows error */
+static std::string LastErrorMessage()
+{
+    std::stringstream ss;
+    ss << "error " << ::GetLastError();
+    return ss.str();
+}
+
+MappedFile::MappedFile(const std::string& path) : m_data(""), m_length(0), m_open(false)
+{
+    HANDLE file = ::CreateFileA(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file == INVALID_HANDLE_VALUE) {
+        m_error = LastErrorMessage();
+        return;
+    }
+
+    LARGE_INTEGER size;
+
+    if (!::GetFileSizeEx(file, &size)) {
+        m_error = LastErrorMessage();
+        ::CloseHandle(file);
+        return;
+    }
+
+    // Zero bytes cannot be mapped, an empty file has no data
+    if (size.QuadPart > 0) {
+
+        HANDLE mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        if (!mapping) {
+            m_error = LastErrorMessage();
+            ::CloseHandle(file);
+            return;
+        }
+
+        void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (!data) {
+            m_error = LastErrorMessage();
+            ::CloseHandle(mapping);
+            ::CloseHandle(file);
+            return;
+        }
+
+        // The view stays valid once the mapping and the file are closed
+        ::CloseHandle(mapping);
+
+        m_data = static_cast<const char*>(data);
+        m_length = static_cast<size_t>(size.QuadPart);
+    }
+
+    ::CloseHandle(file);
+    m_open = true;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_length)
+        ::UnmapViewOfFile(m_data);
+}
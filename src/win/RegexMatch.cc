@@ -8,7 +8,11 @@
 
 #include <regex>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include "../RegexMatch.h"
+#include "../Instrumentation.h"
 
 using namespace std;
 
@@ -19,14 +23,79 @@ using namespace std::tr1;
 // A C++09 implementation
 //
 
+namespace
+{
+    typedef shared_ptr<regex> CompiledRegexRef;
+    typedef unordered_map<string, CompiledRegexRef> CompiledRegexMap;
+
+    //
+    // Process-wide cache of compiled expressions
+    // An expression that failed to compile is cached as null
+    //
+    class RegexCache
+    {
+    public:
+        CompiledRegexRef get(const string& expression)
+        {
+            lock_guard<mutex> lock(m_mutex);
+
+            CompiledRegexMap::const_iterator it = m_map.find(expression);
+
+            if (it != m_map.end()) {
+                ++m_statistics.hits;
+                return it->second;
+            }
+
+            ++m_statistics.misses;
+
+            CompiledRegexRef pattern;
+
+            try {
+                pattern = make_shared<regex>(expression, regex_constants::extended);
+            } catch (const regex_error&) {
+            }
+
+            m_map.insert(make_pair(expression, pattern));
+            return pattern;
+        }
+
+        snowcrash::RegexCacheStatistics statistics()
+        {
+            lock_guard<mutex> lock(m_mutex);
+
+            snowcrash::RegexCacheStatistics result = m_statistics;
+            result.size = m_map.size();
+
+            return result;
+        }
+
+        void clear()
+        {
+            lock_guard<mutex> lock(m_mutex);
+
+            m_map.clear();
+            m_statistics = snowcrash::RegexCacheStatistics();
+        }
+
+    private:
+        mutex m_mutex;
+        CompiledRegexMap m_map;
+        snowcrash::RegexCacheStatistics m_statistics;
+    };
+
+    RegexCache regexCache;
+}
+
 bool snowcrash::RegexMatch(const string& target, const string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
+    SNOWCRASH_INSTRUMENT_COUNT(RegexEvaluationsCounter, 1);
+
     try {
-        regex pattern(expression, regex_constants::extended);
-        return regex_search(target, pattern);
+        CompiledRegexRef pattern = regexCache.get(expression);
+        return pattern && regex_search(target, *pattern);
     } catch (const regex_error&) {
     } catch (...) {
     }
@@ -49,13 +118,18 @@ bool snowcrash::RegexCapture(
     if (target.empty() || expression.empty())
         return false;
 
+    SNOWCRASH_INSTRUMENT_COUNT(RegexEvaluationsCounter, 1);
+
     captureGroups.clear();
 
     try {
 
-        regex pattern(expression, regex_constants::extended);
+        CompiledRegexRef pattern = regexCache.get(expression);
+        if (!pattern)
+            return false;
+
         match_results<string::const_iterator> result;
-        if (!regex_search(target, result, pattern))
+        if (!regex_search(target, result, *pattern))
             return false;
 
         for (match_results<string::const_iterator>::const_iterator it = result.begin(); it != result.end(); ++it) {
@@ -70,3 +144,13 @@ bool snowcrash::RegexCapture(
 
     return false;
 }
+
+snowcrash::RegexCacheStatistics snowcrash::GetRegexCacheStatistics()
+{
+    return regexCache.statistics();
+}
+
+void snowcrash::ClearRegexCache()
+{
+    regexCache.clear();
+}
@@ -0,0 +1,244 @@
+//
+//  BlueprintGenerator.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTGENERATOR_H
+#define SNOWCRASH_BLUEPRINTGENERATOR_H
+
+#include <sstream>
+#include <string>
+
+namespace snowcrash
+{
+
+    /** Shape of a generated blueprint */
+    struct BlueprintShape {
+        size_t groups;             /// < Resource groups
+        size_t resourcesPerGroup;  /// < Resources in every group
+        size_t actionsPerResource; /// < Actions of every resource, at most five
+        size_t payloadsPerAction;  /// < Request and response pairs of every action
+        size_t bodySize;           /// < Approximate size of every JSON body in bytes
+        size_t namedTypes;         /// < MSON named types in every group
+        size_t inheritanceDepth;   /// < Length of the chains of named types inheriting from each other
+        size_t mixinsPerType;      /// < Named types included in every named type
+        bool modelReferences;      /// < Resources have a model referenced by their actions
+        unsigned int seed;         /// < Seed of the pseudo-random choices
+
+        BlueprintShape()
+        : groups(10)
+        , resourcesPerGroup(10)
+        , actionsPerResource(2)
+        , payloadsPerAction(1)
+        , bodySize(256)
+        , namedTypes(10)
+        , inheritanceDepth(3)
+        , mixinsPerType(1)
+        , modelReferences(true)
+        , seed(1)
+        {
+        }
+
+        /** \return Shape with the number of groups scaled by the factor */
+        BlueprintShape scaled(size_t factor) const
+        {
+            BlueprintShape shape = *this;
+            shape.groups *= factor;
+            return shape;
+        }
+    };
+
+    /**
+     *  \brief  Deterministic generator of API Blueprints
+     *
+     *  The same shape always generates the same blueprint. The blueprint
+     *  has no errors, named types refer to the preceding ones only so
+     *  there are no circular references.
+     */
+    class BlueprintGenerator
+    {
+    public:
+        explicit BlueprintGenerator(const BlueprintShape& shape) : m_shape(shape), m_state(shape.seed ? shape.seed : 1)
+        {
+        }
+
+        /** \return Generated blueprint */
+        std::string generate()
+        {
+            std::stringstream ss;
+            ss << "FORMAT: 1A\n\n# Generated API\n\nAPI of " << m_shape.groups << " groups generated with seed "
+               << m_shape.seed << ".\n\n";
+
+            for (size_t group = 0; group < m_shape.groups; ++group) {
+                writeGroup(ss, group);
+                writeDataStructures(ss, group);
+            }
+
+            return ss.str();
+        }
+
+    private:
+        BlueprintShape m_shape;
+        unsigned int m_state;
+
+        /** \return Next pseudo-random number less than \a bound */
+        size_t next(size_t bound)
+        {
+            // xorshift32, the same on every platform
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 17;
+            m_state ^= m_state << 5;
+
+            return bound ? m_state % bound : 0;
+        }
+
+        /** \return Name of a named type of a group */
+        static std::string typeName(size_t group, size_t index)
+        {
+            std::stringstream ss;
+            ss << "Type " << group << " " << index;
+            return ss.str();
+        }
+
+        /** \return Name of a resource of a group */
+        static std::string resourceName(size_t group, size_t index)
+        {
+            std::stringstream ss;
+            ss << "Resource " << group << "-" << index;
+            return ss.str();
+        }
+
+        /** Write a JSON object of approximately `bodySize` bytes indented for a payload */
+        void writeBody(std::stringstream& ss, const std::string& indent, size_t id)
+        {
+            ss << indent << "{\n" << indent << "    \"id\": " << id;
+
+            size_t size = 0;
+
+            for (size_t field = 0; size < m_shape.bodySize; ++field) {
+
+                std::stringstream line;
+                line << ",\n" << indent << "    \"field" << field << "\": ";
+
+                switch (next(3)) {
+                    case 0:
+                        line << next(100000);
+                        break;
+
+                    case 1:
+                        line << "\"value " << next(100000) << " of the field\"";
+                        break;
+
+                    default:
+                        line << "[" << next(10) << ", " << next(10) << ", " << next(10) << "]";
+                        break;
+                }
+
+                size += line.str().length();
+                ss << line.str();
+            }
+
+            ss << "\n" << indent << "}\n\n";
+        }
+
+        void writeGroup(std::stringstream& ss, size_t group)
+        {
+            static const char* const Methods[] = { "GET", "POST", "PUT", "PATCH", "DELETE" };
+
+            ss << "# Group Group " << group << "\n\nDescription of the *group* " << group << ".\n\n";
+
+            for (size_t resource = 0; resource < m_shape.resourcesPerGroup; ++resource) {
+
+                size_t id = group * m_shape.resourcesPerGroup + resource;
+
+                ss << "## " << resourceName(group, resource) << " [/groups/" << group << "/resources/" << resource
+                   << "/{id}{?limit,offset}]\n\n"
+                   << "Description of the resource " << id << ".\n\n"
+                   << "+ Parameters\n"
+                   << "    + id: `" << id << "` (number, required) - Identifier\n"
+                   << "    + limit: `10` (number, optional) - Limit\n"
+                   << "    + offset (number, optional) - Offset\n\n";
+
+                if (m_shape.namedTypes) {
+                    ss << "+ Attributes (" << typeName(group, next(m_shape.namedTypes)) << ")\n"
+                       << "    + name: resource " << id << " (string, required)\n\n";
+                }
+
+                if (m_shape.modelReferences) {
+                    ss << "+ Model (application/json)\n\n";
+                    writeBody(ss, "        ", id);
+                }
+
+                size_t actions = m_shape.actionsPerResource < 5 ? m_shape.actionsPerResource : 5;
+
+                for (size_t action = 0; action < actions; ++action) {
+
+                    ss << "### Action " << action << " [" << Methods[action] << "]\n\n";
+
+                    for (size_t payload = 0; payload < m_shape.payloadsPerAction; ++payload) {
+
+                        // Request without a body distinguishes the responses of a GET
+                        if (action > 0) {
+                            ss << "+ Request " << payload << " (application/json)\n\n";
+                            writeBody(ss, "        ", id);
+                        } else if (payload > 0) {
+                            ss << "+ Request " << payload << "\n\n    + Headers\n\n            Accept: application/json\n\n";
+                        }
+
+                        if (m_shape.modelReferences && next(2) == 0) {
+                            ss << "+ Response 200\n\n    [" << resourceName(group, resource) << "][]\n\n";
+                        } else {
+                            ss << "+ Response 200 (application/json)\n\n"
+                               << "    + Headers\n\n"
+                               << "            ETag: \"" << id << "-" << action << "\"\n\n"
+                               << "    + Body\n\n";
+                            writeBody(ss, "            ", id);
+                        }
+                    }
+                }
+            }
+        }
+
+        void writeDataStructures(std::stringstream& ss, size_t group)
+        {
+            if (!m_shape.namedTypes)
+                return;
+
+            ss << "# Data Structures\n\n";
+
+            for (size_t type = 0; type < m_shape.namedTypes; ++type) {
+
+                size_t depth = m_shape.inheritanceDepth ? type % m_shape.inheritanceDepth : 0;
+
+                // Inherit from the preceding type of the chain
+                if (depth > 0)
+                    ss << "## " << typeName(group, type) << " (" << typeName(group, type - 1) << ")\n\n";
+                else
+                    ss << "## " << typeName(group, type) << " (object)\n\n";
+
+                ss << "+ id" << type << ": " << type << " (number, required)\n"
+                   << "+ tags (array[string])\n";
+
+                for (size_t mixin = 0; type > 0 && mixin < m_shape.mixinsPerType; ++mixin)
+                    ss << "+ Include " << typeName(group, next(type)) << "\n";
+
+                if (type > 0)
+                    ss << "+ related (" << typeName(group, next(type)) << ", optional)\n";
+
+                ss << "\n";
+            }
+        }
+    };
+
+    /** \return Blueprint of the shape */
+    inline std::string GenerateBlueprint(const BlueprintShape& shape)
+    {
+        BlueprintGenerator generator(shape);
+        return generator.generate();
+    }
+}
+
+#endif
@@ -0,0 +1,93 @@
+//
+//  PerfUtility.h
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PERFUTILITY_H
+#define SNOWCRASH_PERFUTILITY_H
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "snowcrash.h"
+
+//
+//  The header replaces the global operator new and operator delete to count
+//  the allocations of the binary. It has to be included in exactly one
+//  translation unit of a performance test binary.
+//
+
+namespace snowcrashperf
+{
+
+    /** Number of allocations made so far */
+    static std::atomic<size_t> allocations(0);
+
+    /** Number of bytes allocated so far */
+    static std::atomic<size_t> allocatedBytes(0);
+
+    /** \return Number of allocations made by a function */
+    template <typename F>
+    inline size_t CountAllocations(F f)
+    {
+        size_t before = allocations;
+        f();
+        return allocations - before;
+    }
+
+    /** \return True if both reports have the same error and warnings */
+    inline bool isSameReport(const snowcrash::Report& lhs, const snowcrash::Report& rhs)
+    {
+        if (lhs.error.code != rhs.error.code || lhs.error.message != rhs.error.message
+            || lhs.warnings.size() != rhs.warnings.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < lhs.warnings.size(); ++i) {
+
+            const snowcrash::Warning& warning = lhs.warnings[i];
+            const snowcrash::Warning& other = rhs.warnings[i];
+
+            if (warning.code != other.code || warning.message != other.message
+                || warning.location.size() != other.location.size()) {
+                return false;
+            }
+
+            for (size_t j = 0; j < warning.location.size(); ++j) {
+
+                if (warning.location[j].location != other.location[j].location
+                    || warning.location[j].length != other.location[j].length) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    ++snowcrashperf::allocations;
+    snowcrashperf::allocatedBytes += size;
+
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#endif
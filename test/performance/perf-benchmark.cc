@@ -0,0 +1,966 @@
+//
+//  perf-benchmark.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+#include "snowcrash.h"
+#include "PerfUtility.h"
+#include "BlueprintGenerator.h"
+#include "ActionParser.h"
+#include "MappedFile.h"
+#include "MarkdownParser.h"
+#include "ParseCache.h"
+#include "RegexMatch.h"
+#include "Serialization.h"
+#include "SignatureSectionProcessor.h"
+#include "StringUtility.h"
+#include "UriTemplateParser.h"
+
+typedef std::chrono::steady_clock Clock;
+
+/** Wall time spent warming up every benchmark */
+static const double WarmupTime = 0.05;
+
+/** Wall time spent sampling every benchmark, at least `MinSampleCount` samples are taken */
+static const double SampleTime = 0.5;
+static const size_t MinSampleCount = 10;
+static const size_t MaxSampleCount = 10000;
+
+/** Minimal wall time of a sample, short calls are repeated within a sample */
+static const double MinSampleDuration = 0.00005;
+
+/** Factors of the default `BlueprintShape` the generated fixtures are scaled by */
+static const size_t ScalingFactors[] = { 1, 2, 4, 8 };
+
+/** Growth of the time per byte between the smallest and the largest generated fixture considered super-linear */
+static const double SuperLinearGrowth = 2.0;
+
+/** Numbers of named types of the MSON fixtures, and members of every named type */
+static const size_t NamedTypeCounts[] = { 500, 1000, 2000 };
+static const size_t NamedTypeMemberCount = 8;
+
+/** Share of the growth of the source size the time of a one-edit reparse may grow by */
+static const double ReparseGrowthLimit = 0.5;
+
+/** Options of the parses compared with loading them from the cache, cached results usually include source maps */
+static const snowcrash::BlueprintParserOptions CacheOptions = snowcrash::ExportSourcemapOption;
+
+/** Result of a benchmark, times are of a single call in microseconds */
+struct BenchmarkResult {
+    std::string name;
+    size_t calls;
+    double mean;
+    double p50;
+    double p99;
+    double throughput; // MB/s at the median, 0 if the benchmark processes no bytes
+    double allocations;
+    double allocatedBytes;
+    size_t peakMemory; // peak resident set size of the process in KB after the benchmark, if measured
+
+    BenchmarkResult()
+        : calls(0), mean(0), p50(0), p99(0), throughput(0), allocations(0), allocatedBytes(0), peakMemory(0)
+    {
+    }
+};
+
+typedef std::vector<BenchmarkResult> BenchmarkResults;
+
+static double seconds(const Clock::duration& duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+/** \return Value at the percentile of sorted samples */
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ *  \brief  Run a benchmark
+ *
+ *  The function is warmed up first, then repeated in batches long enough
+ *  to be timed. A sample is the mean time of a call within a batch.
+ *
+ *  \param  name    Name of the benchmark
+ *  \param  bytes   Bytes processed by a call, 0 if not applicable
+ *  \param  f       Function to benchmark
+ */
+static BenchmarkResult benchmark(const std::string& name, size_t bytes, const std::function<void()>& f)
+{
+    // Warm up and calibrate the batch size
+    size_t batch = 1;
+    size_t warmupCalls = 0;
+    Clock::time_point warmupStart = Clock::now();
+
+    while (seconds(Clock::now() - warmupStart) < WarmupTime) {
+
+        Clock::time_point start = Clock::now();
+
+        for (size_t i = 0; i < batch; ++i)
+            f();
+
+        warmupCalls += batch;
+
+        if (seconds(Clock::now() - start) < MinSampleDuration)
+            batch *= 2;
+    }
+
+    std::vector<double> samples;
+    size_t allocationsBefore = snowcrashperf::allocations;
+    size_t allocatedBytesBefore = snowcrashperf::allocatedBytes;
+    Clock::time_point sampleStart = Clock::now();
+
+    while (samples.size() < MaxSampleCount
+        && (samples.size() < MinSampleCount || seconds(Clock::now() - sampleStart) < SampleTime)) {
+
+        Clock::time_point start = Clock::now();
+
+        for (size_t i = 0; i < batch; ++i)
+            f();
+
+        samples.push_back(seconds(Clock::now() - start) * 1000000.0 / batch);
+    }
+
+    BenchmarkResult result;
+    result.name = name;
+    result.calls = samples.size() * batch;
+    result.allocations = static_cast<double>(snowcrashperf::allocations - allocationsBefore) / result.calls;
+    result.allocatedBytes = static_cast<double>(snowcrashperf::allocatedBytes - allocatedBytesBefore) / result.calls;
+
+    double sum = 0;
+
+    for (std::vector<double>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+        sum += *it;
+
+    result.mean = sum / samples.size();
+
+    std::sort(samples.begin(), samples.end());
+    result.p50 = percentile(samples, 0.5);
+    result.p99 = percentile(samples, 0.99);
+
+    if (bytes && result.p50 > 0)
+        result.throughput = bytes / result.p50; // bytes per microsecond is MB/s
+
+    std::cout << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(3)
+              << " p50 " << std::setw(12) << result.p50 << "us  p99 " << std::setw(12) << result.p99 << "us  "
+              << std::setprecision(1) << std::setw(8) << result.throughput << " MB/s  " << std::setw(10)
+              << result.allocations << " allocs\n";
+
+    return result;
+}
+
+/** \return Peak resident set size of the process in KB */
+static size_t peakMemory()
+{
+#if defined(_MSC_VER)
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+
+#if defined(__APPLE__)
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/** \return Content of the file, empty if it cannot be read */
+static std::string readFile(const std::string& name)
+{
+    std::ifstream stream(name.c_str(), std::ios::binary);
+    std::stringstream content;
+    content << stream.rdbuf();
+
+    return content.str();
+}
+
+/** Substring of the names of the benchmarks to run, empty to run all */
+static std::string filter;
+
+/** Run the benchmark if its name matches the filter */
+static void run(BenchmarkResults& results, const std::string& name, size_t bytes, const std::function<void()>& f)
+{
+    if (name.find(filter) != std::string::npos)
+        results.push_back(benchmark(name, bytes, f));
+}
+
+static void runMicrobenchmarks(BenchmarkResults& results, const std::string& source)
+{
+    using namespace snowcrash;
+
+    std::string header = "Retrieve a Note [GET /notes/{id}{?limit}]";
+
+    run(results, "RegexMatch", header.length(), [&]() {
+        static_cast<void>(RegexMatch(header, NamedActionHeaderRegex));
+    });
+
+    std::string paragraph = "+ Response 200 (application/json)\n\n    + Headers\n\n            ETag: 42\n";
+
+    run(results, "GetFirstLine", paragraph.length(), [&]() {
+        std::string remaining;
+        static_cast<void>(GetFirstLine(paragraph, remaining));
+    });
+
+    run(results, "GetFirstLineView", paragraph.length(), [&]() {
+        StringView remaining;
+        static_cast<void>(GetFirstLineView(paragraph, remaining));
+    });
+
+    std::string padded = "  \t  Description of the resource with some whitespace around it \n\n  ";
+
+    run(results, "TrimString", padded.length(), [&]() {
+        std::string trimmed = padded;
+        TrimString(trimmed);
+    });
+
+    // Signatures of MSON members and parameters as written in blueprints
+    static const char* const Signatures[]
+        = { "id: 42 (number, required) - Identifier of the note",
+            "title: `My *first* note` (string, required) - Title of the note",
+            "tags: home, `work`, urgent (array[string], fixed-type) - Tags of the note",
+            "*site_admin*: true (boolean) - Whether the user is an administrator",
+            "author (Person, optional)\n\nAuthor of the note, if known",
+            "limit: `10` (number, optional) - Maximum number of notes returned, at most `100`" };
+
+    mdp::MarkdownNode signatureRoot;
+    size_t signatureBytes = 0;
+
+    for (size_t i = 0; i < sizeof(Signatures) / sizeof(Signatures[0]); ++i) {
+        signatureRoot.children().push_back(
+            mdp::MarkdownNode(mdp::ParagraphMarkdownNodeType, &signatureRoot, Signatures[i]));
+        signatureBytes += signatureRoot.children().back().text.length();
+    }
+
+    Blueprint signatureBlueprint;
+    SectionParserData signatureData(0, source, signatureBlueprint);
+    scpl::SignatureTraits signatureTraits(scpl::SignatureTraits::IdentifierTrait | scpl::SignatureTraits::ValuesTrait
+        | scpl::SignatureTraits::AttributesTrait | scpl::SignatureTraits::ContentTrait);
+
+    run(results, "parseSignature", signatureBytes, [&]() {
+        for (mdp::MarkdownNodeIterator it = signatureRoot.children().begin(); it != signatureRoot.children().end();
+             ++it) {
+            Report report;
+            static_cast<void>(scpl::SignatureSectionProcessorBase<mson::ValueMember>::parseSignature(
+                it, signatureData, signatureTraits, report));
+        }
+    });
+
+    run(results, "BuildCharacterIndex", source.length(), [&]() {
+        mdp::ByteBufferCharacterIndex index;
+        mdp::BuildCharacterIndex(index, source);
+        index.build();
+    });
+
+    mdp::BytesRangeSet rangeSet;
+
+    for (size_t location = 0; location + 64 < source.length(); location += source.length() / 64)
+        rangeSet.push_back(mdp::BytesRange(location, 64));
+
+    mdp::ByteBufferCharacterIndex index;
+    mdp::BuildCharacterIndex(index, source);
+    index.build();
+
+    run(results, "BytesRangeSetToCharactersRangeSet", 0, [&]() {
+        static_cast<void>(mdp::BytesRangeSetToCharactersRangeSet(rangeSet, index));
+    });
+
+    URITemplate uri = "https://api.example.com/resources/{id}/items{?limit,offset,sort}";
+    mdp::CharactersRangeSet sourceBlock;
+
+    run(results, "URITemplateParser::parse", uri.length(), [&]() {
+        ParsedURITemplate parsed;
+        URITemplateParser::parse(uri, sourceBlock, parsed);
+    });
+
+    run(results, "MarkdownParser::parse", source.length(), [&]() {
+        mdp::MarkdownParser parser;
+        mdp::MarkdownNode ast;
+        parser.parse(source, ast);
+    });
+}
+
+static void runParseBenchmark(BenchmarkResults& results, const std::string& name, const std::string& source)
+{
+    run(results, "parse " + name, source.length(), [&]() {
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+        snowcrash::parse(source, 0, blueprint);
+    });
+}
+
+/** Result index and source size of the benchmarks parsing a fixture in growing sizes */
+typedef std::vector<std::pair<size_t, size_t> > Scaling;
+
+/**
+ *  \brief  Report the time per byte of the growing fixtures
+ *  \return False if the time or the allocations per byte grow super-linearly with the size
+ */
+static bool checkScaling(const BenchmarkResults& results, const Scaling& scaling)
+{
+    if (scaling.size() < 2)
+        return true;
+
+    std::cout << "\nscaling:\n";
+
+    for (size_t i = 0; i < scaling.size(); ++i) {
+
+        const BenchmarkResult& result = results[scaling[i].first];
+
+        std::cout << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << (scaling[i].second / 1024.0) << " KB " << std::setprecision(3) << std::setw(10)
+                  << (result.p50 / scaling[i].second * 1024.0) << "us/KB " << std::setw(10)
+                  << result.peakMemory / 1024 << " MB peak\n";
+    }
+
+    const BenchmarkResult& smallest = results[scaling.front().first];
+    const BenchmarkResult& largest = results[scaling.back().first];
+    double growth = (largest.p50 / scaling.back().second) / (smallest.p50 / scaling.front().second);
+    double allocationGrowth
+        = (largest.allocations / scaling.back().second) / (smallest.allocations / scaling.front().second);
+    bool linear = true;
+
+    if (growth > SuperLinearGrowth) {
+        std::cout << "time per byte grew " << std::setprecision(2) << growth << "x, parsing scales super-linearly\n";
+        linear = false;
+    }
+
+    if (allocationGrowth > SuperLinearGrowth) {
+        std::cout << "allocations per byte grew " << std::setprecision(2) << allocationGrowth
+                  << "x, parsing allocates super-linearly\n";
+        linear = false;
+    }
+
+    return linear;
+}
+
+/** Parse a fixture of a scaling series, recording its result index and size */
+static void runScalingBenchmark(
+    BenchmarkResults& results, Scaling& scaling, const std::string& name, const std::string& source)
+{
+    size_t count = results.size();
+
+    runParseBenchmark(results, name, source);
+
+    if (results.size() > count) {
+        results.back().peakMemory = peakMemory();
+        scaling.push_back(std::make_pair(results.size() - 1, source.length()));
+    }
+}
+
+/**
+ *  \brief  Parse blueprints generated in growing sizes
+ *
+ *  Peak memory only grows, so the sizes are parsed from the smallest.
+ *
+ *  \return False if the time per byte grows super-linearly with the size
+ */
+static bool runScalingBenchmarks(BenchmarkResults& results)
+{
+    snowcrash::BlueprintShape shape;
+    Scaling scaling;
+
+    for (size_t i = 0; i < sizeof(ScalingFactors) / sizeof(ScalingFactors[0]); ++i) {
+
+        std::stringstream name;
+        name << "generated-" << ScalingFactors[i] << "x";
+
+        std::string source = snowcrash::GenerateBlueprint(shape.scaled(ScalingFactors[i]));
+        runScalingBenchmark(results, scaling, name.str(), source);
+    }
+
+    return checkScaling(results, scaling);
+}
+
+/**
+ *  Blueprint with given number of named types. Named types inherit from,
+ *  include and refer to the preceding ones, without circular references.
+ */
+static std::string namedTypesFixture(size_t namedTypeCount)
+{
+    std::stringstream ss;
+    ss << "FORMAT: 1A\n\n# MSON\n\n# Data Structures\n\n";
+
+    for (size_t i = 0; i < namedTypeCount; ++i) {
+
+        ss << "## Type " << i;
+
+        if (i % 3 == 1)
+            ss << " (Type " << (i / 3) << ")\n\n";
+        else
+            ss << " (object)\n\n";
+
+        for (size_t j = 0; i > 0 && j < NamedTypeMemberCount; ++j)
+            ss << "+ member" << j << " (Type " << ((i * 7 + j * 13) % i) << ")\n";
+
+        if (i % 3 == 2)
+            ss << "+ Include Type " << (i / 2) << "\n";
+
+        ss << "+ name: value (string, required)\n\n";
+    }
+
+    return ss.str();
+}
+
+/**
+ *  \brief  Parse growing numbers of MSON named types depending on each other
+ *  \return False if the time per byte grows super-linearly with the number of named types
+ */
+static bool runNamedTypeBenchmarks(BenchmarkResults& results)
+{
+    Scaling scaling;
+
+    for (size_t i = 0; i < sizeof(NamedTypeCounts) / sizeof(NamedTypeCounts[0]); ++i) {
+
+        std::stringstream name;
+        name << "named-types-" << NamedTypeCounts[i];
+
+        runScalingBenchmark(results, scaling, name.str(), namedTypesFixture(NamedTypeCounts[i]));
+    }
+
+    return checkScaling(results, scaling);
+}
+
+/**
+ *  \brief  Reparse an edit of a group in the middle of blueprints generated in growing sizes
+ *
+ *  The edit is made and undone in turns, reusing the result of the previous
+ *  reparse. Only the edited group is parsed again, so the time should not
+ *  grow with the size of the blueprint.
+ *
+ *  \return False if the time grows with the size or a reparsed result differs from the parsed one
+ */
+static bool runReparseBenchmarks(BenchmarkResults& results)
+{
+    snowcrash::BlueprintShape shape;
+    Scaling scaling;
+    bool passed = true;
+
+    for (size_t i = 0; i < sizeof(ScalingFactors) / sizeof(ScalingFactors[0]); ++i) {
+
+        std::stringstream name, group;
+        name << "reparse generated-" << ScalingFactors[i] << "x";
+
+        if (name.str().find(filter) == std::string::npos)
+            continue;
+
+        snowcrash::BlueprintShape scaled = shape.scaled(ScalingFactors[i]);
+        std::string source = snowcrash::GenerateBlueprint(scaled);
+
+        group << "Description of the *group* " << scaled.groups / 2 << ".";
+        size_t location = source.find(group.str()) + 20;
+
+        std::vector<snowcrash::SourceEdit> edits;
+        edits.push_back(snowcrash::SourceEdit(location, 5, "edited group"));
+        edits.push_back(snowcrash::SourceEdit(location, 12, "group"));
+
+        snowcrash::ParseState state;
+        snowcrash::ParseResult<snowcrash::Blueprint> reparsed;
+        snowcrash::parse(source, CacheOptions, reparsed, state);
+
+        size_t count = 0;
+
+        run(results, name.str(), source.length(), [&]() {
+            snowcrash::reparse(edits[count++ % edits.size()], state, reparsed);
+        });
+
+        scaling.push_back(std::make_pair(results.size() - 1, source.length()));
+
+        snowcrash::ParseResult<snowcrash::Blueprint> parsed;
+        snowcrash::parse(state.source, CacheOptions, parsed);
+
+        mdp::ByteBuffer parsedData, reparsedData;
+        snowcrash::SerializeParseResult(parsed, parsedData);
+        snowcrash::SerializeParseResult(reparsed, reparsedData);
+
+        if (parsedData != reparsedData) {
+            std::cout << name.str() << ": reparsed result differs from the parsed one\n";
+            passed = false;
+        }
+    }
+
+    if (scaling.size() < 2)
+        return passed;
+
+    const BenchmarkResult& smallest = results[scaling.front().first];
+    const BenchmarkResult& largest = results[scaling.back().first];
+    double growth = largest.p50 / smallest.p50;
+    double sizeGrowth = static_cast<double>(scaling.back().second) / scaling.front().second;
+
+    std::cout << "\nreparse time grew " << std::fixed << std::setprecision(2) << growth << "x for "
+              << sizeGrowth << "x the source size\n";
+
+    if (growth > sizeGrowth * ReparseGrowthLimit) {
+        std::cout << "reparse time grows with the source size\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+/**
+ *  \brief  Compare loading the sources from a parse cache with parsing them
+ *  \return False if a loaded result differs from the parsed one or is not loaded from the cache
+ */
+static bool runCacheBenchmarks(BenchmarkResults& results,
+    const std::vector<std::pair<std::string, std::string> >& sources,
+    const std::string& directory)
+{
+    snowcrash::ParseCache cache(directory);
+    bool same = true;
+
+    for (size_t i = 0; i < sources.size(); ++i) {
+
+        const std::string& source = sources[i].second;
+        std::string parseName = "cache parse " + sources[i].first;
+        std::string loadName = "cache load " + sources[i].first;
+
+        if (parseName.find(filter) == std::string::npos && loadName.find(filter) == std::string::npos)
+            continue;
+
+        std::string path = cache.entryPath(source, CacheOptions);
+        std::remove(path.c_str());
+
+        snowcrash::ParseResult<snowcrash::Blueprint> parsed, loaded;
+        cache.parse(source, CacheOptions, parsed);
+        cache.parse(source, CacheOptions, loaded);
+
+        std::ifstream entry(path.c_str(), std::ios::binary | std::ios::ate);
+        std::streamoff entrySize = entry.is_open() ? static_cast<std::streamoff>(entry.tellg()) : 0;
+        entry.close();
+
+        size_t misses = cache.misses();
+
+        run(results, parseName, source.length(), [&]() {
+            snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+            snowcrash::parse(source, CacheOptions, blueprint);
+        });
+
+        run(results, loadName, source.length(), [&]() {
+            snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+            cache.parse(source, CacheOptions, blueprint);
+        });
+
+        std::remove(path.c_str());
+
+        mdp::ByteBuffer parsedData, loadedData;
+        snowcrash::SerializeParseResult(parsed, parsedData);
+        snowcrash::SerializeParseResult(loaded, loadedData);
+
+        if (parsedData != loadedData) {
+            std::cout << sources[i].first << ": result loaded from the cache differs from the parsed one\n";
+            same = false;
+        }
+
+        if (entrySize == 0 || cache.misses() != misses) {
+            std::cout << sources[i].first << ": result is not loaded from the cache\n";
+            same = false;
+        }
+    }
+
+    return same;
+}
+
+/**
+ *  \brief  Compare parsing memory-mapped files with reading them into a string first
+ *  \return False if the reports of both parses of a file differ
+ */
+static bool runMappedFileBenchmarks(BenchmarkResults& results, const std::vector<std::string>& paths)
+{
+    bool same = true;
+
+    for (std::vector<std::string>::const_iterator it = paths.begin(); it != paths.end(); ++it) {
+
+        const std::string& path = *it;
+        std::string name = path.substr(path.find_last_of("/\\") + 1);
+        std::string readName = "file read " + name;
+        std::string mappedName = "file mapped " + name;
+
+        if (readName.find(filter) == std::string::npos && mappedName.find(filter) == std::string::npos)
+            continue;
+
+        snowcrash::MappedFile file(path);
+
+        if (!file.isOpen()) {
+            std::cerr << "fatal: unable to map input file '" << path << "': " << file.error() << "\n";
+            exit(EXIT_FAILURE);
+        }
+
+        size_t bytes = file.length();
+
+        auto parseString = [&](snowcrash::ParseResult<snowcrash::Blueprint>& blueprint) {
+            snowcrash::parse(readFile(path), 0, blueprint);
+        };
+
+        auto parseMapped = [&](snowcrash::ParseResult<snowcrash::Blueprint>& blueprint) {
+            snowcrash::parseFile(path, 0, blueprint);
+        };
+
+        snowcrash::ParseResult<snowcrash::Blueprint> copied, mapped;
+        parseString(copied);
+        parseMapped(mapped);
+
+        size_t count = results.size();
+
+        run(results, readName, bytes, [&]() {
+            snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+            parseString(blueprint);
+        });
+
+        run(results, mappedName, bytes, [&]() {
+            snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+            parseMapped(blueprint);
+        });
+
+        if (results.size() == count + 2) {
+            std::cout << name << ": allocated " << std::fixed << std::setprecision(2)
+                      << results[count].allocatedBytes / (1024 * 1024) << "MB read vs "
+                      << results[count + 1].allocatedBytes / (1024 * 1024) << "MB mapped\n";
+        }
+
+        if (!snowcrashperf::isSameReport(copied.report, mapped.report)) {
+            std::cout << name << ": reports of the read and the mapped file differ\n";
+            same = false;
+        }
+    }
+
+    return same;
+}
+
+/** \return The condition, reporting the check if it is not met */
+static bool checkAllocation(bool condition, const char* check)
+{
+    if (!condition)
+        std::cout << "allocation check failed: " << check << "\n";
+
+    return condition;
+}
+
+/** \return Resource group with a resource and a description */
+static snowcrash::Element resourceGroupElement()
+{
+    using namespace snowcrash;
+
+    Element resource(Element::ResourceElement);
+    resource.content.resource.uriTemplate = "/questions/{question_id}/choices";
+    resource.content.resource.actions.push_back(Action());
+    resource.content.resource.actions.back().method = "GET";
+    resource.content.resource.actions.back().description = "List all the choices of a question";
+
+    Element description(Element::CopyElement);
+    description.content.copy = "Resources related to questions in the API.";
+
+    Element group(Element::CategoryElement);
+    group.attributes.name = "Questions and their choices";
+    group.category = Element::ResourceGroupCategory;
+    group.content.elements().push_back(description);
+    group.content.elements().push_back(resource);
+
+    return group;
+}
+
+/** \return Object with a property that is an object itself */
+static mson::Element propertyElement()
+{
+    mson::PropertyMember nested;
+    nested.name.literal = "nested property with a long name";
+    nested.valueDefinition.typeDefinition.typeSpecification.name.base = mson::StringTypeName;
+
+    mson::Element nestedElement;
+    nestedElement.build(nested);
+
+    mson::TypeSection typeSection(mson::TypeSection::MemberTypeClass);
+    typeSection.content.elements().push_back(nestedElement);
+
+    mson::PropertyMember property;
+    property.name.literal = "property with a long name";
+    property.sections.push_back(typeSection);
+
+    mson::Element element;
+    element.build(property);
+
+    return element;
+}
+
+/**
+ *  \brief  Check the allocations of building the AST and of parsing the source
+ *
+ *  Empty AST nodes do not allocate and nodes are moved into their parents
+ *  without allocations. Validating the source allocates less than parsing it.
+ *
+ *  \return False if a check fails
+ */
+static bool runAllocationChecks(const std::string& source)
+{
+    using namespace snowcrash;
+    using snowcrashperf::CountAllocations;
+
+    if (std::string("allocations").find(filter) == std::string::npos)
+        return true;
+
+    bool passed = true;
+
+    passed = checkAllocation(CountAllocations([] { Element element; }) == 0, "empty element") && passed;
+    passed = checkAllocation(CountAllocations([] { SourceMap<Element> elementSM; }) == 0, "empty element source map")
+        && passed;
+    passed = checkAllocation(CountAllocations([] { mson::Element element; }) == 0, "empty MSON element") && passed;
+    passed = checkAllocation(CountAllocations([] { mson::TypeSection typeSection; }) == 0, "empty type section")
+        && passed;
+    passed = checkAllocation(
+                 CountAllocations([] { SourceMap<mson::Element> elementSM; }) == 0, "empty MSON element source map")
+        && passed;
+
+    Element group = resourceGroupElement();
+    Blueprint blueprint;
+    blueprint.content.elements().reserve(1);
+
+    passed = checkAllocation(CountAllocations([&] { blueprint.content.elements().push_back(std::move(group)); }) == 0,
+                 "move an element into its parent")
+        && passed;
+
+    SourceMap<Element> groupSM(Element::CategoryElement);
+    groupSM.attributes.name.sourceMap.push_back(mdp::BytesRange(0, 18));
+    groupSM.content.elements().collection.push_back(SourceMap<Element>(Element::ResourceElement));
+
+    SourceMap<Blueprint> blueprintSM;
+    blueprintSM.content.elements().collection.reserve(1);
+
+    passed = checkAllocation(
+                 CountAllocations([&] { blueprintSM.content.elements().collection.push_back(std::move(groupSM)); })
+                     == 0,
+                 "move an element source map into its parent")
+        && passed;
+
+    mson::Element element = propertyElement();
+    mson::TypeSection typeSection(mson::TypeSection::MemberTypeClass);
+    typeSection.content.elements().reserve(1);
+
+    passed = checkAllocation(
+                 CountAllocations([&] { typeSection.content.elements().push_back(std::move(element)); }) == 0,
+                 "move an MSON element into its parent")
+        && passed;
+
+    mson::PropertyMember property = propertyElement().content.property;
+    mson::Element built;
+
+    passed = checkAllocation(CountAllocations([&] { built.build(std::move(property)); }) == 0,
+                 "build an MSON element from a moved member")
+        && passed;
+
+    mson::Elements elements;
+    elements.push_back(propertyElement());
+    elements.push_back(propertyElement());
+    mson::Element oneOf;
+
+    passed = checkAllocation(CountAllocations([&] { oneOf.build(std::move(elements)); }) == 1,
+                 "build an MSON one of from moved elements")
+        && passed;
+
+    size_t parseAllocations = CountAllocations([&] {
+        ParseResult<Blueprint> result;
+        parse(source, 0, result);
+    });
+
+    size_t validateAllocations = CountAllocations([&] {
+        ParseResult<Blueprint> result;
+        parse(source, ValidateOnlyOption, result);
+    });
+
+    passed = checkAllocation(validateAllocations < parseAllocations, "validate with fewer allocations than parse")
+        && passed;
+
+    std::cout << "\nallocations: parse " << parseAllocations << ", validate " << validateAllocations << "\n";
+
+    return passed;
+}
+
+static void writeJSON(const BenchmarkResults& results, std::ostream& stream)
+{
+    stream << "{\n  \"benchmarks\": [";
+
+    for (BenchmarkResults::const_iterator it = results.begin(); it != results.end(); ++it) {
+        stream << (it == results.begin() ? "\n" : ",\n") << std::fixed << std::setprecision(3) << "    {\"name\": \""
+               << it->name << "\", \"calls\": " << it->calls << ", \"mean_us\": " << it->mean
+               << ", \"p50_us\": " << it->p50 << ", \"p99_us\": " << it->p99
+               << ", \"throughput_mbps\": " << it->throughput << ", \"allocations\": " << it->allocations
+               << ", \"allocated_bytes\": " << it->allocatedBytes
+               << ", \"peak_rss_kb\": " << it->peakMemory << "}";
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+/** \return Medians of the benchmarks in JSON written by `writeJSON()` */
+static std::map<std::string, double> readMedians(const std::string& json)
+{
+    std::map<std::string, double> medians;
+    static const std::string NameKey = "\"name\": \"";
+    static const std::string MedianKey = "\"p50_us\": ";
+
+    for (size_t pos = json.find(NameKey); pos != std::string::npos; pos = json.find(NameKey, pos)) {
+
+        pos += NameKey.length();
+        size_t end = json.find('"', pos);
+        size_t median = json.find(MedianKey, end);
+
+        if (end == std::string::npos || median == std::string::npos)
+            break;
+
+        medians[json.substr(pos, end - pos)] = std::atof(json.c_str() + median + MedianKey.length());
+    }
+
+    return medians;
+}
+
+/** Print change of the medians against a baseline */
+static void compare(const BenchmarkResults& results, const std::string& baselineFile)
+{
+    std::map<std::string, double> baseline = readMedians(readFile(baselineFile));
+
+    std::cout << "\ncompared to '" << baselineFile << "':\n";
+
+    for (BenchmarkResults::const_iterator it = results.begin(); it != results.end(); ++it) {
+
+        std::map<std::string, double>::const_iterator baselineIt = baseline.find(it->name);
+
+        if (baselineIt == baseline.end() || baselineIt->second <= 0)
+            continue;
+
+        double change = (it->p50 - baselineIt->second) / baselineIt->second * 100.0;
+
+        std::cout << std::left << std::setw(48) << it->name << std::right << std::fixed << std::setprecision(1)
+                  << std::showpos << std::setw(8) << change << "%" << std::noshowpos << "\n";
+    }
+}
+
+static void help()
+{
+    std::cout << "usage: perf-benchmark [options]\n\n"
+              << "API Blueprint Parser Benchmark Suite\n\n"
+              << "options:\n\n"
+              << "  -h, --help                display this help message\n"
+              << "  --fixtures <directory>    directory of fixture-1.apib ... fixture-4.apib\n"
+              << "  --filter <text>           run only the benchmarks with the text in their name\n"
+              << "  --mapped <file>           also compare parsing the memory-mapped file with reading it\n"
+              << "  --cache <directory>       directory of the parse cache entries, the working directory by default\n"
+              << "  --json <file>             write the results as JSON\n"
+              << "  --compare <file>          compare the medians with JSON of an earlier run\n";
+    exit(EXIT_SUCCESS);
+}
+
+int main(int argc, const char* argv[])
+{
+    std::string fixtures = "./test/performance/fixtures";
+    std::string jsonFile, baselineFile, cacheDirectory;
+    std::vector<std::string> mappedFiles;
+
+    for (int i = 1; i < argc; ++i) {
+
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            help();
+        } else if (i + 1 < argc && arg == "--fixtures") {
+            fixtures = argv[++i];
+        } else if (i + 1 < argc && arg == "--filter") {
+            filter = argv[++i];
+        } else if (i + 1 < argc && arg == "--mapped") {
+            mappedFiles.push_back(argv[++i]);
+        } else if (i + 1 < argc && arg == "--cache") {
+            cacheDirectory = argv[++i];
+        } else if (i + 1 < argc && arg == "--json") {
+            jsonFile = argv[++i];
+        } else if (i + 1 < argc && arg == "--compare") {
+            baselineFile = argv[++i];
+        } else {
+            std::cerr << "unknown option '" << arg << "'\n";
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string> > sources;
+
+    for (int i = 1; i <= 4; ++i) {
+
+        std::stringstream name;
+        name << "fixture-" << i << ".apib";
+
+        std::string source = readFile(fixtures + "/" + name.str());
+
+        if (source.empty()) {
+            std::cerr << "fatal: unable to read fixture '" << fixtures << "/" << name.str() << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        sources.push_back(std::make_pair(name.str(), source));
+        mappedFiles.insert(mappedFiles.begin() + (i - 1), fixtures + "/" + name.str());
+    }
+
+    BenchmarkResults results;
+
+    std::cout << "running benchmarks...\n";
+
+    // Microbenchmarks of the primitives run over the largest fixture
+    runMicrobenchmarks(results, sources[2].second);
+
+    for (size_t i = 0; i < sources.size(); ++i)
+        runParseBenchmark(results, sources[i].first, sources[i].second);
+
+    bool passed = runScalingBenchmarks(results);
+    passed = runNamedTypeBenchmarks(results) && passed;
+    passed = runReparseBenchmarks(results) && passed;
+
+    sources.push_back(std::make_pair("generated", snowcrash::GenerateBlueprint(snowcrash::BlueprintShape())));
+    passed = runCacheBenchmarks(results, sources, cacheDirectory) && passed;
+    passed = runMappedFileBenchmarks(results, mappedFiles) && passed;
+    passed = runAllocationChecks(sources[2].second) && passed;
+
+    if (!jsonFile.empty()) {
+
+        std::ofstream stream(jsonFile.c_str());
+
+        if (!stream.is_open()) {
+            std::cerr << "fatal: unable to open '" << jsonFile << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        writeJSON(results, stream);
+    }
+
+    if (!baselineFile.empty())
+        compare(results, baselineFile);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,166 @@
+//
+//  perf-bytebuffer.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "ByteBuffer.h"
+#include "UTF8.h"
+
+using namespace mdp;
+
+static const size_t FixtureSize = 4 * 1024 * 1024;
+static const int TestRunCount = 50;
+
+static const UTF8CountingMethod Methods[]
+    = { ScalarUTF8CountingMethod, SSE2UTF8CountingMethod, AVX2UTF8CountingMethod };
+static const char* MethodNames[] = { "scalar", "sse2", "avx2" };
+
+/** Sink for the results so the measured work is not optimized out */
+static volatile size_t sink = 0;
+
+/** Blueprint-like ASCII text */
+static ByteBuffer asciiFixture()
+{
+    static const char* lines[] = { "# Group Notes\n",
+        "## Note [/notes/{id}]\n",
+        "+ Parameters\n    + id: 68a5sdf67 (string, required) - The note ID\n\n",
+        "### Retrieve a Note [GET]\n",
+        "+ Response 200 (application/json)\n\n        { \"id\": 1, \"title\": \"Grocery list\" }\n\n" };
+
+    ByteBuffer fixture;
+    fixture.reserve(FixtureSize);
+
+    for (size_t i = 0; fixture.length() < FixtureSize; ++i)
+        fixture += lines[i % (sizeof(lines) / sizeof(lines[0]))];
+
+    return fixture;
+}
+
+/** Text dominated by two to four byte characters */
+static ByteBuffer multiByteFixture()
+{
+    static const char* lines[] = { "## Poznámka [/poznámky/{id}]\n",
+        "Příliš žluťoučký kůň úpěl ďábelské ódy.\n",
+        "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe8\xaa\xac\xe6\x98\x8e\n",
+        "\xf0\x9f\x93\x9d \xf0\x9f\x93\x8c \xf0\x9f\x94\x97 \xe2\x82\xac\xc2\xa2\n" };
+
+    ByteBuffer fixture;
+    fixture.reserve(FixtureSize);
+
+    for (size_t i = 0; fixture.length() < FixtureSize; ++i)
+        fixture += lines[i % (sizeof(lines) / sizeof(lines[0]))];
+
+    return fixture;
+}
+
+static const size_t RangeCount = 64;
+
+/**
+ *  Ranges of 64 to 575 bytes spread over the whole buffer, like a source map
+ *  of a long blueprint. Converting a range counts all the bytes preceding it,
+ *  `scanned` is the total number of bytes counted per conversion.
+ */
+static BytesRangeSet rangesFixture(const ByteBuffer& fixture, size_t& scanned)
+{
+    BytesRangeSet ranges;
+    scanned = 0;
+
+    for (size_t i = 0; i < RangeCount; ++i) {
+        size_t location = (fixture.length() / RangeCount) * i;
+        size_t length = std::min<size_t>(64 + (i * 97) % 512, fixture.length() - location);
+
+        ranges.push_back(BytesRange(location, length));
+        scanned += location + length;
+    }
+
+    return ranges;
+}
+
+/** Throughput in MB/s of `TestRunCount` runs of given function over `bytes` bytes */
+template <typename F>
+static double throughput(size_t bytes, F f)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < TestRunCount; ++i)
+        f();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (static_cast<double>(bytes) * TestRunCount) / (1024 * 1024) / elapsed.count();
+}
+
+static void testfunc(const std::string& name, const ByteBuffer& fixture)
+{
+    size_t scanned = 0;
+    BytesRangeSet ranges = rangesFixture(fixture, scanned);
+
+    std::cout << name << " (" << fixture.length() << " bytes, "
+              << CountUTF8Characters(fixture.c_str(), fixture.length(), ScalarUTF8CountingMethod)
+              << " characters):\n";
+
+    for (size_t m = 0; m < sizeof(Methods) / sizeof(Methods[0]); ++m) {
+        if (!IsUTF8CountingMethodSupported(Methods[m])) {
+            std::cout << "  " << std::setw(8) << std::left << MethodNames[m] << "not supported\n";
+            continue;
+        }
+
+        SelectUTF8CountingMethod(Methods[m]);
+
+        double count = throughput(fixture.length(), [&]() {
+            sink += CountUTF8Characters(fixture.c_str(), fixture.length());
+        });
+
+        double index = throughput(fixture.length(), [&]() {
+            ByteBufferCharacterIndex characterIndex;
+            BuildCharacterIndex(characterIndex, fixture);
+            characterIndex.build();
+            sink += characterIndex[fixture.length() - 1];
+        });
+
+        double rangeSet = throughput(scanned, [&]() {
+            CharactersRangeSet characterRanges = BytesRangeSetToCharactersRangeSet(ranges, fixture);
+            sink += characterRanges.size();
+        });
+
+        std::cout << "  " << std::setw(8) << std::left << MethodNames[m] << std::fixed << std::setprecision(1)
+                  << "count: " << count << " MB/s, index: " << index << " MB/s, ranges: " << rangeSet << " MB/s\n";
+    }
+
+    SelectUTF8CountingMethod(AutoUTF8CountingMethod);
+}
+
+int main(int argc, const char* argv[])
+{
+    if (argc > 2) {
+        std::cerr << "usage: perf-bytebuffer [<input file>]\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "running UTF-8 character counting performance test, " << TestRunCount << " runs...\n";
+
+    testfunc("ascii", asciiFixture());
+    testfunc("multi-byte", multiByteFixture());
+
+    if (argc == 2) {
+        std::ifstream inputFileStream(argv[1]);
+        if (!inputFileStream.is_open()) {
+            std::cerr << "fatal: unable to open input file '" << argv[1] << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        std::stringstream inputStream;
+        inputStream << inputFileStream.rdbuf();
+        testfunc(argv[1], inputStream.str());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+//
+//  perf-duplicates.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "snowcrash.h"
+
+static const size_t ResourceCounts[] = { 1000, 2000, 5000, 10000 };
+static const size_t ResourcesPerGroup = 10;
+static const int TestRunCount = 3;
+
+/**
+ *  Blueprint with given number of resources, every resource has its own
+ *  attributes named type and every group a data structure. Every name is
+ *  checked for a duplicate when parsed.
+ */
+static std::string blueprintFixture(size_t resourceCount)
+{
+    std::stringstream ss;
+    ss << "FORMAT: 1A\n\n# Scaling\n\n";
+
+    for (size_t i = 0; i < resourceCount; ++i) {
+
+        if (i % ResourcesPerGroup == 0) {
+            size_t group = i / ResourcesPerGroup;
+
+            ss << "# Group Group " << group << "\n\n";
+            ss << "# Data Structures\n\n";
+            ss << "## Structure " << group << " (object)\n\n";
+            ss << "+ id: " << group << " (number)\n\n";
+            ss << "# Group Resources " << group << "\n\n";
+        }
+
+        ss << "## Resource " << i << " [/resources/" << i << "/{id}]\n\n";
+        ss << "+ Attributes (object)\n    + name: resource " << i << "\n\n";
+        ss << "### Retrieve [GET]\n\n";
+        ss << "+ Response 200 (application/json)\n\n        { \"id\": " << i << " }\n\n";
+    }
+
+    return ss.str();
+}
+
+/** Mean time in seconds of `TestRunCount` parses of the source, warnings of the last one in \a warnings */
+static double testfunc(const std::string& source, size_t& warnings, int& resultCode)
+{
+    double sum = 0;
+
+    for (int i = 0; i < TestRunCount; ++i) {
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        snowcrash::parse(source, 0, blueprint);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        sum += elapsed.count();
+        warnings = blueprint.report.warnings.size();
+        resultCode = blueprint.report.error.code;
+    }
+
+    return sum / TestRunCount;
+}
+
+int main(int argc, const char* argv[])
+{
+    if (argc != 1) {
+        std::cerr << "usage: perf-duplicates\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "running duplicate lookup scaling test, " << TestRunCount << " runs...\n";
+
+    for (size_t i = 0; i < sizeof(ResourceCounts) / sizeof(ResourceCounts[0]); ++i) {
+
+        std::string source = blueprintFixture(ResourceCounts[i]);
+
+        size_t warnings = 0;
+        int resultCode = snowcrash::Error::OK;
+        double mean = testfunc(source, warnings, resultCode);
+
+        std::cout << std::setw(6) << ResourceCounts[i] << " resources (" << resultCode << ", " << warnings
+                  << " warnings): " << std::fixed << std::setprecision(3) << mean << "s, " << std::setprecision(1)
+                  << (mean * 1000000 / ResourceCounts[i]) << "us per resource\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+//
+//  perf-generate.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "BlueprintGenerator.h"
+
+static void help()
+{
+    snowcrash::BlueprintShape shape;
+
+    std::cout << "usage: perf-generate [options]\n\n"
+              << "API Blueprint Generator, writes a blueprint of the shape to the standard output\n\n"
+              << "options:\n\n"
+              << "  -h, --help                display this help message\n"
+              << "  -o, --output <file>       write the blueprint to the file\n"
+              << "  --groups <n>              resource groups (" << shape.groups << ")\n"
+              << "  --resources <n>           resources per group (" << shape.resourcesPerGroup << ")\n"
+              << "  --actions <n>             actions per resource, at most 5 (" << shape.actionsPerResource << ")\n"
+              << "  --payloads <n>            payloads per action (" << shape.payloadsPerAction << ")\n"
+              << "  --body-size <bytes>       size of the JSON bodies (" << shape.bodySize << ")\n"
+              << "  --named-types <n>         MSON named types per group (" << shape.namedTypes << ")\n"
+              << "  --inheritance-depth <n>   depth of the named type inheritance (" << shape.inheritanceDepth << ")\n"
+              << "  --mixins <n>              mixins per named type (" << shape.mixinsPerType << ")\n"
+              << "  --no-models               do not refer to resource models\n"
+              << "  --seed <n>                seed of the pseudo-random choices (" << shape.seed << ")\n";
+    exit(EXIT_SUCCESS);
+}
+
+/** \return Numeric value of an option */
+static size_t value(int& i, int argc, const char* argv[])
+{
+    if (i + 1 >= argc) {
+        std::cerr << "missing value of option '" << argv[i] << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    char* end = NULL;
+    unsigned long result = std::strtoul(argv[++i], &end, 10);
+
+    if (*end != '\0') {
+        std::cerr << "invalid value '" << argv[i] << "' of option '" << argv[i - 1] << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return static_cast<size_t>(result);
+}
+
+int main(int argc, const char* argv[])
+{
+    snowcrash::BlueprintShape shape;
+    std::string outputFileName;
+
+    for (int i = 1; i < argc; ++i) {
+
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            help();
+        } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+            outputFileName = argv[++i];
+        } else if (arg == "--groups") {
+            shape.groups = value(i, argc, argv);
+        } else if (arg == "--resources") {
+            shape.resourcesPerGroup = value(i, argc, argv);
+        } else if (arg == "--actions") {
+            shape.actionsPerResource = value(i, argc, argv);
+        } else if (arg == "--payloads") {
+            shape.payloadsPerAction = value(i, argc, argv);
+        } else if (arg == "--body-size") {
+            shape.bodySize = value(i, argc, argv);
+        } else if (arg == "--named-types") {
+            shape.namedTypes = value(i, argc, argv);
+        } else if (arg == "--inheritance-depth") {
+            shape.inheritanceDepth = value(i, argc, argv);
+        } else if (arg == "--mixins") {
+            shape.mixinsPerType = value(i, argc, argv);
+        } else if (arg == "--no-models") {
+            shape.modelReferences = false;
+        } else if (arg == "--seed") {
+            shape.seed = static_cast<unsigned int>(value(i, argc, argv));
+        } else {
+            std::cerr << "unknown option '" << arg << "'\n";
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    std::string blueprint = snowcrash::GenerateBlueprint(shape);
+
+    if (outputFileName.empty()) {
+        std::cout << blueprint;
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream outputFileStream(outputFileName.c_str(), std::ios::binary);
+
+    if (!outputFileStream.is_open()) {
+        std::cerr << "fatal: unable to open output file '" << outputFileName << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    outputFileStream << blueprint;
+    return EXIT_SUCCESS;
+}
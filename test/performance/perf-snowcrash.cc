@@ -5,109 +5,111 @@
 //  Created by Zdenek Nemec on 10/8/13.
 //  Copyright (c) 2013 Apiary Inc. All rights reserved.
 //
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <sstream>
 #include <fstream>
-#include <cmath>
+#include <vector>
 #include "snowcrash.h"
-
-#if defined(_MSC_VER)
-#include <windows.h>
-#else
-#include <sys/time.h>
-#endif
+#include "Instrumentation.h"
 
 using snowcrash::SourceAnnotation;
 using snowcrash::Error;
 
+static const int WarmupRunCount = 10;
 static const int TestRunCount = 1000;
 
-#if defined(_MSC_VER)
-const __int64 DELTA_EPOCH_IN_MICROSECS = 11644473600000000;
-
-struct timezone {
-    int tz_minuteswest; /* minutes west of Greenwich */
-    int tz_dsttime;     /* type of DST correction */
+/** Statistics of the parse times, in seconds */
+struct TestStatistics {
+    double total;
+    double mean;
+    double p50;
+    double p99;
 };
 
-int gettimeofday(struct timeval* tv, struct timezone* tz)
+/**
+ *  \brief  Parse input @TestRunCount -times after @WarmupRunCount runs
+ *  \param  input       A blueprint source data.
+ *  \param  statistics  Statistics of the time spent parsing.
+ *  \return Result code of snowcrash::parse operation.
+ */
+static int testfunc(const std::string& input, TestStatistics& statistics)
 {
-    FILETIME ft;
-    TIME_ZONE_INFORMATION tz_winapi;
-    __int64 tmpres = 0;
-    int rez = 0;
+    std::vector<double> times;
+    int resultCode = snowcrash::Error::OK;
 
-    ZeroMemory(&ft, sizeof(ft));
-    ZeroMemory(&tz_winapi, sizeof(tz_winapi));
+    for (int i = 0; i < WarmupRunCount + TestRunCount; ++i) {
+        snowcrash::BlueprintParserOptions options = 0;
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
 
-    GetSystemTimeAsFileTime(&ft);
+        // Do the test.
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
-    tmpres = ft.dwHighDateTime;
-    tmpres <<= 32;
-    tmpres |= ft.dwLowDateTime;
+        snowcrash::parse(input, options, blueprint);
 
-    tmpres /= 10;
-    tmpres -= DELTA_EPOCH_IN_MICROSECS;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
 
-    if (tv) {
-        tv->tv_sec = (__int32)(tmpres * 0.000001);
-        tv->tv_usec = (tmpres % 1000000);
-    }
+        resultCode = blueprint.report.error.code;
 
-    if (tz) {
-        rez = GetTimeZoneInformation(&tz_winapi);
-        tz->tz_dsttime = (rez == 2) ? true : false;
-        tz->tz_minuteswest = tz_winapi.Bias + ((rez == 2) ? tz_winapi.DaylightBias : 0);
+        if (i >= WarmupRunCount)
+            times.push_back(elapsed.count());
     }
 
-    return 0;
+    // Compute statistics and return result
+    statistics.total = 0;
+
+    for (std::vector<double>::const_iterator it = times.begin(); it != times.end(); ++it)
+        statistics.total += *it;
+
+    std::sort(times.begin(), times.end());
+
+    statistics.mean = statistics.total / TestRunCount;
+    statistics.p50 = times[times.size() / 2];
+    statistics.p99 = times[(times.size() * 99) / 100];
+    return resultCode;
 }
-#endif
 
 /**
- *  \brief  Parse input @TestRunCount -times
- *  \param  input   A blueprint source data.
- *  \param  total   Total time spent parsing (s).
- *  \param  mean    Mean time spent parsing (s).
- *  \param  stddev  Standard deviation.
- *  \return Result code of snowcrash::parse operation.
+ *  \brief  Parse input once, print time spent in the parsing stages and write it as a Chrome trace
+ *  \param  input       A blueprint source data.
+ *  \param  traceFile   Name of the trace file.
  */
-static int testfunc(const std::string& input, double& total, double& mean, double& stddev)
+static void tracefunc(const std::string& input, const std::string& traceFile)
 {
-    struct timeval stime, etime;
-    double t = 0, sum = 0, sum2 = 0;
-    int resultCode = snowcrash::Error::OK;
+    snowcrash::ClearInstrumentation();
 
-    for (int i = 0; i < TestRunCount; ++i) {
-        snowcrash::BlueprintParserOptions options = 0;
-        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+    snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+    snowcrash::parse(input, 0, blueprint);
 
-        // Do the test.
-        if (::gettimeofday(&stime, NULL)) {
-            std::cerr << "fatal: gettimeofday failed";
-            exit(EXIT_FAILURE);
-        }
+    snowcrash::InstrumentationStatistics statistics = snowcrash::GetInstrumentationStatistics();
 
-        snowcrash::parse(input, options, blueprint);
+    if (statistics.stages.empty()) {
+        std::cerr << "no stages recorded, configure with --instrument to record them\n";
+    }
 
-        if (::gettimeofday(&etime, NULL)) {
-            std::cerr << "fatal: gettimeofday failed";
-            exit(EXIT_FAILURE);
-        }
+    for (std::vector<snowcrash::InstrumentationStage>::const_iterator it = statistics.stages.begin();
+         it != statistics.stages.end();
+         ++it) {
+        std::cout << it->name << ": " << it->calls << " calls, " << (it->duration / 1000.0) << "ms\n";
+    }
 
-        resultCode = blueprint.report.error.code;
+    std::cout << "regex evaluations: " << statistics.counters[snowcrash::RegexEvaluationsCounter] << "\n";
+    std::cout << "warnings: " << statistics.counters[snowcrash::WarningsCounter] << "\n";
+    std::cout << "bytes copied: " << statistics.counters[snowcrash::BytesCopiedCounter] << "\n";
 
-        // Compute the time taken and add it to the sums.
-        t = (etime.tv_sec - stime.tv_sec) + (etime.tv_usec - stime.tv_usec) / 1000000.0;
-        sum += t;
-        sum2 += t * t;
+    if (statistics.droppedEvents) {
+        std::cerr << statistics.droppedEvents << " events over the limit are not in the trace\n";
     }
 
-    // Compute statistics and return result
-    total = sum;
-    mean = sum / TestRunCount;
-    stddev = std::sqrt((sum2 / TestRunCount) - (mean * mean));
-    return resultCode;
+    std::ofstream traceFileStream(traceFile.c_str());
+
+    if (!traceFileStream.is_open()) {
+        std::cerr << "fatal: unable to open trace file '" << traceFile << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    snowcrash::WriteInstrumentationTrace(statistics, traceFileStream);
 }
 
 void help()
@@ -115,7 +117,8 @@ void help()
     std::cout << "usage: perf-snowcrash [options] ... <input file>" << std::endl << std::endl;
     std::cout << "API Blueprint Parser Performance Test Tool" << std::endl << std::endl;
     std::cout << "options:" << std::endl << std::endl;
-    std::cout << "  -h, --help    display this help message" << std::endl;
+    std::cout << "  -h, --help            display this help message" << std::endl;
+    std::cout << "  -t, --trace <file>    write a Chrome trace of a single parse" << std::endl;
     exit(0);
 }
 
@@ -129,18 +132,22 @@ int main(int argc, const char* argv[])
     // FIXME: Instruments helper
     //::sleep(20);
 
-    if (argc != 2) {
-        std::cerr << "one input file expected\n";
-        exit(EXIT_FAILURE);
+    if (argc == 2 && helpRequest(argv[1])) {
+        help();
     }
 
-    if (helpRequest(argv[1])) {
-        help();
+    std::string traceFileName;
+
+    if (argc == 4 && (std::string(argv[1]) == "-t" || std::string(argv[1]) == "--trace")) {
+        traceFileName = argv[2];
+    } else if (argc != 2) {
+        std::cerr << "one input file expected\n";
+        exit(EXIT_FAILURE);
     }
 
     // Read fixture file
     std::ifstream inputFileStream;
-    std::string inputFileName = argv[1];
+    std::string inputFileName = argv[argc - 1];
     inputFileStream.open(inputFileName.c_str());
     if (!inputFileStream.is_open()) {
         std::cerr << "fatal: unable to open input file '" << inputFileName << "'\n";
@@ -153,11 +160,17 @@ int main(int argc, const char* argv[])
 
     std::cout << "running snowcrash performance test...\n";
 
-    double mean = 0, total = 0, stddev = 0;
-    int result = testfunc(inputStream.str(), total, mean, stddev);
+    TestStatistics statistics;
+    int result = testfunc(inputStream.str(), statistics);
 
     std::cout << "parsing '" << inputFileName << "' " << TestRunCount << "-times (" << result << "):\n";
-    std::cout << "total: " << total << "s mean: " << mean << " +/- " << stddev << "s\n";
+    std::cout << "total: " << statistics.total << "s mean: " << statistics.mean << "s p50: " << statistics.p50
+              << "s p99: " << statistics.p99 << "s\n";
+    std::cout << "throughput: " << (inputStream.str().length() / statistics.p50 / 1000000.0) << " MB/s\n";
+
+    if (!traceFileName.empty()) {
+        tracefunc(inputStream.str(), traceFileName);
+    }
 
     // FIXME: Instruments helper
     //::sleep(20);
@@ -0,0 +1,76 @@
+//
+//  perf-validate.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "snowcrash.h"
+#include "PerfUtility.h"
+
+static const int TestRunCount = 100;
+
+/** \return Mean time of parsing the source with the options, in milliseconds */
+static double testfunc(const std::string& source, snowcrash::BlueprintParserOptions options, snowcrash::Report& report)
+{
+    double sum = 0;
+
+    for (int run = 0; run < TestRunCount; ++run) {
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        snowcrash::parse(source, options, blueprint);
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        sum += elapsed.count();
+        report = blueprint.report;
+    }
+
+    return sum / TestRunCount;
+}
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "usage: perf-validate <fixture> ...\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::cout << "running validate-only performance test, " << TestRunCount << " runs...\n";
+
+    bool same = true;
+
+    for (int i = 1; i < argc; ++i) {
+
+        std::ifstream inputFileStream(argv[i]);
+
+        if (!inputFileStream.is_open()) {
+            std::cerr << "fatal: unable to open input file '" << argv[i] << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        std::stringstream inputStream;
+        inputStream << inputFileStream.rdbuf();
+        inputFileStream.close();
+
+        snowcrash::Report fullReport, validateReport;
+        double full = testfunc(inputStream.str(), 0, fullReport);
+        double validate = testfunc(inputStream.str(), snowcrash::ValidateOnlyOption, validateReport);
+
+        bool sameReport = snowcrashperf::isSameReport(fullReport, validateReport);
+        same = same && sameReport;
+
+        std::cout << argv[i] << ": full " << std::fixed << std::setprecision(3) << full << "ms, validate-only "
+                  << validate << "ms (" << std::setprecision(2) << (full / validate) << "x), "
+                  << fullReport.warnings.size() << " warnings" << (sameReport ? "" : ", REPORTS DIFFER") << "\n";
+    }
+
+    return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
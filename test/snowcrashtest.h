@@ -65,7 +65,7 @@ namespace snowcrashtest
             pd.modelSourceMapTable.insert(models.modelSourceMapTable.begin(), models.modelSourceMapTable.end());
 
             pd.namedTypeBaseTable.insert(namedTypes.baseTable.begin(), namedTypes.baseTable.end());
-            pd.namedTypeDependencyTable.insert(namedTypes.dependencyTable.begin(), namedTypes.dependencyTable.end());
+            pd.modifiableNamedTypeDependencyGraph() = mson::NamedTypeDependencyGraph(namedTypes.dependencyTable);
 
             PARSER::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
         }
@@ -1480,3 +1480,55 @@ TEST_CASE("Parse blueprint with escaped data structure reference", "[blueprint]"
     REQUIRE(blueprint.node.content.elements().at(0).element == Element::CategoryElement);
     REQUIRE(blueprint.node.content.elements().at(0).content.elements().size() == 1);
 }
+
+TEST_CASE("Worker parser data shares the named type tables", "[blueprint][parallel]")
+{
+    mdp::ByteBuffer source = "# API\n";
+
+    Blueprint blueprint;
+    SectionParserData parent(0, source, blueprint);
+    parent.namedTypeBaseTable["A"] = mson::ObjectBaseType;
+    parent.namedTypeBaseTable["B"] = mson::ObjectBaseType;
+    parent.modifiableNamedTypeDependencyGraph().add("A");
+    parent.modifiableNamedTypeDependencyGraph().add("B");
+
+    Blueprint segment;
+    SectionParserData worker(parent, segment);
+
+    REQUIRE(&worker.namedTypeBaseTable == &parent.namedTypeBaseTable);
+    REQUIRE(&worker.namedTypeInheritanceTable == &parent.namedTypeInheritanceTable);
+    REQUIRE(&worker.sourceCharacterIndex == &parent.sourceCharacterIndex);
+    REQUIRE(worker.isNamedTypeDependencyGraphShared());
+    REQUIRE(&worker.namedTypeDependencyGraph() == &parent.namedTypeDependencyGraph());
+
+    // The graph is copied once modified, the parent keeps its own
+    worker.modifiableNamedTypeDependencyGraph().addDependency("A", "B");
+
+    REQUIRE(!worker.isNamedTypeDependencyGraphShared());
+    REQUIRE(worker.namedTypeDependencyGraph().dependsOn("A", "B"));
+    REQUIRE(!parent.namedTypeDependencyGraph().dependsOn("A", "B"));
+}
+
+TEST_CASE("Moved from element remains usable", "[blueprint]")
+{
+    Element description(Element::CopyElement);
+    description.content.copy = "Resources related to questions in the API.";
+
+    Element group(Element::CategoryElement);
+    group.content.elements().push_back(description);
+    group.content.elements().push_back(Element(Element::ResourceElement));
+
+    Element moved(std::move(group));
+
+    REQUIRE(group.content.elements().empty());
+
+    group = moved;
+    REQUIRE(group.content.elements().size() == 2);
+
+    Element empty;
+    moved = empty;
+    REQUIRE(moved.content.elements().empty());
+
+    const Element& constEmpty = empty;
+    REQUIRE(constEmpty.content.elements().empty());
+}
@@ -476,3 +476,33 @@ TEST_CASE("Parse headers in codefences with hint", "[headers][codefence]")
     REQUIRE(headers.node[0].first == "Set-Cookie");
     REQUIRE(headers.node[0].second == "abcd");
 }
+
+TEST_CASE("Skip whitespace-only lines of headers", "[headers]")
+{
+    const mdp::ByteBuffer source
+        = "a: b\n"
+          "    \n"
+          "c: d\n";
+
+    mdp::BytesRangeSet sourceMap;
+    sourceMap.push_back(mdp::BytesRange(0, 5));
+    sourceMap.push_back(mdp::BytesRange(5, 5));
+    sourceMap.push_back(mdp::BytesRange(10, 5));
+
+    Blueprint blueprint;
+    SectionParserData pd(0, source, blueprint);
+    mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+
+    mdp::MarkdownNodes nodes(1);
+    ParseResult<Headers> headers;
+    SectionProcessor<Headers>::headersFromContent(nodes.begin(), sourceMap.begin(), sourceMap.end(), pd, headers);
+
+    REQUIRE(headers.report.error.code == Error::OK);
+    REQUIRE(headers.report.warnings.empty());
+
+    REQUIRE(headers.node.size() == 2);
+    REQUIRE(headers.node[0].first == "a");
+    REQUIRE(headers.node[0].second == "b");
+    REQUIRE(headers.node[1].first == "c");
+    REQUIRE(headers.node[1].second == "d");
+}
@@ -0,0 +1,165 @@
+//
+//  test-Instrumentation.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "catch.hpp"
+#include "snowcrash.h"
+#include "Instrumentation.h"
+#include "WorkerPool.h"
+
+using namespace snowcrash;
+
+/** \return Stage of the statistics with the name, NULL if not recorded */
+static const InstrumentationStage* FindStage(const InstrumentationStatistics& statistics, const std::string& name)
+{
+    for (std::vector<InstrumentationStage>::const_iterator it = statistics.stages.begin();
+         it != statistics.stages.end();
+         ++it) {
+
+        if (it->name == name)
+            return &*it;
+    }
+
+    return NULL;
+}
+
+TEST_CASE("Name stages of section parsers", "[instrumentation]")
+{
+    REQUIRE(std::string(SectionParserStageName(typeid(Blueprint))) == "SectionParser<Blueprint>::parse");
+    REQUIRE(std::string(SectionParserStageName(typeid(Payload))) == "SectionParser<Payload>::parse");
+    REQUIRE(std::string(SectionParserStageName(typeid(mson::NamedType))) == "SectionParser<mson::NamedType>::parse");
+    REQUIRE(SectionParserStageName(typeid(Blueprint)) == SectionParserStageName(typeid(Blueprint)));
+}
+
+TEST_CASE("Write instrumentation as a Chrome trace", "[instrumentation]")
+{
+    InstrumentationStatistics statistics;
+
+    InstrumentationEvent event;
+    event.name = "MarkdownParser::parse";
+    event.thread = 1;
+    event.start = 2.5;
+    event.duration = 1000;
+
+    statistics.events.push_back(event);
+    statistics.counters[RegexEvaluationsCounter] = 42;
+
+    std::stringstream trace;
+    WriteInstrumentationTrace(statistics, trace);
+
+    REQUIRE(trace.str().find("{\"traceEvents\":[") == 0);
+    REQUIRE(trace.str().find("{\"name\":\"MarkdownParser::parse\",\"cat\":\"snowcrash\",\"ph\":\"X\",\"pid\":0,"
+                             "\"tid\":1,\"ts\":2.500,\"dur\":1000.000}")
+        != std::string::npos);
+    REQUIRE(trace.str().find("\"regexEvaluations\":\"42\"") != std::string::npos);
+    REQUIRE(trace.str().find("\"bytesCopied\":\"0\"") != std::string::npos);
+}
+
+TEST_CASE("Record stages and counters of a parse", "[instrumentation]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# /notes\n"
+          "Notes\n\n"
+          "## GET\n"
+          "+ Response 200 (text/plain)\n\n"
+          "        note\n\n"
+          "+ Respons 204\n";
+
+    ClearInstrumentation();
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+
+    InstrumentationStatistics statistics = GetInstrumentationStatistics();
+
+#ifdef SNOWCRASH_INSTRUMENTATION
+    REQUIRE(FindStage(statistics, "CheckSource") != NULL);
+    REQUIRE(FindStage(statistics, "MarkdownParser::parse") != NULL);
+    REQUIRE(FindStage(statistics, "BuildCharacterIndex") != NULL);
+    REQUIRE(FindStage(statistics, "resolveNamedTypeTables") != NULL);
+    REQUIRE(FindStage(statistics, "checkLazyReferencing") != NULL);
+
+    const InstrumentationStage* stage = FindStage(statistics, "SectionParser<Blueprint>::parse");
+    REQUIRE(stage != NULL);
+    REQUIRE(stage->calls == 1);
+
+    stage = FindStage(statistics, "SectionParser<Action>::parse");
+    REQUIRE(stage != NULL);
+    REQUIRE(stage->calls == 1);
+
+    stage = FindStage(statistics, "SectionParser<Payload>::parse");
+    REQUIRE(stage != NULL);
+    REQUIRE(stage->calls == 1);
+
+    stage = FindStage(statistics, "SectionParser<ResourceGroup>::parse");
+    REQUIRE(stage != NULL);
+    REQUIRE(stage->calls == 1);
+
+    size_t calls = 0;
+
+    for (std::vector<InstrumentationStage>::const_iterator it = statistics.stages.begin();
+         it != statistics.stages.end();
+         ++it)
+        calls += it->calls;
+
+    REQUIRE(statistics.events.size() == calls);
+    REQUIRE(statistics.counters[RegexEvaluationsCounter] > 0);
+    REQUIRE(statistics.counters[WarningsCounter] == blueprint.report.warnings.size());
+    REQUIRE(statistics.counters[BytesCopiedCounter] > 0);
+#else
+    REQUIRE(statistics.stages.empty());
+    REQUIRE(statistics.events.empty());
+    REQUIRE(statistics.counters[RegexEvaluationsCounter] == 0);
+#endif
+
+    ClearInstrumentation();
+
+    REQUIRE(GetInstrumentationStatistics().events.empty());
+}
+
+TEST_CASE("Record stages of every thread into its own buffer", "[instrumentation]")
+{
+    ClearInstrumentation();
+
+    RunTasks(4, 4, [](size_t) {
+        for (size_t i = 0; i < 10; ++i) {
+            InstrumentationScope scope("worker");
+        }
+    });
+
+    {
+        InstrumentationScope scope("main");
+    }
+
+    InstrumentationStatistics statistics = GetInstrumentationStatistics();
+
+    const InstrumentationStage* stage = FindStage(statistics, "worker");
+    REQUIRE(stage != NULL);
+    REQUIRE(stage->calls == 40);
+    REQUIRE(FindStage(statistics, "main") != NULL);
+    REQUIRE(statistics.events.size() == 41);
+    REQUIRE(statistics.events.back().name == std::string("main"));
+    REQUIRE(statistics.droppedEvents == 0);
+
+    ClearInstrumentation();
+
+    for (size_t i = 0; i < InstrumentationEventLimit + 10; ++i) {
+        InstrumentationScope scope("limited");
+    }
+
+    statistics = GetInstrumentationStatistics();
+
+    stage = FindStage(statistics, "limited");
+    REQUIRE(stage != NULL);
+    REQUIRE(stage->calls == InstrumentationEventLimit + 10);
+    REQUIRE(statistics.events.size() == InstrumentationEventLimit);
+    REQUIRE(statistics.droppedEvents == 10);
+
+    ClearInstrumentation();
+}
@@ -0,0 +1,172 @@
+//
+//  test-MSONDependencyGraph.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "snowcrashtest.h"
+#include "MSONDependencyGraph.h"
+
+using namespace mson;
+using namespace snowcrashtest;
+
+/** \return Set of the literals */
+static std::set<Literal> Literals(const char* first = NULL, const char* second = NULL, const char* third = NULL)
+{
+    std::set<Literal> literals;
+
+    if (first)
+        literals.insert(first);
+
+    if (second)
+        literals.insert(second);
+
+    if (third)
+        literals.insert(third);
+
+    return literals;
+}
+
+TEST_CASE("Resolve transitive named type dependencies", "[mson][dependency]")
+{
+    NamedTypeDependencyTable table;
+    table["A"] = Literals("B");
+    table["B"] = Literals("C", "D");
+    table["C"] = Literals();
+    table["D"] = Literals("C");
+
+    NamedTypeDependencyGraph graph(table);
+    graph.resolve();
+    table = graph.table();
+
+    REQUIRE(table.size() == 4);
+    REQUIRE(table["A"] == Literals("B", "C", "D"));
+    REQUIRE(table["B"] == Literals("C", "D"));
+    REQUIRE(table["C"].empty());
+    REQUIRE(table["D"] == Literals("C"));
+
+    REQUIRE_FALSE(graph.isCircular("A"));
+    REQUIRE_FALSE(graph.isCircular("B"));
+    REQUIRE_FALSE(graph.isCircular("C"));
+    REQUIRE_FALSE(graph.isCircular("D"));
+}
+
+TEST_CASE("Resolve circular named type dependencies", "[mson][dependency]")
+{
+    NamedTypeDependencyTable table;
+    table["A"] = Literals("B");
+    table["B"] = Literals("C");
+    table["C"] = Literals("B", "D");
+    table["D"] = Literals();
+    table["E"] = Literals("E");
+
+    NamedTypeDependencyGraph graph(table);
+    graph.resolve();
+    table = graph.table();
+
+    REQUIRE(table["A"] == Literals("B", "C", "D"));
+    REQUIRE(table["B"] == Literals("B", "C", "D"));
+    REQUIRE(table["C"] == Literals("B", "C", "D"));
+    REQUIRE(table["D"].empty());
+    REQUIRE(table["E"] == Literals("E"));
+
+    REQUIRE_FALSE(graph.isCircular("A"));
+    REQUIRE(graph.isCircular("B"));
+    REQUIRE(graph.isCircular("C"));
+    REQUIRE_FALSE(graph.isCircular("D"));
+    REQUIRE(graph.isCircular("E"));
+}
+
+TEST_CASE("Add entries for named types which are only depended on", "[mson][dependency]")
+{
+    NamedTypeDependencyTable table;
+    table["A"] = Literals("Undefined");
+
+    NamedTypeDependencyGraph graph(table);
+    graph.resolve();
+    table = graph.table();
+
+    REQUIRE(table.size() == 2);
+    REQUIRE(table["A"] == Literals("Undefined"));
+    REQUIRE(table.find("Undefined") != table.end());
+    REQUIRE(table["Undefined"].empty());
+
+    REQUIRE_FALSE(graph.isCircular("Undefined"));
+    REQUIRE_FALSE(graph.isCircular("Unknown"));
+}
+
+TEST_CASE("Resolve a long chain of named type dependencies", "[mson][dependency]")
+{
+    NamedTypeDependencyTable table;
+    const int count = 2000;
+
+    for (int i = 0; i < count; ++i) {
+        std::stringstream name, dependency;
+        name << "Type " << i;
+        dependency << "Type " << (i + 1) % count;
+
+        table[name.str()] = Literals(dependency.str().c_str());
+    }
+
+    NamedTypeDependencyGraph graph(table);
+    graph.resolve();
+    table = graph.table();
+
+    REQUIRE(table.size() == count);
+    REQUIRE(table["Type 0"].size() == count);
+    REQUIRE(table["Type 1999"].size() == count);
+    REQUIRE(graph.isCircular("Type 1000"));
+}
+
+TEST_CASE("Add a dependency to the named types depending on the dependent", "[mson][dependency]")
+{
+    NamedTypeDependencyTable table;
+    table["A"] = Literals("B");
+    table["B"] = Literals();
+    table["C"] = Literals("D");
+    table["D"] = Literals();
+
+    NamedTypeDependencyGraph graph(table);
+    graph.resolve();
+
+    REQUIRE(graph.size() == 4);
+    REQUIRE(graph.dependencyCount() == 2);
+
+    graph.addDependency("B", "C");
+
+    REQUIRE(graph.dependsOn("A", "C"));
+    REQUIRE(graph.dependsOn("A", "D"));
+    REQUIRE(graph.dependsOn("B", "D"));
+    REQUIRE_FALSE(graph.dependsOn("C", "B"));
+    REQUIRE(graph.dependencyCount() == 6);
+
+    graph.addDependency("", "A");
+
+    REQUIRE(graph.size() == 5);
+    REQUIRE(graph.contains(""));
+    REQUIRE(graph.table()[""].size() == 4);
+    REQUIRE(graph.dependsOn("", "D"));
+}
+
+TEST_CASE("Compare named type dependency graphs", "[mson][dependency]")
+{
+    NamedTypeDependencyTable table;
+    table["A"] = Literals("B");
+    table["B"] = Literals();
+
+    NamedTypeDependencyGraph graph(table);
+    NamedTypeDependencyGraph same;
+
+    same.add("B");
+    same.add("A");
+    same.addDirectDependency("A", "B");
+
+    REQUIRE(graph == same);
+
+    same.addDependency("B", "A");
+
+    REQUIRE(graph != same);
+    REQUIRE(graph.table() == table);
+}
@@ -0,0 +1,177 @@
+//
+//  test-ParseCache.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdio>
+#include "catch.hpp"
+#include "ParseCache.h"
+#include "Serialization.h"
+
+using namespace snowcrash;
+
+static const mdp::ByteBuffer CacheBlueprint
+    = "FORMAT: 1A\n\n"
+      "# API\n\n"
+      "Overview\n\n"
+      "# Group Notes\n\n"
+      "## Note [/notes/{id}]\n\n"
+      "+ Parameters\n"
+      "    + id: `1` (number, required) - Identifier\n\n"
+      "+ Attributes (Note Base)\n"
+      "    + text: Hello (string)\n\n"
+      "+ Model (application/json)\n\n"
+      "        {\"id\": 1}\n\n"
+      "### Retrieve [GET]\n\n"
+      "+ Response 200\n\n"
+      "    [Note][]\n\n"
+      "### Remove [DELETE]\n\n"
+      "+ Request\n\n"
+      "+ Respons 204\n\n"
+      "# Data Structures\n\n"
+      "## Note Base (object)\n\n"
+      "+ id: 1 (number, required)\n"
+      "+ One Of\n"
+      "    + state: open\n"
+      "    + closed: true (boolean)\n";
+
+/** \return Serialized parse result */
+static mdp::ByteBuffer Serialized(ParseResult<Blueprint>& result)
+{
+    mdp::ByteBuffer data;
+    SerializeParseResult(result, data);
+    return data;
+}
+
+TEST_CASE("Serialize and deserialize a parse result", "[parsecache]")
+{
+    ParseResult<Blueprint> parsed;
+    parse(CacheBlueprint, ExportSourcemapOption, parsed);
+
+    REQUIRE(parsed.report.error.code == Error::OK);
+    REQUIRE(!parsed.report.warnings.empty());
+
+    mdp::ByteBuffer data = Serialized(parsed);
+
+    ParseResult<Blueprint> loaded;
+    REQUIRE(DeserializeParseResult(data, loaded));
+    REQUIRE(Serialized(loaded) == data);
+
+    REQUIRE(loaded.report.warnings.size() == parsed.report.warnings.size());
+    REQUIRE(loaded.report.warnings[0].message == parsed.report.warnings[0].message);
+    REQUIRE(loaded.report.warnings[0].location.size() == parsed.report.warnings[0].location.size());
+
+    REQUIRE(loaded.node.name == "API");
+    REQUIRE(loaded.node.description == parsed.node.description);
+    REQUIRE(loaded.node.content.elements().size() == 2);
+
+    const Element& group = loaded.node.content.elements()[0];
+    REQUIRE(group.element == Element::CategoryElement);
+    REQUIRE(group.attributes.name == "Notes");
+    REQUIRE(group.content.elements().size() == 1);
+
+    const Resource& resource = group.content.elements()[0].content.resource;
+    REQUIRE(resource.uriTemplate == "/notes/{id}");
+    REQUIRE(resource.parameters.size() == 1);
+    REQUIRE(resource.parameters[0].use == RequiredParameterUse);
+    REQUIRE(resource.attributes.typeDefinition.typeSpecification.name.symbol.literal == "Note Base");
+    REQUIRE(resource.actions.size() == 2);
+    REQUIRE(resource.actions[0].examples[0].responses[0].reference.id == "Note");
+    REQUIRE(resource.actions[0].examples[0].responses[0].reference.meta.state == Reference::StateResolved);
+    REQUIRE(resource.actions[0].examples[0].responses[0].body == "{\"id\": 1}\n");
+
+    const Element& dataStructures = loaded.node.content.elements()[1];
+    REQUIRE(dataStructures.content.elements().size() == 1);
+
+    const mson::NamedType& namedType = dataStructures.content.elements()[0].content.dataStructure;
+    REQUIRE(namedType.name.symbol.literal == "Note Base");
+    REQUIRE(namedType.sections[0].content.elements().size() == 2);
+    REQUIRE(namedType.sections[0].content.elements()[1].klass == mson::Element::OneOfClass);
+    REQUIRE(namedType.sections[0].content.elements()[1].content.elements().size() == 2);
+
+    REQUIRE(loaded.sourceMap.name.sourceMap.size() == 1);
+    REQUIRE(loaded.sourceMap.name.sourceMap[0].location == parsed.sourceMap.name.sourceMap[0].location);
+    REQUIRE(loaded.sourceMap.name.sourceMap[0].length == parsed.sourceMap.name.sourceMap[0].length);
+    REQUIRE(loaded.sourceMap.content.elements().collection.size() == 2);
+}
+
+TEST_CASE("Reject truncated or corrupt serialized data", "[parsecache]")
+{
+    ParseResult<Blueprint> parsed;
+    parse(CacheBlueprint, ExportSourcemapOption, parsed);
+
+    mdp::ByteBuffer data = Serialized(parsed);
+
+    ParseResult<Blueprint> truncated;
+    REQUIRE(!DeserializeParseResult(data.substr(0, data.size() / 2), truncated));
+    REQUIRE(truncated.node.content.elements().empty());
+
+    ParseResult<Blueprint> extended;
+    REQUIRE(!DeserializeParseResult(data + '\0', extended));
+
+    ParseResult<Blueprint> corrupt;
+    REQUIRE(!DeserializeParseResult(mdp::ByteBuffer(16, '\xFF'), corrupt));
+}
+
+TEST_CASE("Load a parse result from the cache", "[parsecache]")
+{
+    ParseCache cache("");
+
+    std::string path = cache.entryPath(CacheBlueprint, ExportSourcemapOption);
+    std::remove(path.c_str());
+
+    ParseResult<Blueprint> parsed;
+    REQUIRE(cache.parse(CacheBlueprint, ExportSourcemapOption, parsed) == Error::OK);
+    REQUIRE(cache.misses() == 1);
+    REQUIRE(cache.hits() == 0);
+
+    ParseResult<Blueprint> loaded;
+    REQUIRE(cache.parse(CacheBlueprint, ExportSourcemapOption, loaded) == Error::OK);
+    REQUIRE(cache.misses() == 1);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(Serialized(loaded) == Serialized(parsed));
+
+    // Parallel parsing gives the same result
+    ParseResult<Blueprint> parallel;
+    cache.parse(CacheBlueprint, ExportSourcemapOption | ParallelParsingOption, parallel);
+    REQUIRE(cache.hits() == 2);
+
+    // Other options, source data and versions are different entries
+    ParseResult<Blueprint> other;
+    cache.parse(CacheBlueprint, 0, other);
+    REQUIRE(cache.misses() == 2);
+    REQUIRE(cache.entryPath(CacheBlueprint, 0) != path);
+    REQUIRE(cache.entryPath(CacheBlueprint + "\n", ExportSourcemapOption) != path);
+    REQUIRE(ParseCache("", "2.0").entryPath(CacheBlueprint, ExportSourcemapOption) != path);
+
+    std::remove(path.c_str());
+    std::remove(cache.entryPath(CacheBlueprint, 0).c_str());
+}
+
+TEST_CASE("Parse again when a cache entry is corrupt", "[parsecache]")
+{
+    ParseCache cache("");
+
+    std::string path = cache.entryPath(CacheBlueprint, 0);
+
+    FILE* entry = fopen(path.c_str(), "wb");
+    REQUIRE(entry != NULL);
+    fputs("snowcrash:garbage", entry);
+    fclose(entry);
+
+    ParseResult<Blueprint> result;
+    REQUIRE(cache.parse(CacheBlueprint, 0, result) == Error::OK);
+    REQUIRE(cache.misses() == 1);
+    REQUIRE(result.node.name == "API");
+
+    // The entry is replaced
+    ParseResult<Blueprint> loaded;
+    cache.parse(CacheBlueprint, 0, loaded);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(loaded.node.name == "API");
+
+    std::remove(path.c_str());
+}
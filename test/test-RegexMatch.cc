@@ -35,3 +35,64 @@ TEST_CASE("regexmatch/request-payload", "Match request payload test")
                 "^[Rr]equest([[:space:]]+([A-Za-z0-9_]|[[:space:]])*)?([[:space:]]\\([^\\)]*\\))?$")
         == true);
 }
+
+TEST_CASE("regexmatch/cache", "Compiled expressions are cached")
+{
+    ClearRegexCache();
+
+    RegexCacheStatistics statistics = GetRegexCacheStatistics();
+    REQUIRE(statistics.hits == 0);
+    REQUIRE(statistics.misses == 0);
+    REQUIRE(statistics.size == 0);
+
+    REQUIRE(RegexMatch("GET /resource", "^GET[[:space:]]+/"));
+    REQUIRE(RegexMatch("POST /resource", "^GET[[:space:]]+/") == false);
+    REQUIRE(RegexMatch("GET /", "^GET[[:space:]]+/"));
+
+    statistics = GetRegexCacheStatistics();
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.hits == 2);
+    REQUIRE(statistics.size == 1);
+
+    ClearRegexCache();
+
+    statistics = GetRegexCacheStatistics();
+    REQUIRE(statistics.hits == 0);
+    REQUIRE(statistics.misses == 0);
+    REQUIRE(statistics.size == 0);
+}
+
+TEST_CASE("regexmatch/cache-capture", "Cached expressions capture groups")
+{
+    ClearRegexCache();
+
+    CaptureGroups groups;
+    REQUIRE(RegexCapture("GET /resource", "^(GET|POST)[[:space:]]+(/.*)$", groups, 3));
+    REQUIRE(groups.size() == 3);
+    REQUIRE(groups[1] == "GET");
+    REQUIRE(groups[2] == "/resource");
+
+    REQUIRE(RegexCapture("POST /", "^(GET|POST)[[:space:]]+(/.*)$", groups, 3));
+    REQUIRE(groups.size() == 3);
+    REQUIRE(groups[1] == "POST");
+    REQUIRE(groups[2] == "/");
+
+    REQUIRE(RegexCapture("PUT /", "^(GET|POST)[[:space:]]+(/.*)$", groups, 3) == false);
+    REQUIRE(RegexCaptureFirst("POST /", "^(GET|POST)[[:space:]]+(/.*)$") == "POST");
+
+    RegexCacheStatistics statistics = GetRegexCacheStatistics();
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.hits == 3);
+}
+
+TEST_CASE("regexmatch/cache-invalid", "Invalid expression is cached as a failure")
+{
+    ClearRegexCache();
+
+    REQUIRE(RegexMatch("foo", "(foo") == false);
+    REQUIRE(RegexMatch("foo", "(foo") == false);
+
+    RegexCacheStatistics statistics = GetRegexCacheStatistics();
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.hits == 1);
+}
@@ -7,6 +7,16 @@
 //
 
 #include "snowcrashtest.h"
+#include "Signature.h"
+#include "ActionParser.h"
+#include "AssetParser.h"
+#include "HeadersParser.h"
+#include "PayloadParser.h"
+#include "ParametersParser.h"
+#include "ResourceParser.h"
+#include "ResourceGroupParser.h"
+#include "MSONTypeSectionParser.h"
+#include "DataStructureGroupParser.h"
 
 static const mdp::ByteBuffer PropertySignatureFixture = "id: 42 (yes, no) - a good message";
 static const mdp::ByteBuffer EscapedPropertySignatureFixture = "`*id*(data):3`: `42` (yes, no) - a good message";
@@ -536,3 +546,170 @@ TEST_CASE("Identifier with an underscore", "[signature]")
     REQUIRE(signature.content.empty());
     REQUIRE(signature.remainingContent.empty());
 }
+
+/** Recognize a keyword signature by trying every section processor in turn */
+static SectionType ReferenceKeywordSignature(const mdp::MarkdownNodeIterator& node)
+{
+    SectionType type = UndefinedSectionType;
+
+#define REFERENCE_TYPECHECK(T)                                                                                         \
+    if ((type = SectionProcessor<T>::sectionType(node)) != UndefinedSectionType)                                      \
+        return type;
+
+    REFERENCE_TYPECHECK(mson::TypeSection)
+    REFERENCE_TYPECHECK(mson::Mixin)
+    REFERENCE_TYPECHECK(mson::OneOf)
+    REFERENCE_TYPECHECK(Headers)
+    REFERENCE_TYPECHECK(Asset)
+    REFERENCE_TYPECHECK(Attributes)
+    REFERENCE_TYPECHECK(Payload)
+    REFERENCE_TYPECHECK(Values)
+    REFERENCE_TYPECHECK(Parameters)
+    REFERENCE_TYPECHECK(Relation)
+    REFERENCE_TYPECHECK(Resource)
+    REFERENCE_TYPECHECK(Action)
+    REFERENCE_TYPECHECK(ResourceGroup)
+    REFERENCE_TYPECHECK(DataStructureGroup)
+
+#undef REFERENCE_TYPECHECK
+
+    return type;
+}
+
+/** \return Single-node lists of keyword signature variants, in every node type */
+static std::vector<mdp::MarkdownNodes> KeywordSignatureNodes()
+{
+    const char* signatures[] = { "Attribute", "Attributes", "Attributes (Note)", "Attributes(object)", "Body",
+        "Data Structure", "Data Structures", "Default", "Default: 42", "GET", "GET /notes", "GET/notes", "Group Notes",
+        "Header", "Headers", "Include Note", "Items", "Members", "Model", "Model (application/json)", "Note Model",
+        "Note model (text/plain)", "One Of", "Parameter", "Parameters", "Properties", "Relation: self", "Request",
+        "Request Note (application/json)", "Requests", "Response", "Response 200", "Response 201 (text/plain)",
+        "Sample", "Sample: 42", "Schema", "Values", "/notes", "/notes/{id}", "Note [/notes]", "Notes [GET /notes]",
+        "Create a Note [POST]", "Create a Note [POST /notes]", "Note [POST notes]", "PROPPATCH /x", "UNLOCK /x",
+        "MKCOL", "Group", "Data", "One", "Include", "Relation", "Relation : self", "Modeling", "Amodel",
+        "id: 42 (number)", "Note", "content is the king", "", "[Note][]", "+", "`Body`", "_Body_" };
+
+    const char* prefixes[] = { "", " ", "\t", "\n", " \n\t", "x" };
+    const char* suffixes[] = { "", " ", "\n", "\nBody", "s", "X", ":", " 42", " (object)", " [/x]", "\n+ Body" };
+
+    const mdp::MarkdownNodeType nodeTypes[] = { mdp::HeaderMarkdownNodeType, mdp::ListItemMarkdownNodeType,
+        mdp::ParagraphMarkdownNodeType, mdp::CodeMarkdownNodeType };
+
+    std::vector<mdp::MarkdownNodes> result;
+
+    for (size_t i = 0; i < sizeof(signatures) / sizeof(signatures[0]); ++i) {
+        for (size_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); ++p) {
+            for (size_t s = 0; s < sizeof(suffixes) / sizeof(suffixes[0]); ++s) {
+                for (size_t c = 0; c < 3; ++c) {
+
+                    mdp::ByteBuffer signature = mdp::ByteBuffer(prefixes[p]) + signatures[i] + suffixes[s];
+
+                    // Original, lower-cased and upper-cased signature
+                    if (c == 1)
+                        std::transform(signature.begin(), signature.end(), signature.begin(), ::tolower);
+                    else if (c == 2)
+                        std::transform(signature.begin(), signature.end(), signature.begin(), ::toupper);
+
+                    for (size_t t = 0; t < sizeof(nodeTypes) / sizeof(nodeTypes[0]); ++t) {
+
+                        mdp::MarkdownNodes nodes;
+                        mdp::MarkdownNode node(nodeTypes[t], NULL, signature);
+
+                        if (nodeTypes[t] == mdp::ListItemMarkdownNodeType) {
+                            node.text.clear();
+
+                            // List item signature is in its first paragraph, possibly with nested sections
+                            mdp::MarkdownNode paragraph(mdp::ParagraphMarkdownNodeType, NULL, signature);
+                            mdp::MarkdownNode nested(mdp::ListItemMarkdownNodeType);
+                            nested.children().push_back(mdp::MarkdownNode(mdp::ParagraphMarkdownNodeType, NULL, "Body"));
+
+                            node.children().push_back(paragraph);
+
+                            if (s % 2)
+                                node.children().push_back(nested);
+                        }
+
+                        nodes.push_back(node);
+                        result.push_back(nodes);
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+TEST_CASE("Keyword signature matches regex recognition", "[signature]")
+{
+    std::vector<mdp::MarkdownNodes> variants = KeywordSignatureNodes();
+    size_t recognized = 0;
+
+    for (std::vector<mdp::MarkdownNodes>::iterator it = variants.begin(); it != variants.end(); ++it) {
+
+        SectionType expected = ReferenceKeywordSignature(it->begin());
+
+        INFO("signature: '" << it->front().text << "', node type: " << it->front().type);
+        REQUIRE(SectionKeywordSignature(it->begin()) == expected);
+
+        if (expected != UndefinedSectionType)
+            ++recognized;
+    }
+
+    // Make sure the fixture exercises the recognizers
+    REQUIRE(recognized > 1000);
+}
+
+TEST_CASE("Keyword candidates include every recognizing section", "[signature]")
+{
+    std::vector<mdp::MarkdownNodes> variants = KeywordSignatureNodes();
+
+    for (std::vector<mdp::MarkdownNodes>::iterator it = variants.begin(); it != variants.end(); ++it) {
+
+        const mdp::MarkdownNodeIterator node = it->begin();
+        KeywordCandidates candidates = SectionKeywordCandidates(node);
+
+        INFO("signature: '" << node->text << "', node type: " << node->type);
+
+#define REQUIRE_CANDIDATE(T, C)                                                                                        \
+    if (SectionProcessor<T>::sectionType(node) != UndefinedSectionType)                                               \
+        REQUIRE((candidates & C) != 0);
+
+        REQUIRE_CANDIDATE(mson::TypeSection, TypeSectionKeywordCandidate)
+        REQUIRE_CANDIDATE(mson::Mixin, MixinKeywordCandidate)
+        REQUIRE_CANDIDATE(mson::OneOf, OneOfKeywordCandidate)
+        REQUIRE_CANDIDATE(Headers, HeadersKeywordCandidate)
+        REQUIRE_CANDIDATE(Asset, AssetKeywordCandidate)
+        REQUIRE_CANDIDATE(Attributes, AttributesKeywordCandidate)
+        REQUIRE_CANDIDATE(Payload, PayloadKeywordCandidate)
+        REQUIRE_CANDIDATE(Values, ValuesKeywordCandidate)
+        REQUIRE_CANDIDATE(Parameters, ParametersKeywordCandidate)
+        REQUIRE_CANDIDATE(Relation, RelationKeywordCandidate)
+        REQUIRE_CANDIDATE(Resource, ResourceKeywordCandidate)
+        REQUIRE_CANDIDATE(Action, ActionKeywordCandidate)
+        REQUIRE_CANDIDATE(ResourceGroup, ResourceGroupKeywordCandidate)
+        REQUIRE_CANDIDATE(DataStructureGroup, DataStructureGroupKeywordCandidate)
+
+#undef REQUIRE_CANDIDATE
+    }
+}
+
+TEST_CASE("Nested keyword sections are legal in their parent", "[signature]")
+{
+    mdp::MarkdownNodes nodes;
+    mdp::MarkdownNode header(mdp::HeaderMarkdownNodeType, NULL, "Retrieve a Note [GET]");
+    mdp::MarkdownNode item(mdp::ListItemMarkdownNodeType);
+    item.children().push_back(mdp::MarkdownNode(mdp::ParagraphMarkdownNodeType, NULL, "Response 200"));
+    nodes.push_back(header);
+    nodes.push_back(item);
+
+    const mdp::MarkdownNodeIterator action = nodes.begin();
+    const mdp::MarkdownNodeIterator response = action + 1;
+
+    REQUIRE(SectionProcessor<Resource>::nestedSectionType(action) == ActionSectionType);
+    REQUIRE(SectionProcessor<ResourceGroup>::nestedSectionType(action) == UndefinedSectionType);
+
+    REQUIRE(SectionProcessor<Action>::nestedSectionType(response) == ResponseBodySectionType);
+    REQUIRE(SectionProcessor<Payload>::nestedSectionType(response) == UndefinedSectionType);
+    REQUIRE(SectionProcessor<Parameter>::nestedSectionType(response) == UndefinedSectionType);
+}
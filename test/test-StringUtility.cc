@@ -112,3 +112,61 @@ TEST_CASE("Get trim info", "[utility]")
     REQUIRE(std::get<0>(range) == 3);
     REQUIRE(std::get<1>(range) == 3);
 }
+
+TEST_CASE("View of a string", "[utility]")
+{
+    std::string s = "abc def";
+    StringView view(s);
+
+    REQUIRE(view.length() == 7);
+    REQUIRE(view.substr(4) == StringView("def"));
+    REQUIRE(view.substr(4, 1).str() == "d");
+    REQUIRE(view.substr(10).empty());
+    REQUIRE(view.find(' ') == 3);
+    REQUIRE(view.find(StringView("de")) == 4);
+    REQUIRE(view.find('x') == std::string::npos);
+    REQUIRE(view.startsWith(StringView("abc")));
+    REQUIRE_FALSE(view.startsWith(StringView("abd")));
+    REQUIRE(TrimStringView(StringView(" \t abc \n")) == StringView("abc"));
+    REQUIRE(TrimStringView(StringView("  ")).empty());
+}
+
+TEST_CASE("Retrieve escaped string without copying", "[utility]")
+{
+    std::string s = "a```b```cd";
+    StringView subject(s);
+
+    REQUIRE(RetrieveEscapedView(subject, 1) == StringView("```b```"));
+    REQUIRE(subject == StringView("cd"));
+    REQUIRE(subject.data() == s.data() + 8);
+
+    s = "`` `code` ``";
+    subject = s;
+    REQUIRE(StripBackticksView(subject) == StringView("`code`"));
+
+    s = "site_admin";
+    subject = s;
+    REQUIRE(RetrieveEscapedView(subject, 4).empty());
+    REQUIRE(subject == StringView("site_admin"));
+}
+
+TEST_CASE("Get first line without copying", "[utility]")
+{
+    std::string s = "first\nsecond\nthird";
+    StringView remaining;
+
+    REQUIRE(GetFirstLineView(s, remaining) == StringView("first"));
+    REQUIRE(remaining == StringView("second\nthird"));
+
+    std::string r = "unchanged";
+    REQUIRE(GetFirstLine("single", r) == "single");
+    REQUIRE(r == "unchanged");
+}
+
+TEST_CASE("Replace all occurrences of a string", "[utility]")
+{
+    REQUIRE(ReplaceString("a-b-c", "-", "--") == "a--b--c");
+    REQUIRE(ReplaceString("aaa", "aa", "b") == "ba");
+    REQUIRE(ReplaceString("abc", "x", "y") == "abc");
+    REQUIRE(ReplaceString("abc", "", "y") == "abc");
+}
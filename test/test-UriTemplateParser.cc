@@ -331,3 +331,19 @@ TEST_CASE("Parse uri template for consistent invalid character warning",
     REQUIRE(result2.report.warnings.size() == 1);
     REQUIRE(result2.report.warnings[0].message == "URI template expression \"$a,b,c\" contains invalid characters. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters");
 }
+
+TEST_CASE("Keep message formats and arguments of URI template warnings", "[uritemplateparser]")
+{
+    const snowcrash::URITemplate uri = "http://www.test.com/{a-b}[2]";
+
+    ParsedURITemplate result;
+    URITemplateWarnings warnings;
+
+    URITemplateParser::parse(uri, result, warnings);
+
+    REQUIRE(result.report.warnings.empty());
+    REQUIRE(warnings.size() == 2);
+    REQUIRE(warnings[0].expression.empty());
+    REQUIRE(std::string(warnings[1].format).find("\"%s\" contains hyphens") != std::string::npos);
+    REQUIRE(warnings[1].expression == "a-b");
+}
@@ -8,6 +8,7 @@
 
 #include "snowcrash.h"
 #include "snowcrashtest.h"
+#include "WarningUtility.h"
 
 using namespace snowcrash;
 using namespace snowcrashtest;
@@ -91,3 +92,159 @@ TEST_CASE("Warn about unsupported uri template in abbreviated blueprint", "[warn
     REQUIRE(blueprint.report.warnings.size() == 1);
     REQUIRE(blueprint.report.warnings[0].code == URIWarning);
 }
+
+static const mdp::ByteBuffer WarningsBlueprint
+    = "FORMAT: 1A\n"
+      "\n"
+      "# Příliš žluťoučký API\n"
+      "\n"
+      "## GET /řád/{id}{?a,    b}\n"
+      "\n"
+      "+ Response 200\n"
+      "\n"
+      "        Ahoj\n"
+      "\n"
+      "+ Respons 204\n"
+      "\n"
+      "## Kůň [/kun]\n"
+      "\n"
+      "### Update [PATCH]\n"
+      "\n"
+      "+ Request\n";
+
+TEST_CASE("Format deferred warnings", "[warnings]")
+{
+    ParseResult<Blueprint> expected;
+    parse(WarningsBlueprint, 0, expected);
+
+    REQUIRE(expected.report.warnings.size() > 2);
+
+    ParseResult<Blueprint> blueprint;
+    parse(WarningsBlueprint, DeferWarningsOption, blueprint);
+
+    REQUIRE(blueprint.report.warnings.size() == expected.report.warnings.size());
+    REQUIRE(blueprint.report.warnings[0].isDeferred());
+
+    // Unformatted warnings leave the message and the location empty
+    REQUIRE(blueprint.report.warnings[0].message.empty());
+    REQUIRE(blueprint.report.warnings[0].location.empty());
+    REQUIRE(!blueprint.report.warnings[0].byteLocation.empty());
+
+    FormatWarnings(blueprint.report, WarningsBlueprint);
+
+    for (size_t i = 0; i < expected.report.warnings.size(); ++i) {
+        const Warning& warning = blueprint.report.warnings[i];
+
+        REQUIRE(!warning.isDeferred());
+        REQUIRE(warning.messageArguments.empty());
+        REQUIRE(warning.byteLocation.empty());
+        REQUIRE(warning.code == expected.report.warnings[i].code);
+        REQUIRE(warning.message == expected.report.warnings[i].message);
+        REQUIRE(warning.location.size() == expected.report.warnings[i].location.size());
+
+        for (size_t j = 0; j < warning.location.size(); ++j) {
+            REQUIRE(warning.location[j].location == expected.report.warnings[i].location[j].location);
+            REQUIRE(warning.location[j].length == expected.report.warnings[i].location[j].length);
+        }
+    }
+}
+
+TEST_CASE("Defer URI template warnings", "[warnings]")
+{
+    mdp::ByteBuffer source
+        = "# API\n"
+          "## Kůň [/kůň/{id}[2]]\n";
+
+    ParseResult<Blueprint> expected;
+    parse(source, 0, expected);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, DeferWarningsOption, blueprint);
+
+    REQUIRE(expected.report.warnings.size() == 1);
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(blueprint.report.warnings[0].code == URIWarning);
+    REQUIRE(blueprint.report.warnings[0].isDeferred());
+
+    FormatWarnings(blueprint.report, source);
+
+    const Warning& warning = blueprint.report.warnings[0];
+
+    REQUIRE(warning.message == expected.report.warnings[0].message);
+    REQUIRE(warning.location.size() == 1);
+    REQUIRE(warning.location[0].location == expected.report.warnings[0].location[0].location);
+    REQUIRE(warning.location[0].length == expected.report.warnings[0].location[0].length);
+}
+
+TEST_CASE("Keep the first warnings up to the warning limit", "[warnings]")
+{
+    ParseResult<Blueprint> expected;
+    parse(WarningsBlueprint, 0, expected);
+
+    ParseLimits limits;
+    limits.warningLimit = 2;
+
+    ParseResult<Blueprint> blueprint;
+    parse(WarningsBlueprint, 0, blueprint, limits);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 2);
+    REQUIRE(blueprint.report.warnings[0].message == expected.report.warnings[0].message);
+    REQUIRE(blueprint.report.warnings[1].message == expected.report.warnings[1].message);
+}
+
+TEST_CASE("Do not record warnings over the warning limit", "[warnings]")
+{
+    mdp::ByteBuffer source = "# API\n";
+    Blueprint blueprint;
+    SectionParserData pd(0, source, blueprint);
+    mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+    pd.limits.warningLimit = 2;
+
+    mdp::BytesRangeSet sourceMap;
+    sourceMap.push_back(mdp::BytesRange(0, 5));
+
+    Report report;
+    ReportWarning(report, pd, EmptyDefinitionWarning, sourceMap, "first %s", "warning");
+    ReportWarning(report, pd, EmptyDefinitionWarning, sourceMap, "second %s", "warning");
+    ReportWarning(report, pd, EmptyDefinitionWarning, sourceMap, "third %s", "warning");
+
+    REQUIRE(report.warnings.size() == 2);
+    REQUIRE(report.warnings[1].message == "second warning");
+}
+
+TEST_CASE("Do not report suppressed warnings", "[warnings]")
+{
+    ParseResult<Blueprint> expected;
+    parse(WarningsBlueprint, 0, expected);
+
+    ParseLimits limits;
+    limits.suppressedWarnings = WarningCodeMask(URIWarning) | WarningCodeMask(EmptyDefinitionWarning);
+
+    ParseResult<Blueprint> blueprint;
+    parse(WarningsBlueprint, 0, blueprint, limits);
+
+    Warnings unsuppressed;
+
+    for (Warnings::const_iterator it = expected.report.warnings.begin(); it != expected.report.warnings.end(); ++it) {
+        if (it->code != URIWarning && it->code != EmptyDefinitionWarning)
+            unsuppressed.push_back(*it);
+    }
+
+    REQUIRE(unsuppressed.size() < expected.report.warnings.size());
+    REQUIRE(blueprint.report.warnings.size() == unsuppressed.size());
+
+    for (size_t i = 0; i < unsuppressed.size(); ++i) {
+        REQUIRE(blueprint.report.warnings[i].code == unsuppressed[i].code);
+        REQUIRE(blueprint.report.warnings[i].message == unsuppressed[i].message);
+    }
+}
+
+TEST_CASE("Format a warning message", "[warnings]")
+{
+    std::string arguments;
+    AppendWarningArguments(arguments, "a%s", 'b', 42, std::string("c"));
+
+    REQUIRE(FormatWarningMessage("%s, %s, %s%% and %s", arguments) == "a%s, b, 42% and c");
+    REQUIRE(FormatWarningMessage("no arguments %s", std::string()) == "no arguments ");
+}
@@ -0,0 +1,72 @@
+//
+//  test-WorkerPool.cc
+//  snowcrash
+//
+//  Created by Apiary Inc. on 10/18/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "catch.hpp"
+#include "WorkerPool.h"
+
+using namespace snowcrash;
+
+TEST_CASE("Run every task once", "[workerpool]")
+{
+    std::vector<std::atomic<int> > runs(1000);
+
+    for (size_t i = 0; i < runs.size(); ++i)
+        runs[i] = 0;
+
+    RunTasks(runs.size(), 4, [&](size_t i) { ++runs[i]; });
+
+    for (size_t i = 0; i < runs.size(); ++i)
+        REQUIRE(runs[i] == 1);
+}
+
+TEST_CASE("Run tasks on the calling thread with a single worker", "[workerpool]")
+{
+    std::thread::id caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+
+    RunTasks(10, 1, [&](size_t i) {
+        REQUIRE(std::this_thread::get_id() == caller);
+        order.push_back(i);
+    });
+
+    REQUIRE(order.size() == 10);
+
+    for (size_t i = 0; i < order.size(); ++i)
+        REQUIRE(order[i] == i);
+}
+
+TEST_CASE("Run no tasks", "[workerpool]")
+{
+    bool called = false;
+
+    RunTasks(0, 0, [&](size_t i) { called = true; });
+
+    REQUIRE(!called);
+    REQUIRE(DefaultWorkerCount() >= 1);
+}
+
+TEST_CASE("Rethrow exception thrown by a task", "[workerpool]")
+{
+    std::atomic<int> finished(0);
+
+    REQUIRE_THROWS_AS(RunTasks(100,
+                          4,
+                          [&](size_t i) {
+                              if (i == 10)
+                                  throw std::runtime_error("task failed");
+
+                              ++finished;
+                          }),
+        std::runtime_error);
+
+    REQUIRE(finished < 100);
+}
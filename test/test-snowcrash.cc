@@ -7,8 +7,12 @@
 //
 
 #define CATCH_CONFIG_MAIN
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include "snowcrashtest.h"
 #include "snowcrash.h"
+#include "MappedFile.h"
 
 using namespace snowcrash;
 using namespace snowcrashtest;
@@ -782,3 +786,1188 @@ TEST_CASE("Parse blueprint with mismatched adapter blocks", "[blueprint]")
     REQUIRE(blueprint.report.warnings.empty());
     SourceMapHelper::check(blueprint.report.error.location, 42, 24);
 }
+
+/** Textual summary of a parse result used to compare two results */
+static void DumpPayloads(const Collection<Payload>::type& payloads, std::stringstream& s)
+{
+    for (Collection<Payload>::const_iterator it = payloads.begin(); it != payloads.end(); ++it) {
+        s << "    payload " << it->name << "|" << it->description << "|" << it->body << "|" << it->schema << "|"
+          << it->headers.size() << "|" << it->attributes.sections.size() << "|" << it->reference.id << "|"
+          << it->reference.meta.state << "\n";
+    }
+}
+
+static void DumpReport(const Report& report, std::stringstream& s)
+{
+    s << "error " << report.error.code << " " << report.error.message << "\n";
+
+    for (Warnings::const_iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
+        s << "warning " << it->code << " " << it->message;
+
+        for (mdp::CharactersRangeSet::const_iterator range = it->location.begin(); range != it->location.end();
+             ++range)
+            s << " " << range->location << ":" << range->length;
+
+        s << "\n";
+    }
+}
+
+static std::string DumpParseResult(const ParseResult<Blueprint>& result)
+{
+    std::stringstream s;
+
+    DumpReport(result.report, s);
+
+    s << "blueprint " << result.node.name << "|" << result.node.description << "\n";
+
+    for (Elements::const_iterator it = result.node.content.elements().begin();
+         it != result.node.content.elements().end();
+         ++it) {
+
+        s << "element " << it->element << "|" << it->category << "|" << it->attributes.name << "\n";
+
+        for (Elements::const_iterator subIt = it->content.elements().begin(); subIt != it->content.elements().end();
+             ++subIt) {
+
+            s << "  element " << subIt->element << "|" << subIt->content.copy << "|"
+              << subIt->content.dataStructure.name.symbol.literal << "|"
+              << subIt->content.dataStructure.sections.size() << "\n";
+
+            const Resource& resource = subIt->content.resource;
+            s << "  resource " << resource.name << "|" << resource.uriTemplate << "|" << resource.description << "|"
+              << resource.model.body << "|" << resource.attributes.name.symbol.literal << "|"
+              << resource.attributes.sections.size() << "|" << resource.parameters.size() << "\n";
+
+            for (Actions::const_iterator action = resource.actions.begin(); action != resource.actions.end();
+                 ++action) {
+
+                s << "   action " << action->method << "|" << action->name << "|" << action->description << "\n";
+
+                for (TransactionExamples::const_iterator example = action->examples.begin();
+                     example != action->examples.end();
+                     ++example) {
+                    DumpPayloads(example->requests, s);
+                    DumpPayloads(example->responses, s);
+                }
+            }
+        }
+    }
+
+    s << "sourcemap " << result.sourceMap.content.elements().collection.size();
+
+    for (Collection<SourceMap<Element> >::const_iterator it = result.sourceMap.content.elements().collection.begin();
+         it != result.sourceMap.content.elements().collection.end();
+         ++it) {
+        s << " " << it->content.elements().collection.size();
+    }
+
+    s << "\n";
+
+    return s.str();
+}
+
+static void CheckParallelParsing(const mdp::ByteBuffer& source)
+{
+    ParseResult<Blueprint> sequential;
+    parse(source, ExportSourcemapOption, sequential);
+
+    ParseResult<Blueprint> parallel;
+    parse(source, ExportSourcemapOption | ParallelParsingOption, parallel);
+
+    REQUIRE(DumpParseResult(parallel) == DumpParseResult(sequential));
+}
+
+TEST_CASE("Parallel parsing of independent groups", "[parser][parallel]")
+{
+    mdp::ByteBuffer source
+        = "FORMAT: 1A\n\n"
+          "# API\n\n"
+          "# /intro\n"
+          "## GET\n"
+          "+ Response 200\n\n"
+          "# Group A\n"
+          "Group A description\n\n"
+          "## Note [/notes/{id}]\n"
+          "+ Parameters\n"
+          "    + id (string)\n\n"
+          "+ Model (text/plain)\n\n"
+          "        note\n\n"
+          "### Retrieve [GET]\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "### Update [PUT]\n"
+          "+ Request\n\n"
+          "    [Tag][]\n\n"
+          "+ Response 204\n\n"
+          "# Group B\n\n"
+          "## Tag [/tags/{id}]\n"
+          "+ Model (text/plain)\n\n"
+          "        tag\n\n"
+          "### Retrieve [GET]\n"
+          "+ Response 200\n\n"
+          "    [Tag][]\n\n"
+          "### Remove [DELETE]\n"
+          "+ Respons 204\n\n"
+          "# Data Structures\n\n"
+          "## User (object)\n"
+          "+ name: Pavan (string)\n"
+          "+ address (Address)\n\n"
+          "## Address (object)\n"
+          "+ city: Prague\n";
+
+    CheckParallelParsing(source);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, ParallelParsingOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.node.content.elements().size() == 4);
+    REQUIRE(blueprint.node.content.elements().at(1).attributes.name == "A");
+    REQUIRE(blueprint.node.content.elements().at(2).attributes.name == "B");
+    REQUIRE(blueprint.node.content.elements().at(3).category == Element::DataStructureGroupCategory);
+}
+
+TEST_CASE("Parallel parsing with dependencies between groups", "[parser][parallel]")
+{
+    // Model defined in an earlier group
+    CheckParallelParsing(
+        "# API\n\n"
+        "# Group A\n"
+        "## Note [/notes]\n"
+        "+ Model (text/plain)\n\n"
+        "        note\n\n"
+        "### List [GET]\n"
+        "+ Response 200\n\n"
+        "# Group B\n"
+        "## Tags [/tags]\n"
+        "### List [GET]\n"
+        "+ Response 200\n\n"
+        "    [Note][]\n");
+
+    // Duplicate resources and groups
+    CheckParallelParsing(
+        "# API\n\n"
+        "# Group A\n"
+        "## /notes\n"
+        "### GET\n"
+        "+ Response 200\n\n"
+        "# Group B\n"
+        "## /notes\n"
+        "### POST\n"
+        "+ Response 201\n\n"
+        "# Group A\n"
+        "## /tags\n"
+        "### GET\n"
+        "+ Response 200\n");
+
+    // Duplicate named types and models
+    CheckParallelParsing(
+        "# API\n\n"
+        "# Group A\n"
+        "## User [/user]\n"
+        "+ Attributes\n"
+        "    + name (string)\n\n"
+        "+ Model\n\n"
+        "        user\n\n"
+        "# Group B\n"
+        "## User [/users/{id}]\n"
+        "+ Model\n\n"
+        "        another user\n\n"
+        "# Data Structures\n"
+        "## User\n"
+        "+ id (number)\n");
+
+    // Mixins checked for circular references
+    CheckParallelParsing(
+        "# API\n\n"
+        "# Data Structures\n"
+        "## A (object)\n"
+        "+ b (B)\n\n"
+        "# Data Structures\n"
+        "## B (object)\n"
+        "+ Include A\n");
+
+    // Error in one of the groups
+    CheckParallelParsing(
+        "# API\n\n"
+        "# Group A\n"
+        "## /notes\n"
+        "+ Model\n\n"
+        "        note\n\n"
+        "# Group B\n"
+        "## /tags\n"
+        "### GET\n"
+        "+ Response 200\n");
+}
+
+/** Check the segments of the source are joined without parsing it sequentially */
+static void CheckJoinedSegments(const mdp::ByteBuffer& source, size_t segmentCount)
+{
+    ParseResult<Blueprint> sequential;
+    parse(source, ExportSourcemapOption, sequential);
+
+    // Segments are cached only if they are merged
+    ParseState state;
+    ParseResult<Blueprint> parallel;
+    parse(source, ExportSourcemapOption | ParallelParsingOption, parallel, state);
+
+    REQUIRE(state.segmentCache.segments.size() == segmentCount);
+    REQUIRE(DumpParseResult(parallel) == DumpParseResult(sequential));
+}
+
+TEST_CASE("Join groups depending on the earlier groups", "[parser][parallel]")
+{
+    // Models defined in an earlier group, one of them referenced before being defined
+    CheckJoinedSegments(
+        "# API\n\n"
+        "# Group A\n"
+        "## Note [/notes]\n"
+        "+ Model (text/plain)\n\n"
+        "        note\n\n"
+        "### List [GET]\n"
+        "+ Response 200\n\n"
+        "    [Tag][]\n\n"
+        "# Group B\n"
+        "## Tag [/tags]\n"
+        "+ Model (text/plain)\n\n"
+        "        tag\n\n"
+        "### List [GET]\n"
+        "+ Response 200\n\n"
+        "    [Note][]\n",
+        2);
+
+    // Duplicate groups, resources and named types
+    CheckJoinedSegments(
+        "# API\n\n"
+        "# Group A\n"
+        "## User [/users]\n"
+        "+ Attributes\n"
+        "    + name (string)\n\n"
+        "### GET\n"
+        "+ Response 200\n\n"
+        "# Group A\n"
+        "## User [/users]\n"
+        "+ Attributes\n"
+        "    + id (number)\n\n"
+        "### POST\n"
+        "+ Response 201\n\n"
+        "# Data Structures\n"
+        "## User\n"
+        "+ id (number)\n",
+        3);
+
+    // Mixin of a named type of an earlier group
+    CheckJoinedSegments(
+        "# API\n\n"
+        "# Data Structures\n"
+        "## A (object)\n"
+        "+ a (string)\n\n"
+        "# Data Structures\n"
+        "## B (object)\n"
+        "+ Include A\n"
+        "+ b (A)\n",
+        2);
+}
+
+/** Check reparsing after each of the edits gives the same result as parsing the edited source */
+static void CheckReparse(mdp::ByteBuffer source, const std::vector<SourceEdit>& edits)
+{
+    ParseState state;
+    ParseResult<Blueprint> reparsed;
+    parse(source, ExportSourcemapOption, reparsed, state);
+
+    // Reparsed into a result other than the previous one
+    ParseState freshState;
+    ParseResult<Blueprint> initial;
+    parse(source, ExportSourcemapOption, initial, freshState);
+
+    for (std::vector<SourceEdit>::const_iterator it = edits.begin(); it != edits.end(); ++it) {
+
+        source.replace(it->location, it->length, it->text);
+
+        reparse(*it, state, reparsed);
+
+        ParseResult<Blueprint> fresh;
+        reparse(*it, freshState, fresh);
+
+        ParseResult<Blueprint> parsed;
+        parse(source, ExportSourcemapOption, parsed);
+
+        REQUIRE(state.source == source);
+        REQUIRE(DumpParseResult(reparsed) == DumpParseResult(parsed));
+        REQUIRE(DumpParseResult(fresh) == DumpParseResult(parsed));
+    }
+}
+
+static const char* const ReparseSource
+    = "FORMAT: 1A\n\n"
+      "# Notes API\n"
+      "Notes with a description, příliš žluťoučký kůň.\n\n"
+      "# Group Notes\n"
+      "## Note [/notes/{id}]\n"
+      "+ Model (text/plain)\n\n"
+      "        note\n\n"
+      "### Retrieve [GET]\n"
+      "+ Response 200\n\n"
+      "    [Note][]\n\n"
+      "# Group Tags\n"
+      "## Tag [/tags/{id}]\n"
+      "### Remove [DELETE]\n"
+      "+ Respons 204\n\n"
+      "# Group Users\n"
+      "## User [/users/{id}]\n"
+      "+ Attributes (Person)\n\n"
+      "### Retrieve [GET]\n"
+      "+ Response 200\n\n"
+      "# Data Structures\n"
+      "## Person (object)\n"
+      "+ name: Zdeněk (string)\n";
+
+static size_t Find(const char* text)
+{
+    return mdp::ByteBuffer(ReparseSource).find(text);
+}
+
+TEST_CASE("Reparse edited source", "[parser][reparse]")
+{
+    std::vector<SourceEdit> edits;
+
+    // Action renamed, then a response fixed
+    edits.push_back(SourceEdit(Find("Remove [DELETE]"), 6, "Delete"));
+    edits.push_back(SourceEdit(Find("Respons 204") + 7, 0, "e"));
+
+    // Group split into two
+    edits.push_back(SourceEdit(Find("## Tag ["), 0, "# Group Tags 2\n"));
+
+    // Description with multi-byte characters before the groups
+    edits.push_back(SourceEdit(Find("příliš"), 0, "ěščř "));
+
+    CheckReparse(ReparseSource, edits);
+
+    // Groups not touched by the edit are kept
+    ParseState state;
+    ParseResult<Blueprint> blueprint;
+    parse(ReparseSource, 0, blueprint, state);
+
+    reparse(edits.front(), state, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(state.segmentCache.segments.size() == 4);
+}
+
+TEST_CASE("Reparse edits of groups and named types", "[parser][reparse]")
+{
+    std::vector<SourceEdit> edits;
+
+    // Group header removed
+    edits.push_back(SourceEdit(Find("# Group Users\n"), 14, ""));
+    CheckReparse(ReparseSource, edits);
+
+    // Named type changed
+    edits.clear();
+    edits.push_back(SourceEdit(Find("(object)"), 8, "(array)"));
+    CheckReparse(ReparseSource, edits);
+
+    // Model removed and restored
+    edits.clear();
+    edits.push_back(SourceEdit(Find("+ Model"), 1, "-"));
+    edits.push_back(SourceEdit(Find("+ Model"), 1, "+"));
+    CheckReparse(ReparseSource, edits);
+
+    // Error introduced and fixed
+    edits.clear();
+    edits.push_back(SourceEdit(Find("## Note [/notes/{id}]"), 21, "## /notes"));
+    edits.push_back(SourceEdit(Find("## Note [/notes/{id}]"), 9, "## Note [/notes/{id}]"));
+    CheckReparse(ReparseSource, edits);
+
+    // Unsupported characters, whole source replaced
+    edits.clear();
+    edits.push_back(SourceEdit(Find("# Group Tags"), 0, "\t"));
+    edits.push_back(SourceEdit(Find("# Group Tags"), 1, ""));
+    edits.push_back(SourceEdit(0, mdp::ByteBuffer(ReparseSource).length(), ""));
+    edits.push_back(SourceEdit(0, 0, ReparseSource));
+    CheckReparse(ReparseSource, edits);
+}
+
+TEST_CASE("Reparse edit of the metadata with a forward model reference", "[parser][reparse]")
+{
+    mdp::ByteBuffer source
+        = "FORMAT: 1A\n\n"
+          "# API\n\n"
+          "# Group Notes\n"
+          "## Notes [/notes]\n"
+          "### List [GET]\n"
+          "+ Response 200\n\n"
+          "    [Tag][]\n\n"
+          "# Group Tags\n"
+          "## Tag [/tags/{id}]\n"
+          "+ Model (text/plain)\n\n"
+          "        tag\n";
+
+    // The Markdown is parsed from scratch, cached segments are dropped with it
+    std::vector<SourceEdit> edits;
+    edits.push_back(SourceEdit(0, 10, "FORMAT: 1A\nHOST: http://example.com"));
+    edits.push_back(SourceEdit(0, 0, "\n"));
+
+    CheckReparse(source, edits);
+}
+
+TEST_CASE("Reparse edit of a model referenced by a later group", "[parser][reparse]")
+{
+    mdp::ByteBuffer source
+        = "FORMAT: 1A\n\n"
+          "# API\n\n"
+          "# Group Notes\n"
+          "## Note [/notes/{id}]\n"
+          "+ Model (text/plain)\n\n"
+          "        note\n\n"
+          "# Group Tags\n"
+          "## Tags [/tags]\n"
+          "### List [GET]\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "# Group Users\n"
+          "## Users [/users]\n";
+
+    // The group referring to the model is kept as long as the model is not edited
+    std::vector<SourceEdit> edits;
+    edits.push_back(SourceEdit(source.find("## Users"), 8, "## People"));
+    edits.push_back(SourceEdit(source.find("        note") + 8, 4, "a note"));
+
+    CheckReparse(source, edits);
+}
+
+TEST_CASE("Reparse edits opening and closing HTML blocks", "[parser][reparse]")
+{
+    // HTML block opened before a group header and closed after it
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# Group Notes\n"
+          "## Notes [/notes]\n"
+          "Notes of the user.\n\n"
+          "### List [GET]\n"
+          "+ Response 200\n\n"
+          "# Group Tags\n"
+          "</div>\n\n"
+          "## Tags [/tags]\n"
+          "### List [GET]\n"
+          "+ Response 200\n";
+
+    std::vector<SourceEdit> edits;
+    edits.push_back(SourceEdit(source.find("### List [GET]"), 0, "<div>\n"));
+
+    CheckReparse(source, edits);
+
+    // HTML block opened before the reparsed groups and closed within them
+    source = "# API\n"
+             "<div>\n\n"
+             "# Group Notes\n"
+             "## Notes [/notes]\n"
+             "### List [GET]\n"
+             "+ Response 200\n\n"
+             "# Group Tags\n"
+             "## Tags [/tags]\n"
+             "### List [GET]\n"
+             "+ Response 200\n";
+
+    edits.clear();
+    edits.push_back(SourceEdit(source.find("## Tags"), 0, "</div>\n\n"));
+
+    CheckReparse(source, edits);
+}
+
+TEST_CASE("Reparse edit out of the source", "[parser][reparse]")
+{
+    ParseState state;
+    ParseResult<Blueprint> blueprint;
+    parse("# API\n", 0, blueprint, state);
+
+    ParseResult<Blueprint> reparsed;
+    reparse(SourceEdit(4, 3, "x"), state, reparsed);
+
+    REQUIRE(reparsed.report.error.code == ApplicationError);
+    REQUIRE(state.source == "# API\n");
+}
+
+TEST_CASE("Parse a batch of blueprints", "[parser][batch]")
+{
+    std::vector<mdp::ByteBuffer> sources;
+    sources.push_back(ReparseSource);
+    sources.push_back(
+        "# API\n\n"
+        "# GET /\n"
+        "+ Response 200\n"
+        "    + Headers\n\n"
+        "            Set-Cookie: a=1\n"
+        "            Set-Cookie: b=2\n");
+    sources.push_back("# API\n\n# GET /\n\t+ Response 200\n");
+    sources.push_back("");
+    sources.push_back("# API\n\n# Data Structures\n\n## A (B)\n\n## B (A)\n");
+
+    ParseResults results;
+    int code = parseBatch(sources, ExportSourcemapOption | ParallelParsingOption, results, 4);
+
+    REQUIRE(results.size() == sources.size());
+    REQUIRE(code == BusinessError);
+
+    for (size_t i = 0; i < sources.size(); ++i) {
+        ParseResult<Blueprint> blueprint;
+        parse(sources[i], ExportSourcemapOption, blueprint);
+
+        REQUIRE(DumpParseResult(results[i]) == DumpParseResult(blueprint));
+    }
+
+    REQUIRE(parseBatch(std::vector<mdp::ByteBuffer>(), 0, results) == Error::OK);
+    REQUIRE(results.empty());
+}
+
+// Meant to be run under ThreadSanitizer, see `./configure --sanitize`
+TEST_CASE("Parse the same blueprint concurrently", "[parser][batch]")
+{
+    ParseResult<Blueprint> blueprint;
+    parse(ReparseSource, ExportSourcemapOption, blueprint);
+
+    std::vector<mdp::ByteBuffer> sources(32, ReparseSource);
+
+    ParseResults results;
+    REQUIRE(parseBatch(sources, ExportSourcemapOption, results, 8) == Error::OK);
+    REQUIRE(results.size() == sources.size());
+
+    std::string expected = DumpParseResult(blueprint);
+
+    for (ParseResults::const_iterator it = results.begin(); it != results.end(); ++it) {
+        REQUIRE(DumpParseResult(*it) == expected);
+    }
+}
+
+static void CheckValidateOnly(const mdp::ByteBuffer& source)
+{
+    ParseResult<Blueprint> full;
+    parse(source, ExportSourcemapOption, full);
+
+    std::stringstream expected;
+    DumpReport(full.report, expected);
+
+    BlueprintParserOptions options[] = { ValidateOnlyOption,
+        ValidateOnlyOption | ExportSourcemapOption,
+        ValidateOnlyOption | ParallelParsingOption };
+
+    for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); ++i) {
+
+        ParseResult<Blueprint> validated;
+        parse(source, options[i], validated);
+
+        std::stringstream report;
+        DumpReport(validated.report, report);
+
+        REQUIRE(report.str() == expected.str());
+        REQUIRE(validated.sourceMap.content.elements().collection.empty());
+    }
+}
+
+TEST_CASE("Validate a blueprint without building the AST", "[parser][validate]")
+{
+    mdp::ByteBuffer source
+        = "API description without a name\n\n"
+          "# Group A\n"
+          "Group A description\n\n"
+          "## Note [/notes/{id}]\n"
+          "Note description\n\n"
+          "+ Model (text/plain)\n\n"
+          "        note\n\n"
+          "### Retrieve [GET]\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "### Update [PUT]\n"
+          "+ Request (application/json)\n\n"
+          "    [Tag][]\n\n"
+          "+ Response 204\n\n"
+          "        body\n\n"
+          "# Group A\n\n"
+          "## Tag [/tags/{id}]\n"
+          "+ Model\n"
+          "    + Headers\n\n"
+          "            Content-Type: text/plain\n\n"
+          "    + Body\n\n"
+          "            tag\n\n"
+          "### Retrieve [GET]\n"
+          "+ Request\n\n"
+          "    [Tag][]\n\n"
+          "+ Response 200\n\n"
+          "# Data Structures\n\n"
+          "## User (object)\n"
+          "User description\n\n"
+          "+ name: Pavan (string)\n"
+          "+ address (Address)\n\n"
+          "## Address (object)\n"
+          "+ city: Prague\n";
+
+    CheckValidateOnly(source);
+    CheckValidateOnly(ReparseSource);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, ValidateOnlyOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() > 2);
+    REQUIRE(blueprint.node.content.elements().size() == 3);
+
+    // Only resources with a reference to a model defined later are kept
+    REQUIRE(blueprint.node.content.elements().at(0).content.elements().size() == 1);
+    REQUIRE(blueprint.node.content.elements().at(1).content.elements().empty());
+    REQUIRE(blueprint.node.content.elements().at(2).content.elements().empty());
+
+    const Resource& resource = blueprint.node.content.elements().at(0).content.elements().at(0).content.resource;
+    REQUIRE(resource.description.empty());
+    REQUIRE(resource.actions.at(1).examples.at(0).requests.at(0).body == "tag\n");
+}
+
+TEST_CASE("Validate a blueprint with an error", "[parser][validate]")
+{
+    CheckValidateOnly(
+        "# API\n\n"
+        "# Data Structures\n\n"
+        "## A (B)\n\n"
+        "## B (A)\n");
+
+    CheckValidateOnly(
+        "# API\n\n"
+        "# /notes\n"
+        "## GET\n"
+        "+ Response 200\n\n"
+        "    [Undefined][]\n");
+}
+
+TEST_CASE("Parse with a cancelled token", "[parser][limits]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# /notes\n"
+          "## GET\n"
+          "+ Response 200\n";
+
+    CancellationToken token;
+    token.cancel();
+
+    ParseLimits limits;
+    limits.cancellationToken = &token;
+
+    ParseResult<Blueprint> blueprint;
+    REQUIRE(parse(source, 0, blueprint, limits) == CancelledError);
+
+    REQUIRE(blueprint.report.error.code == CancelledError);
+    REQUIRE(blueprint.report.error.message == ParsingCancelledMessage);
+}
+
+TEST_CASE("Parse past the deadline", "[parser][limits]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# /notes\n"
+          "## GET\n"
+          "+ Response 200\n";
+
+    ParseLimits limits;
+    limits.deadline = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint, limits);
+
+    REQUIRE(blueprint.report.error.code == CancelledError);
+    REQUIRE(blueprint.report.error.message == DeadlineExceededMessage);
+}
+
+TEST_CASE("Parse within limits", "[parser][limits]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# /notes\n"
+          "## GET\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "# Note [/notes/{id}]\n"
+          "+ Model\n\n"
+          "        note\n\n"
+          "+ Respons 204\n";
+
+    CancellationToken token;
+
+    ParseLimits limits;
+    limits.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    limits.cancellationToken = &token;
+
+    ParseResult<Blueprint> expected;
+    parse(source, 0, expected);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint, limits);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == expected.report.warnings.size());
+    REQUIRE(blueprint.node.content.elements().size() == expected.node.content.elements().size());
+}
+
+TEST_CASE("Abort a parse in progress at its deadline", "[parser][limits]")
+{
+    std::stringstream source;
+    source << "# API\n\n";
+
+    for (int i = 0; i < 2000; ++i) {
+        source << "# Group " << i << "\n\n"
+               << "## Resource " << i << " [/resources/" << i << "]\n\n"
+               << "### Retrieve [GET]\n\n"
+               << "+ Response 200 (text/plain)\n\n"
+               << "        resource " << i << "\n\n";
+    }
+
+    ParseLimits limits;
+    limits.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source.str(), 0, blueprint, limits);
+
+    REQUIRE(blueprint.report.error.code == CancelledError);
+    REQUIRE(blueprint.report.error.message == DeadlineExceededMessage);
+
+    ParseResult<Blueprint> parallel;
+    limits.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+    parse(source.str(), ParallelParsingOption, parallel, limits);
+
+    REQUIRE(parallel.report.error.code == CancelledError);
+}
+
+TEST_CASE("Report memory used by a parse", "[parser][limits]")
+{
+    std::stringstream source;
+    source << "# API\n\n";
+
+    for (int i = 0; i < 10; ++i) {
+        source << "# Resource " << i << " [/resources/" << i << "]\n\n"
+               << "## Retrieve [GET]\n\n"
+               << "+ Response 200 (text/plain)\n\n"
+               << "        resource " << i << "\n\n";
+    }
+
+    ParseStatistics small;
+    ParseResult<Blueprint> blueprint;
+    parse(source.str().substr(0, source.str().length() / 2), 0, blueprint, ParseLimits(), &small);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(small.finalMemory > 0);
+    REQUIRE(small.peakMemory > small.finalMemory);
+
+    ParseStatistics statistics;
+    ParseResult<Blueprint> full;
+    parse(source.str(), 0, full, ParseLimits(), &statistics);
+
+    REQUIRE(statistics.finalMemory > small.finalMemory);
+    REQUIRE(statistics.peakMemory > small.peakMemory);
+
+    ParseStatistics withSourceMap;
+    ParseResult<Blueprint> sourceMap;
+    parse(source.str(), ExportSourcemapOption, sourceMap, ParseLimits(), &withSourceMap);
+
+    REQUIRE(withSourceMap.finalMemory > statistics.finalMemory);
+}
+
+TEST_CASE("Abort a parse over its memory budget", "[parser][limits]")
+{
+    std::stringstream source;
+    source << "# API\n\n";
+
+    for (int i = 0; i < 100; ++i) {
+        source << "# Group " << i << "\n\n"
+               << "## Resource " << i << " [/resources/" << i << "]\n\n"
+               << "### Retrieve [GET]\n\n"
+               << "+ Response 200 (text/plain)\n\n"
+               << "        resource " << i << "\n\n";
+    }
+
+    ParseStatistics statistics;
+    ParseResult<Blueprint> expected;
+    parse(source.str(), 0, expected, ParseLimits(), &statistics);
+
+    REQUIRE(expected.report.error.code == Error::OK);
+
+    ParseLimits limits;
+    limits.memoryBudget = statistics.peakMemory;
+
+    ParseResult<Blueprint> blueprint;
+    parse(source.str(), 0, blueprint, limits);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.node.content.elements().size() == expected.node.content.elements().size());
+
+    limits.memoryBudget = statistics.peakMemory - 1;
+
+    ParseResult<Blueprint> exceeded;
+    parse(source.str(), 0, exceeded, limits);
+
+    REQUIRE(exceeded.report.error.code == MemoryBudgetError);
+    REQUIRE(exceeded.report.error.message == MemoryBudgetExceededMessage);
+
+    ParseResult<Blueprint> parallel;
+    parse(source.str(), ParallelParsingOption, parallel, limits);
+
+    REQUIRE(parallel.report.error.code == MemoryBudgetError);
+}
+
+/** Source map locations of a part of the blueprint */
+static void DumpLocation(const mdp::CharactersRangeSet& sourceMap, std::stringstream& s)
+{
+    for (mdp::CharactersRangeSet::const_iterator it = sourceMap.begin(); it != sourceMap.end(); ++it)
+        s << " " << it->location << ":" << it->length;
+
+    s << "\n";
+}
+
+/** Visitor recording the events in the format of `DumpVisitedParts()` */
+struct RecordingVisitor : public BlueprintVisitor {
+
+    std::stringstream events;
+    std::stringstream resolved;
+
+    void visitResourceGroup(const Element& group, const SourceMap<Element>& sourceMap)
+    {
+        events << "group " << group.attributes.name << "|" << group.content.elements().size();
+        DumpLocation(sourceMap.attributes.name.sourceMap, events);
+    }
+
+    void visitResource(const Resource& resource, const SourceMap<Resource>& sourceMap)
+    {
+        events << " resource " << resource.name << "|" << resource.uriTemplate << "|" << resource.description;
+        DumpLocation(sourceMap.uriTemplate.sourceMap, events);
+    }
+
+    void visitAction(const Action& action, const SourceMap<Action>& sourceMap)
+    {
+        events << "  action " << action.method << "|" << action.name;
+        DumpLocation(sourceMap.method.sourceMap, events);
+    }
+
+    void visitTransactionExample(const TransactionExample& example, const SourceMap<TransactionExample>& sourceMap)
+    {
+        events << "   example " << example.requests.size() << "|" << example.responses.size();
+        DumpLocation(sourceMap.name.sourceMap, events);
+    }
+
+    void visitDataStructure(const DataStructure& dataStructure, const SourceMap<DataStructure>& sourceMap)
+    {
+        events << " data structure " << dataStructure.name.symbol.literal << "|" << dataStructure.sections.size()
+               << "\n";
+    }
+
+    void visitResolvedAction(const Resource& resource, const Action& action, const SourceMap<Action>& sourceMap)
+    {
+        resolved << resource.uriTemplate << " " << action.method;
+        DumpLocation(sourceMap.method.sourceMap, resolved);
+
+        for (TransactionExamples::const_iterator it = action.examples.begin(); it != action.examples.end(); ++it) {
+            DumpPayloads(it->requests, resolved);
+            DumpPayloads(it->responses, resolved);
+        }
+    }
+};
+
+/** \return Parts of a parsed blueprint in the order they are visited */
+static std::string DumpVisitedParts(const ParseResult<Blueprint>& result)
+{
+    static const SourceMap<Element> emptySourceMap;
+
+    std::stringstream s;
+    const Elements& groups = result.node.content.elements();
+    const Collection<SourceMap<Element> >::type& groupsSourceMap = result.sourceMap.content.elements().collection;
+
+    for (size_t i = 0; i < groups.size(); ++i) {
+
+        const SourceMap<Element>& groupSourceMap = i < groupsSourceMap.size() ? groupsSourceMap[i] : emptySourceMap;
+
+        if (groups[i].category == Element::ResourceGroupCategory) {
+            s << "group " << groups[i].attributes.name << "|" << groups[i].content.elements().size();
+            DumpLocation(groupSourceMap.attributes.name.sourceMap, s);
+        }
+
+        for (size_t j = 0; j < groups[i].content.elements().size(); ++j) {
+
+            const Element& element = groups[i].content.elements()[j];
+            const SourceMap<Element>& elementSourceMap = j < groupSourceMap.content.elements().collection.size()
+                ? groupSourceMap.content.elements().collection[j]
+                : emptySourceMap;
+
+            if (element.element == Element::DataStructureElement) {
+                s << " data structure " << element.content.dataStructure.name.symbol.literal << "|"
+                  << element.content.dataStructure.sections.size() << "\n";
+            }
+
+            if (element.element != Element::ResourceElement)
+                continue;
+
+            const Resource& resource = element.content.resource;
+            const SourceMap<Resource>& resourceSourceMap = elementSourceMap.content.resource;
+
+            s << " resource " << resource.name << "|" << resource.uriTemplate << "|" << resource.description;
+            DumpLocation(resourceSourceMap.uriTemplate.sourceMap, s);
+
+            for (size_t k = 0; k < resource.actions.size(); ++k) {
+
+                const Action& action = resource.actions[k];
+                SourceMap<Action> actionSourceMap;
+
+                if (k < resourceSourceMap.actions.collection.size())
+                    actionSourceMap = resourceSourceMap.actions.collection[k];
+
+                s << "  action " << action.method << "|" << action.name;
+                DumpLocation(actionSourceMap.method.sourceMap, s);
+
+                for (size_t l = 0; l < action.examples.size(); ++l) {
+
+                    SourceMap<TransactionExample> exampleSourceMap;
+
+                    if (l < actionSourceMap.examples.collection.size())
+                        exampleSourceMap = actionSourceMap.examples.collection[l];
+
+                    s << "   example " << action.examples[l].requests.size() << "|"
+                      << action.examples[l].responses.size();
+                    DumpLocation(exampleSourceMap.name.sourceMap, s);
+                }
+            }
+        }
+    }
+
+    return s.str();
+}
+
+static void CheckVisitedParse(const mdp::ByteBuffer& source)
+{
+    BlueprintParserOptions options[] = { 0, ExportSourcemapOption, ParallelParsingOption,
+        ExportSourcemapOption | ParallelParsingOption };
+
+    for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); ++i) {
+
+        ParseResult<Blueprint> full;
+        parse(source, options[i], full);
+
+        std::stringstream expected;
+        DumpReport(full.report, expected);
+
+        RecordingVisitor visitor;
+        ParseResult<Blueprint> visited;
+        parse(source, options[i], visited, visitor);
+
+        std::stringstream report;
+        DumpReport(visited.report, report);
+
+        REQUIRE(report.str() == expected.str());
+        REQUIRE(visitor.events.str() == DumpVisitedParts(full));
+
+        // Groups are kept without their content
+        REQUIRE(visited.node.name == full.node.name);
+        REQUIRE(visited.node.content.elements().size() == full.node.content.elements().size());
+
+        for (Elements::const_iterator it = visited.node.content.elements().begin();
+             it != visited.node.content.elements().end();
+             ++it) {
+            REQUIRE(it->content.elements().empty());
+        }
+    }
+}
+
+TEST_CASE("Visit the groups of a blueprint as they are parsed", "[parser][visitor]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# Group A\n"
+          "Group A description\n\n"
+          "## Note [/notes/{id}]\n"
+          "Note description\n\n"
+          "+ Model (text/plain)\n\n"
+          "        note\n\n"
+          "### Retrieve [GET]\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "### Update [PUT]\n"
+          "+ Request (application/json)\n\n"
+          "    [Tag][]\n\n"
+          "+ Response 204\n\n"
+          "        body\n\n"
+          "# Group B\n\n"
+          "## Tag [/tags/{id}]\n"
+          "+ Model\n"
+          "    + Headers\n\n"
+          "            Content-Type: text/plain\n\n"
+          "    + Body\n\n"
+          "            tag\n\n"
+          "### Retrieve [GET]\n"
+          "+ Request\n\n"
+          "    [Tag][]\n\n"
+          "+ Response 200\n\n"
+          "# Data Structures\n\n"
+          "## User (object)\n"
+          "+ name: Pavan (string)\n"
+          "+ address (Address)\n\n"
+          "## Address (object)\n"
+          "+ city: Prague\n";
+
+    CheckVisitedParse(source);
+    CheckVisitedParse(ReparseSource);
+
+    RecordingVisitor visitor;
+    ParseResult<Blueprint> blueprint;
+    parse(source, ExportSourcemapOption, blueprint, visitor);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(visitor.events.str().find("group A|2 7:10\n resource Note|/notes/{id}|Note description") == 0);
+    REQUIRE(visitor.events.str().find(" data structure Address|1\n") != std::string::npos);
+
+    // The reference to a model defined later is resolved at the end
+    REQUIRE(visitor.resolved.str().find("/notes/{id} PUT") == 0);
+    REQUIRE(visitor.resolved.str().find("|tag\n|") != std::string::npos);
+    REQUIRE(visitor.resolved.str().find("|Tag|2\n") != std::string::npos);
+}
+
+TEST_CASE("Visit a blueprint with an undefined model", "[parser][visitor]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# /notes\n"
+          "## GET\n"
+          "+ Response 200\n\n"
+          "    [Undefined][]\n";
+
+    CheckVisitedParse(source);
+
+    RecordingVisitor visitor;
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint, visitor);
+
+    REQUIRE(blueprint.report.error.code == ModelError);
+    REQUIRE(visitor.resolved.str().find("|Undefined|0\n") != std::string::npos);
+}
+
+TEST_CASE("Visiting the groups bounds the memory used by a parse", "[parser][visitor][limits]")
+{
+    std::stringstream source;
+    source << "# API\n\n";
+
+    for (int i = 0; i < 100; ++i) {
+        source << "# Group " << i << "\n\n"
+               << "## Resource " << i << " [/resources/" << i << "]\n\n"
+               << "### Retrieve [GET]\n\n"
+               << "+ Response 200 (text/plain)\n\n"
+               << "        resource " << i << "\n\n";
+    }
+
+    ParseStatistics full;
+    ParseResult<Blueprint> expected;
+    parse(source.str(), ExportSourcemapOption, expected, ParseLimits(), &full);
+
+    BlueprintVisitor visitor;
+    ParseStatistics visited;
+    ParseResult<Blueprint> blueprint;
+    parse(source.str(), ExportSourcemapOption, blueprint, visitor, ParseLimits(), &visited);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(visited.peakMemory < full.peakMemory);
+    REQUIRE(visited.finalMemory < full.finalMemory);
+
+    // A budget too small for the whole AST is enough
+    ParseLimits limits;
+    limits.memoryBudget = visited.peakMemory;
+
+    ParseResult<Blueprint> limited;
+    parse(source.str(), ExportSourcemapOption, limited, visitor, limits);
+
+    REQUIRE(limited.report.error.code == Error::OK);
+}
+
+TEST_CASE("Parse source data in place", "[parser][inplace]")
+{
+    mdp::ByteBuffer source = ReparseSource;
+
+    // Bytes past the source data must not be parsed, nor is there a NUL terminator
+    std::vector<char> data(source.begin(), source.end());
+    data.push_back('\t');
+
+    BlueprintParserOptions options[] = { 0, ExportSourcemapOption, ExportSourcemapOption | ParallelParsingOption };
+
+    for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); ++i) {
+
+        ParseResult<Blueprint> expected;
+        parse(source, options[i], expected);
+
+        ParseResult<Blueprint> blueprint;
+        parse(data.data(), source.length(), options[i], blueprint);
+
+        REQUIRE(blueprint.report.error.code == Error::OK);
+        REQUIRE(DumpParseResult(blueprint) == DumpParseResult(expected));
+    }
+
+    // Source data ending anywhere, e.g. in the middle of a line or of a character
+    for (size_t length = 0; length < source.length(); length += 7) {
+
+        ParseResult<Blueprint> expected;
+        parse(source.substr(0, length), ExportSourcemapOption, expected);
+
+        ParseResult<Blueprint> blueprint;
+        parse(data.data(), length, ExportSourcemapOption, blueprint);
+
+        REQUIRE(DumpParseResult(blueprint) == DumpParseResult(expected));
+    }
+
+    ParseResult<Blueprint> deferred;
+    parse(data.data(), source.length(), DeferWarningsOption, deferred);
+    FormatWarnings(deferred.report, data.data(), source.length());
+
+    ParseResult<Blueprint> expected;
+    parse(source, 0, expected);
+
+    REQUIRE(!deferred.report.warnings.empty());
+    REQUIRE(DumpParseResult(deferred) == DumpParseResult(expected));
+
+    ParseResult<Blueprint> empty;
+    REQUIRE(parse(NULL, 0, 0, empty) == Error::OK);
+    REQUIRE(empty.node.content.elements().empty());
+}
+
+TEST_CASE("Parse a memory-mapped file", "[parser][inplace]")
+{
+    const char* path = "test-snowcrash-parse-file.apib";
+    mdp::ByteBuffer source = ReparseSource;
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << source;
+    }
+
+    MappedFile mapped(path);
+
+    REQUIRE(mapped.isOpen());
+    REQUIRE(mapped.length() == source.length());
+    REQUIRE(std::equal(source.begin(), source.end(), mapped.data()));
+
+    ParseResult<Blueprint> expected;
+    parse(source, ExportSourcemapOption, expected);
+
+    // Warnings are formatted before the file is unmapped
+    ParseResult<Blueprint> blueprint;
+    parseFile(path, ExportSourcemapOption | DeferWarningsOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(!blueprint.report.warnings.empty());
+    REQUIRE(!blueprint.report.warnings.front().isDeferred());
+    REQUIRE(DumpParseResult(blueprint) == DumpParseResult(expected));
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    }
+
+    ParseResult<Blueprint> empty;
+    REQUIRE(parseFile(path, 0, empty) == Error::OK);
+    REQUIRE(empty.node.content.elements().empty());
+
+    std::remove(path);
+
+    ParseResult<Blueprint> missing;
+    REQUIRE(parseFile(path, 0, missing) == ApplicationError);
+    REQUIRE(missing.report.error.message.find(path) != std::string::npos);
+}